@@ -0,0 +1,294 @@
+#include "Commands/UnrealMCPActorIndex.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+FUnrealMCPActorIndex& FUnrealMCPActorIndex::Get()
+{
+    static FUnrealMCPActorIndex Index;
+    return Index;
+}
+
+FUnrealMCPActorIndex::FUnrealMCPActorIndex()
+    : Generation(0)
+    , bDirty(true)
+    , bInitialized(false)
+{
+}
+
+void FUnrealMCPActorIndex::Initialize()
+{
+    if (bInitialized || !GEngine)
+    {
+        return;
+    }
+
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FUnrealMCPActorIndex::HandleLevelActorAdded);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FUnrealMCPActorIndex::HandleLevelActorDeleted);
+    ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FUnrealMCPActorIndex::Invalidate);
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FUnrealMCPActorIndex::HandleActorLabelChanged);
+    MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32 /*MapChangeFlags*/) { Invalidate(); });
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FUnrealMCPActorIndex::HandleLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FUnrealMCPActorIndex::HandleLevelChanged);
+
+    bInitialized = true;
+    Invalidate();
+}
+
+void FUnrealMCPActorIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+    }
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FEditorDelegates::MapChange.Remove(MapChangeHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+    bInitialized = false;
+    Invalidate();
+}
+
+AActor* FUnrealMCPActorIndex::FindByName(UWorld* World, const FString& Name)
+{
+    if (!World || Name.IsEmpty())
+    {
+        return nullptr;
+    }
+    EnsureBuilt(World);
+
+    // FNAME_Find never adds to the name table: an unknown name cannot belong to any actor
+    const FName Key(*Name, FNAME_Find);
+    if (Key.IsNone())
+    {
+        return nullptr;
+    }
+
+    if (const TWeakObjectPtr<AActor>* Found = ActorsByName.Find(Key))
+    {
+        AActor* Actor = Found->Get();
+        if (IsValid(Actor) && Actor->GetFName() == Key && Actor->GetWorld() == World)
+        {
+            return Actor;
+        }
+        ActorsByName.Remove(Key);
+    }
+
+    // Renames and undo/redo can change names without a delegate; the per-level object hash is still O(1)
+    for (ULevel* Level : World->GetLevels())
+    {
+        AActor* Actor = Level ? FindObjectFast<AActor>(Level, Key) : nullptr;
+        if (IsValid(Actor))
+        {
+            AddActor(Actor);
+            return Actor;
+        }
+    }
+    return nullptr;
+}
+
+AActor* FUnrealMCPActorIndex::FindByLabel(UWorld* World, const FString& Label, bool* bOutAmbiguous)
+{
+    if (bOutAmbiguous)
+    {
+        *bOutAmbiguous = false;
+    }
+    if (!World || Label.IsEmpty())
+    {
+        return nullptr;
+    }
+    EnsureBuilt(World);
+
+    if (const TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>* Entries = ActorsByLabel.Find(Label))
+    {
+        AActor* Found = nullptr;
+        for (const TWeakObjectPtr<AActor>& Entry : *Entries)
+        {
+            AActor* Actor = Entry.Get();
+            if (IsValid(Actor) && Actor->GetWorld() == World && Actor->GetActorLabel(false) == Label)
+            {
+                if (!Found)
+                {
+                    Found = Actor;
+                    if (!bOutAmbiguous)
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    *bOutAmbiguous = true;
+                    break;
+                }
+            }
+        }
+        return Found;
+    }
+    return nullptr;
+}
+
+AActor* FUnrealMCPActorIndex::FindActor(UWorld* World, const FString& NameOrLabel)
+{
+    if (AActor* Actor = FindByName(World, NameOrLabel))
+    {
+        return Actor;
+    }
+    return FindByLabel(World, NameOrLabel);
+}
+
+int32 FUnrealMCPActorIndex::Num(UWorld* World)
+{
+    EnsureBuilt(World);
+    return ActorsByName.Num();
+}
+
+void FUnrealMCPActorIndex::Invalidate()
+{
+    bDirty = true;
+    ++Generation;
+}
+
+void FUnrealMCPActorIndex::EnsureBuilt(UWorld* World)
+{
+    if (!bDirty && IndexedWorld.Get() == World)
+    {
+        return;
+    }
+
+    ActorsByName.Reset();
+    ActorsByLabel.Reset();
+    IndexedLabels.Reset();
+    IndexedWorld = World;
+    // Without the delegates nothing keeps the index current, so rebuild on every lookup
+    bDirty = !bInitialized;
+
+    if (!World)
+    {
+        return;
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AddActor(*It);
+    }
+    UE_LOG(LogTemp, Verbose, TEXT("UnrealMCPActorIndex: Indexed %d actors in %s (%.2f ms)"),
+        ActorsByName.Num(), *World->GetName(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
+
+void FUnrealMCPActorIndex::AddActor(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    ActorsByName.Add(Actor->GetFName(), Actor);
+
+    const FString& Label = Actor->GetActorLabel(false);
+    if (!Label.IsEmpty())
+    {
+        ActorsByLabel.FindOrAdd(Label).AddUnique(Actor);
+        IndexedLabels.Add(Actor, Label);
+    }
+}
+
+void FUnrealMCPActorIndex::RemoveActor(AActor* Actor)
+{
+    const FName Name = Actor->GetFName();
+    if (const TWeakObjectPtr<AActor>* Found = ActorsByName.Find(Name))
+    {
+        if (Found->Get() == Actor)
+        {
+            ActorsByName.Remove(Name);
+        }
+    }
+
+    if (const FString* Label = IndexedLabels.Find(Actor))
+    {
+        RemoveLabelEntry(Actor, *Label);
+        IndexedLabels.Remove(Actor);
+    }
+}
+
+void FUnrealMCPActorIndex::RemoveLabelEntry(AActor* Actor, const FString& Label)
+{
+    if (TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>* Entries = ActorsByLabel.Find(Label))
+    {
+        Entries->RemoveAllSwap([Actor](const TWeakObjectPtr<AActor>& Entry)
+        {
+            return !Entry.IsValid() || Entry.Get() == Actor;
+        });
+        if (Entries->Num() == 0)
+        {
+            ActorsByLabel.Remove(Label);
+        }
+    }
+}
+
+bool FUnrealMCPActorIndex::IsIndexedWorld(const AActor* Actor) const
+{
+    // A dirty index is rebuilt wholesale on the next lookup, so incremental updates are pointless
+    return !bDirty && Actor && IndexedWorld.IsValid() && Actor->GetWorld() == IndexedWorld.Get();
+}
+
+void FUnrealMCPActorIndex::HandleLevelActorAdded(AActor* Actor)
+{
+    ++Generation;
+    if (IsIndexedWorld(Actor))
+    {
+        AddActor(Actor);
+    }
+}
+
+void FUnrealMCPActorIndex::HandleLevelActorDeleted(AActor* Actor)
+{
+    ++Generation;
+    if (IsIndexedWorld(Actor))
+    {
+        RemoveActor(Actor);
+    }
+}
+
+void FUnrealMCPActorIndex::HandleActorLabelChanged(AActor* Actor)
+{
+    ++Generation;
+    if (!IsIndexedWorld(Actor))
+    {
+        return;
+    }
+
+    if (const FString* OldLabel = IndexedLabels.Find(Actor))
+    {
+        RemoveLabelEntry(Actor, *OldLabel);
+        IndexedLabels.Remove(Actor);
+    }
+
+    const FString& Label = Actor->GetActorLabel(false);
+    if (!Label.IsEmpty())
+    {
+        ActorsByLabel.FindOrAdd(Label).AddUnique(Actor);
+        IndexedLabels.Add(Actor, Label);
+    }
+}
+
+void FUnrealMCPActorIndex::HandleLevelChanged(ULevel* /*Level*/, UWorld* World)
+{
+    if (World == IndexedWorld.Get())
+    {
+        Invalidate();
+    }
+}
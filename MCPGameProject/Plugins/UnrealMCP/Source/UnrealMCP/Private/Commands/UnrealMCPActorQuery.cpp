@@ -0,0 +1,552 @@
+#include "Commands/UnrealMCPActorQuery.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/Base64.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+struct FActorFieldName
+{
+    const TCHAR* Name;
+    EMCPActorFields Field;
+};
+
+const FActorFieldName ActorFieldNames[] = {
+    {TEXT("name"), EMCPActorFields::Name},
+    {TEXT("label"), EMCPActorFields::Label},
+    {TEXT("class"), EMCPActorFields::Class},
+    {TEXT("path"), EMCPActorFields::Path},
+    {TEXT("location"), EMCPActorFields::Location},
+    {TEXT("rotation"), EMCPActorFields::Rotation},
+    {TEXT("scale"), EMCPActorFields::Scale},
+    {TEXT("bounds"), EMCPActorFields::Bounds},
+    {TEXT("folder"), EMCPActorFields::Folder},
+    {TEXT("level"), EMCPActorFields::Level},
+    {TEXT("tags"), EMCPActorFields::Tags},
+};
+
+TArray<TSharedPtr<FJsonValue>> VectorToJsonArray(const FVector& Vector)
+{
+    TArray<TSharedPtr<FJsonValue>> Array;
+    Array.Reserve(3);
+    Array.Add(MakeShared<FJsonValueNumber>(Vector.X));
+    Array.Add(MakeShared<FJsonValueNumber>(Vector.Y));
+    Array.Add(MakeShared<FJsonValueNumber>(Vector.Z));
+    return Array;
+}
+
+void AppendLine(FString& Column, const FString& Value, bool bFirst)
+{
+    if (!bFirst)
+    {
+        Column.AppendChar(TEXT('\n'));
+    }
+    Column.Append(Value);
+}
+
+void AppendVector(TArray<double>& Column, const FVector& Vector)
+{
+    Column.Add(Vector.X);
+    Column.Add(Vector.Y);
+    Column.Add(Vector.Z);
+}
+
+template <typename PackedType, typename SourceType>
+TSharedPtr<FJsonValue> NumberColumnToJson(const TArray<SourceType>& Values, EMCPColumnEncoding Encoding)
+{
+    if (Encoding == EMCPColumnEncoding::Array)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(Values.Num());
+        for (const SourceType Value : Values)
+        {
+            Array.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Value)));
+        }
+        return MakeShared<FJsonValueArray>(Array);
+    }
+
+    TArray<PackedType> Packed;
+    Packed.SetNumUninitialized(Values.Num());
+    for (int32 Index = 0; Index < Values.Num(); ++Index)
+    {
+        Packed[Index] = static_cast<PackedType>(Values[Index]);
+    }
+    return MakeShared<FJsonValueString>(FBase64::Encode(reinterpret_cast<const uint8*>(Packed.GetData()), Packed.Num() * sizeof(PackedType)));
+}
+}
+
+FMCPActorColumnWriter::FMCPActorColumnWriter(EMCPActorFields InFields, EMCPColumnEncoding InEncoding, int32 ExpectedCount)
+    : Fields(InFields)
+    , Encoding(InEncoding)
+    , Count(0)
+{
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Name))
+    {
+        Names.Reserve(ExpectedCount * 24);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Class))
+    {
+        Classes.Reserve(ExpectedCount);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Location))
+    {
+        Locations.Reserve(ExpectedCount * 3);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Rotation))
+    {
+        Rotations.Reserve(ExpectedCount * 3);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Scale))
+    {
+        Scales.Reserve(ExpectedCount * 3);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Bounds))
+    {
+        Bounds.Reserve(ExpectedCount * 6);
+    }
+}
+
+void FMCPActorColumnWriter::Add(const AActor* Actor)
+{
+    if (!Actor)
+    {
+        return;
+    }
+    const bool bFirst = Count == 0;
+    ++Count;
+
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Name))
+    {
+        AppendLine(Names, Actor->GetName(), bFirst);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Label))
+    {
+        AppendLine(Labels, Actor->GetActorLabel(false), bFirst);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Class))
+    {
+        const UClass* Class = Actor->GetClass();
+        uint32* Index = ClassIndices.Find(Class);
+        if (!Index)
+        {
+            Index = &ClassIndices.Add(Class, ClassTable.Num());
+            ClassTable.Add(Class->GetName());
+        }
+        Classes.Add(*Index);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Path))
+    {
+        AppendLine(Paths, Actor->GetPathName(), bFirst);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Location))
+    {
+        AppendVector(Locations, Actor->GetActorLocation());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Rotation))
+    {
+        const FRotator Rotation = Actor->GetActorRotation();
+        AppendVector(Rotations, FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Scale))
+    {
+        AppendVector(Scales, Actor->GetActorScale3D());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Bounds))
+    {
+        const FBox Box = Actor->GetComponentsBoundingBox(true);
+        const FVector Location = Actor->GetActorLocation();
+        AppendVector(Bounds, Box.IsValid ? Box.Min : Location);
+        AppendVector(Bounds, Box.IsValid ? Box.Max : Location);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Folder))
+    {
+        AppendLine(Folders, Actor->GetFolderPath().ToString(), bFirst);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Level))
+    {
+        const ULevel* Level = Actor->GetLevel();
+        AppendLine(Levels, Level ? Level->GetOutermost()->GetName() : FString(), bFirst);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Tags))
+    {
+        // An array per actor: tags may contain any character, so no separator would be unambiguous
+        TArray<TSharedPtr<FJsonValue>> TagValues;
+        TagValues.Reserve(Actor->Tags.Num());
+        for (const FName& Tag : Actor->Tags)
+        {
+            TagValues.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+        }
+        Tags.Add(MakeShared<FJsonValueArray>(MoveTemp(TagValues)));
+    }
+}
+
+void FMCPActorColumnWriter::AddNumberColumn(const FString& Name, TArray<double> Values)
+{
+    check(Values.Num() == Count);
+    ExtraColumns.Emplace(Name, MoveTemp(Values));
+}
+
+void FMCPActorColumnWriter::WriteTo(FJsonObject& Result) const
+{
+    TSharedPtr<FJsonObject> Columns = MakeShared<FJsonObject>();
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Name))
+    {
+        Columns->SetStringField(TEXT("name"), Names);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Label))
+    {
+        Columns->SetStringField(TEXT("label"), Labels);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Class))
+    {
+        TArray<TSharedPtr<FJsonValue>> TableArray;
+        for (const FString& ClassName : ClassTable)
+        {
+            TableArray.Add(MakeShared<FJsonValueString>(ClassName));
+        }
+        Columns->SetArrayField(TEXT("class_table"), TableArray);
+        Columns->SetField(TEXT("class"), NumberColumnToJson<uint32>(Classes, Encoding));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Path))
+    {
+        Columns->SetStringField(TEXT("path"), Paths);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Location))
+    {
+        Columns->SetField(TEXT("location"), NumberColumnToJson<float>(Locations, Encoding));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Rotation))
+    {
+        Columns->SetField(TEXT("rotation"), NumberColumnToJson<float>(Rotations, Encoding));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Scale))
+    {
+        Columns->SetField(TEXT("scale"), NumberColumnToJson<float>(Scales, Encoding));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Bounds))
+    {
+        Columns->SetField(TEXT("bounds"), NumberColumnToJson<float>(Bounds, Encoding));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Folder))
+    {
+        Columns->SetStringField(TEXT("folder"), Folders);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Level))
+    {
+        Columns->SetStringField(TEXT("level"), Levels);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Tags))
+    {
+        Columns->SetArrayField(TEXT("tags"), Tags);
+    }
+    for (const TPair<FString, TArray<double>>& Extra : ExtraColumns)
+    {
+        Columns->SetField(Extra.Key, NumberColumnToJson<float>(Extra.Value, Encoding));
+    }
+
+    Result.SetStringField(TEXT("layout"), TEXT("columnar"));
+    Result.SetStringField(TEXT("encoding"), Encoding == EMCPColumnEncoding::Base64 ? TEXT("base64") : TEXT("array"));
+    Result.SetObjectField(TEXT("columns"), Columns);
+}
+
+bool FMCPActorFilter::Matches(const AActor* Actor) const
+{
+    if (!Actor)
+    {
+        return false;
+    }
+    if (Class && !Actor->IsA(Class))
+    {
+        return false;
+    }
+    if (!Tag.IsNone() && !Actor->ActorHasTag(Tag))
+    {
+        return false;
+    }
+    if (Level && Actor->GetLevel() != Level)
+    {
+        return false;
+    }
+    if (!Folder.IsEmpty())
+    {
+        const FString ActorFolder = Actor->GetFolderPath().ToString();
+        if (!ActorFolder.Equals(Folder, ESearchCase::IgnoreCase) &&
+            !(ActorFolder.StartsWith(Folder, ESearchCase::IgnoreCase) && ActorFolder[Folder.Len()] == TEXT('/')))
+        {
+            return false;
+        }
+    }
+    if (!LabelPattern.IsEmpty() && !Actor->GetActorLabel(false).MatchesWildcard(LabelPattern, ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+    return true;
+}
+
+bool FUnrealMCPActorQuery::ParseFilter(const TSharedPtr<FJsonObject>& Params, UWorld* World, FMCPActorFilter& OutFilter, FString& OutError)
+{
+    OutFilter = FMCPActorFilter();
+    if (!Params.IsValid())
+    {
+        return true;
+    }
+
+    FString ClassName;
+    if (Params->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
+    {
+        OutFilter.Class = ResolveActorClass(ClassName);
+        if (!OutFilter.Class)
+        {
+            OutError = FString::Printf(TEXT("Unknown actor class: %s"), *ClassName);
+            return false;
+        }
+    }
+
+    FString Tag;
+    if (Params->TryGetStringField(TEXT("tag"), Tag) && !Tag.IsEmpty())
+    {
+        OutFilter.Tag = FName(*Tag);
+    }
+
+    FString Folder;
+    if (Params->TryGetStringField(TEXT("folder"), Folder))
+    {
+        Folder.TrimStartAndEndInline();
+        while (Folder.RemoveFromEnd(TEXT("/")))
+        {
+        }
+        OutFilter.Folder = Folder;
+    }
+
+    FString LevelName;
+    if (Params->TryGetStringField(TEXT("level"), LevelName) && !LevelName.IsEmpty())
+    {
+        OutFilter.Level = ResolveLevel(World, LevelName);
+        if (!OutFilter.Level)
+        {
+            OutError = FString::Printf(TEXT("Level not loaded in the editor world: %s"), *LevelName);
+            return false;
+        }
+    }
+
+    Params->TryGetStringField(TEXT("label"), OutFilter.LabelPattern);
+    return true;
+}
+
+bool FUnrealMCPActorQuery::ParseFields(const TSharedPtr<FJsonObject>& Params, EMCPActorFields& OutFields, FString& OutError)
+{
+    OutFields = EMCPActorFields::Default;
+
+    const TArray<TSharedPtr<FJsonValue>>* FieldArray = nullptr;
+    if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("fields"), FieldArray))
+    {
+        return true;
+    }
+
+    OutFields = EMCPActorFields::None;
+    for (const TSharedPtr<FJsonValue>& Value : *FieldArray)
+    {
+        const FString FieldName = Value.IsValid() ? Value->AsString() : FString();
+        const FActorFieldName* Match = nullptr;
+        for (const FActorFieldName& Candidate : ActorFieldNames)
+        {
+            if (FieldName == Candidate.Name)
+            {
+                Match = &Candidate;
+                break;
+            }
+        }
+
+        if (!Match)
+        {
+            TArray<FString> ValidNames;
+            for (const FActorFieldName& Candidate : ActorFieldNames)
+            {
+                ValidNames.Add(Candidate.Name);
+            }
+            OutError = FString::Printf(TEXT("Unknown field '%s'. Valid fields: %s"), *FieldName, *FString::Join(ValidNames, TEXT(", ")));
+            return false;
+        }
+        OutFields |= Match->Field;
+    }
+    return true;
+}
+
+void FUnrealMCPActorQuery::ForEachActor(UWorld* World, const FMCPActorFilter& Filter, TFunctionRef<void(AActor*)> Visit)
+{
+    if (!World)
+    {
+        return;
+    }
+
+    if (Filter.Level)
+    {
+        for (AActor* Actor : Filter.Level->Actors)
+        {
+            if (IsValid(Actor) && Filter.Matches(Actor))
+            {
+                Visit(Actor);
+            }
+        }
+        return;
+    }
+
+    UClass* Class = Filter.Class ? Filter.Class : AActor::StaticClass();
+    for (TActorIterator<AActor> It(World, Class); It; ++It)
+    {
+        if (Filter.Matches(*It))
+        {
+            Visit(*It);
+        }
+    }
+}
+
+bool FUnrealMCPActorQuery::ParseLayout(const TSharedPtr<FJsonObject>& Params, FMCPActorLayout& OutLayout, FString& OutError)
+{
+    OutLayout = FMCPActorLayout();
+    if (!Params.IsValid())
+    {
+        return true;
+    }
+
+    FString Layout;
+    if (Params->TryGetStringField(TEXT("layout"), Layout) && !Layout.IsEmpty())
+    {
+        if (Layout == TEXT("columnar"))
+        {
+            OutLayout.Layout = EMCPActorLayout::Columnar;
+        }
+        else if (Layout != TEXT("rows"))
+        {
+            OutError = FString::Printf(TEXT("Unknown layout '%s'. Valid layouts: rows, columnar"), *Layout);
+            return false;
+        }
+    }
+
+    FString Encoding;
+    if (Params->TryGetStringField(TEXT("encoding"), Encoding) && !Encoding.IsEmpty())
+    {
+        if (Encoding == TEXT("array"))
+        {
+            OutLayout.Encoding = EMCPColumnEncoding::Array;
+        }
+        else if (Encoding != TEXT("base64"))
+        {
+            OutError = FString::Printf(TEXT("Unknown encoding '%s'. Valid encodings: base64, array"), *Encoding);
+            return false;
+        }
+    }
+    return true;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPActorQuery::ActorToJson(const AActor* Actor, EMCPActorFields Fields)
+{
+    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+    if (!Actor)
+    {
+        return ActorObject;
+    }
+
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Name))
+    {
+        ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Label))
+    {
+        ActorObject->SetStringField(TEXT("label"), Actor->GetActorLabel(false));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Class))
+    {
+        ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Path))
+    {
+        ActorObject->SetStringField(TEXT("path"), Actor->GetPathName());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Location))
+    {
+        ActorObject->SetArrayField(TEXT("location"), VectorToJsonArray(Actor->GetActorLocation()));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Rotation))
+    {
+        const FRotator Rotation = Actor->GetActorRotation();
+        ActorObject->SetArrayField(TEXT("rotation"), VectorToJsonArray(FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll)));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Scale))
+    {
+        ActorObject->SetArrayField(TEXT("scale"), VectorToJsonArray(Actor->GetActorScale3D()));
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Bounds))
+    {
+        const FBox Box = Actor->GetComponentsBoundingBox(true);
+        TSharedPtr<FJsonObject> BoundsObject = MakeShared<FJsonObject>();
+        const FVector Location = Actor->GetActorLocation();
+        BoundsObject->SetArrayField(TEXT("min"), VectorToJsonArray(Box.IsValid ? Box.Min : Location));
+        BoundsObject->SetArrayField(TEXT("max"), VectorToJsonArray(Box.IsValid ? Box.Max : Location));
+        ActorObject->SetObjectField(TEXT("bounds"), BoundsObject);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Folder))
+    {
+        ActorObject->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Level))
+    {
+        const ULevel* Level = Actor->GetLevel();
+        ActorObject->SetStringField(TEXT("level"), Level ? Level->GetOutermost()->GetName() : FString());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorFields::Tags))
+    {
+        TArray<TSharedPtr<FJsonValue>> TagArray;
+        for (const FName& Tag : Actor->Tags)
+        {
+            TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+        }
+        ActorObject->SetArrayField(TEXT("tags"), TagArray);
+    }
+    return ActorObject;
+}
+
+ULevel* FUnrealMCPActorQuery::ResolveLevel(UWorld* World, const FString& LevelName)
+{
+    if (!World)
+    {
+        return nullptr;
+    }
+    if (LevelName.Equals(TEXT("persistent"), ESearchCase::IgnoreCase))
+    {
+        return World->PersistentLevel;
+    }
+
+    for (ULevel* Level : World->GetLevels())
+    {
+        if (!Level)
+        {
+            continue;
+        }
+        const FString PackageName = Level->GetOutermost()->GetName();
+        if (PackageName.Equals(LevelName, ESearchCase::IgnoreCase) ||
+            FPackageName::GetShortName(PackageName).Equals(LevelName, ESearchCase::IgnoreCase))
+        {
+            return Level;
+        }
+    }
+    return nullptr;
+}
+
+UClass* FUnrealMCPActorQuery::ResolveActorClass(const FString& ClassName)
+{
+    // "StaticMeshActor", "AStaticMeshActor", "BP_Door" (loaded Blueprint classes) or a class path
+    return FUnrealMCPClassIndex::Get().FindClass(ClassName, AActor::StaticClass());
+}
+
+const TSet<FString>& FUnrealMCPActorQuery::GetQueryParamKeys()
+{
+    static const TSet<FString> Keys = {TEXT("class"), TEXT("tag"), TEXT("folder"), TEXT("level"), TEXT("label"), TEXT("fields"),
+        TEXT("layout"), TEXT("encoding")};
+    return Keys;
+}
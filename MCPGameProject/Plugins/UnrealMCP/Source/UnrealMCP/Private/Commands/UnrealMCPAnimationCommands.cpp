@@ -1,6 +1,7 @@
 #include "Commands/UnrealMCPAnimationCommands.h"
 
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPReadLoads.h"
 #include "Animation/AnimCompositeBase.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimNotifies/AnimNotify.h"
@@ -71,9 +72,11 @@ UAnimMontage* LoadMontageAsset(const FString& AssetPath, FString& OutResolvedAss
 
     for (const FString& CandidatePath : CandidatePaths)
     {
+        const bool bWasResident = FUnrealMCPReadLoads::IsResident(CandidatePath);
         if (UAnimMontage* Montage = LoadObject<UAnimMontage>(nullptr, *CandidatePath))
         {
             OutResolvedAssetPath = Montage->GetPathName();
+            FUnrealMCPReadLoads::Get().TrackRead(Montage, bWasResident);
             return Montage;
         }
 
@@ -82,6 +85,7 @@ UAnimMontage* LoadMontageAsset(const FString& AssetPath, FString& OutResolvedAss
             if (UAnimMontage* Montage = Cast<UAnimMontage>(LoadedAsset))
             {
                 OutResolvedAssetPath = Montage->GetPathName();
+                FUnrealMCPReadLoads::Get().TrackRead(Montage, bWasResident);
                 return Montage;
             }
         }
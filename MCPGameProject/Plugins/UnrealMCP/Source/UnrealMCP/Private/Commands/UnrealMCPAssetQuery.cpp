@@ -0,0 +1,454 @@
+#include "Commands/UnrealMCPAssetQuery.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Algo/BinarySearch.h"
+#include "AssetRegistry/ARFilter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+// Bounds on the result cache: a few browsing sessions' worth of queries, and at most this many
+// cached FAssetData in total so a handful of whole-project queries cannot pin hundreds of MB
+const int32 MaxCachedQueries = 16;
+const int32 MaxCachedEntries = 500000;
+
+IAssetRegistry& GetAssetRegistry()
+{
+    return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+}
+
+bool ParseTagOp(const FString& Text, FMCPAssetTagPredicate::EOp& OutOp)
+{
+    using EOp = FMCPAssetTagPredicate::EOp;
+    static const TMap<FString, EOp> Ops = {
+        {TEXT("eq"), EOp::Equal},
+        {TEXT("ne"), EOp::NotEqual},
+        {TEXT("contains"), EOp::Contains},
+        {TEXT("glob"), EOp::Glob},
+        {TEXT("exists"), EOp::Exists},
+        {TEXT("missing"), EOp::Missing},
+        {TEXT("lt"), EOp::Less},
+        {TEXT("le"), EOp::LessEqual},
+        {TEXT("gt"), EOp::Greater},
+        {TEXT("ge"), EOp::GreaterEqual},
+    };
+    if (const EOp* Op = Ops.Find(Text.ToLower()))
+    {
+        OutOp = *Op;
+        return true;
+    }
+    return false;
+}
+
+// Numeric when both sides parse as numbers, otherwise case-insensitive text order
+int32 CompareTagValues(const FString& Lhs, const FString& Rhs)
+{
+    if (Lhs.IsNumeric() && Rhs.IsNumeric())
+    {
+        const double L = FCString::Atod(*Lhs);
+        const double R = FCString::Atod(*Rhs);
+        return L < R ? -1 : (L > R ? 1 : 0);
+    }
+    return Lhs.Compare(Rhs, ESearchCase::IgnoreCase);
+}
+
+void ReadStringOrArray(const TSharedPtr<FJsonObject>& Params, const TCHAR* ArrayField, const TCHAR* SingleField, TArray<FString>& Out)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (Params->TryGetArrayField(ArrayField, Values))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            if (Value.IsValid() && !Value->AsString().IsEmpty())
+            {
+                Out.Add(Value->AsString());
+            }
+        }
+    }
+    FString Single;
+    if (Params->TryGetStringField(SingleField, Single) && !Single.IsEmpty())
+    {
+        Out.Add(Single);
+    }
+}
+
+FString MakeSortKey(const FAssetData& Asset, EMCPAssetSort Sort)
+{
+    const FString ObjectPath = Asset.GetObjectPathString();
+    switch (Sort)
+    {
+    case EMCPAssetSort::Path:
+        return ObjectPath;
+    case EMCPAssetSort::Class:
+        return Asset.AssetClassPath.ToString() + TEXT("|") + ObjectPath;
+    case EMCPAssetSort::Name:
+    default:
+        return Asset.AssetName.ToString().ToLower() + TEXT("|") + ObjectPath;
+    }
+}
+}
+
+bool FMCPAssetTagPredicate::Matches(const FAssetData& Asset) const
+{
+    FString TagValue;
+    const bool bHasTag = Asset.GetTagValue(Key, TagValue);
+    switch (Op)
+    {
+    case EOp::Exists:
+        return bHasTag;
+    case EOp::Missing:
+        return !bHasTag;
+    case EOp::NotEqual:
+        return !bHasTag || !TagValue.Equals(Value, ESearchCase::IgnoreCase);
+    default:
+        break;
+    }
+
+    if (!bHasTag)
+    {
+        return false;
+    }
+
+    switch (Op)
+    {
+    case EOp::Equal:
+        return TagValue.Equals(Value, ESearchCase::IgnoreCase);
+    case EOp::Contains:
+        return TagValue.Contains(Value, ESearchCase::IgnoreCase);
+    case EOp::Glob:
+        return TagValue.MatchesWildcard(Value, ESearchCase::IgnoreCase);
+    case EOp::Less:
+        return CompareTagValues(TagValue, Value) < 0;
+    case EOp::LessEqual:
+        return CompareTagValues(TagValue, Value) <= 0;
+    case EOp::Greater:
+        return CompareTagValues(TagValue, Value) > 0;
+    case EOp::GreaterEqual:
+        return CompareTagValues(TagValue, Value) >= 0;
+    default:
+        return false;
+    }
+}
+
+FString FMCPAssetQuery::GetCacheKey() const
+{
+    TStringBuilder<512> Key;
+    for (const FName& Path : PackagePaths)
+    {
+        Key << TEXT("p:") << Path << TEXT(";");
+    }
+    for (const FTopLevelAssetPath& ClassPath : ClassPaths)
+    {
+        Key << TEXT("c:") << ClassPath.ToString() << TEXT(";");
+    }
+    Key << TEXT("rp:") << (bRecursivePaths ? 1 : 0) << TEXT(";rc:") << (bRecursiveClasses ? 1 : 0)
+        << TEXT(";disk:") << (bOnDiskOnly ? 1 : 0) << TEXT(";n:") << NamePattern.ToLower();
+    for (const FMCPAssetTagPredicate& Tag : Tags)
+    {
+        Key << TEXT(";t:") << Tag.Key << TEXT(",") << static_cast<int32>(Tag.Op) << TEXT(",") << Tag.Value;
+    }
+    Key << TEXT(";s:") << static_cast<int32>(Sort) << (bDescending ? TEXT("d") : TEXT("a"));
+    return FString(Key.ToView());
+}
+
+int32 FMCPAssetQueryResult::IndexAfter(const FString& Cursor) const
+{
+    if (Cursor.IsEmpty())
+    {
+        return 0;
+    }
+
+    if (bDescending)
+    {
+        return Algo::UpperBoundBy(Entries, Cursor, &FEntry::Key,
+            [](const FString& A, const FString& B) { return A.Compare(B) > 0; });
+    }
+    return Algo::UpperBoundBy(Entries, Cursor, &FEntry::Key,
+        [](const FString& A, const FString& B) { return A.Compare(B) < 0; });
+}
+
+FUnrealMCPAssetQuery& FUnrealMCPAssetQuery::Get()
+{
+    static FUnrealMCPAssetQuery Instance;
+    return Instance;
+}
+
+FUnrealMCPAssetQuery::FUnrealMCPAssetQuery()
+    : CachedEntryCount(0)
+    , Generation(0)
+    , bInitialized(false)
+{
+}
+
+void FUnrealMCPAssetQuery::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = GetAssetRegistry();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FUnrealMCPAssetQuery::HandleAssetChanged);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FUnrealMCPAssetQuery::HandleAssetChanged);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FUnrealMCPAssetQuery::HandleAssetRenamed);
+    // Tag values change on save without an add/remove
+    AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FUnrealMCPAssetQuery::HandleAssetChanged);
+    FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FUnrealMCPAssetQuery::Invalidate);
+
+    bInitialized = true;
+}
+
+void FUnrealMCPAssetQuery::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+        AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+    }
+
+    Invalidate();
+    ClassPathCache.Reset();
+    bInitialized = false;
+}
+
+bool FUnrealMCPAssetQuery::ResolveClassPath(const FString& ClassName, FTopLevelAssetPath& OutClassPath)
+{
+    if (const FTopLevelAssetPath* Cached = ClassPathCache.Find(ClassName))
+    {
+        OutClassPath = *Cached;
+        return true;
+    }
+
+    FTopLevelAssetPath Resolved;
+    if (ClassName.StartsWith(TEXT("/")) && !ClassName.StartsWith(TEXT("/Script/")))
+    {
+        // Blueprint class paths are taken as-is so they resolve without loading the blueprint
+        Resolved = FTopLevelAssetPath(ClassName);
+    }
+    else if (UClass* Class = FUnrealMCPClassIndex::Get().FindClass(ClassName))
+    {
+        Resolved = Class->GetClassPathName();
+    }
+
+    if (!Resolved.IsValid())
+    {
+        return false;
+    }
+
+    ClassPathCache.Add(ClassName, Resolved);
+    OutClassPath = Resolved;
+    return true;
+}
+
+const TSet<FString>& FUnrealMCPAssetQuery::GetQueryParamKeys()
+{
+    static const TSet<FString> Keys = {
+        TEXT("paths"), TEXT("path"), TEXT("recursive"),
+        TEXT("classes"), TEXT("class"), TEXT("recursive_classes"),
+        TEXT("name"), TEXT("tags"), TEXT("sort"), TEXT("descending"), TEXT("on_disk_only"),
+    };
+    return Keys;
+}
+
+bool FUnrealMCPAssetQuery::ParseQuery(const TSharedPtr<FJsonObject>& Params, FMCPAssetQuery& OutQuery, FString& OutError)
+{
+    TArray<FString> Paths;
+    ReadStringOrArray(Params, TEXT("paths"), TEXT("path"), Paths);
+    if (Paths.Num() == 0)
+    {
+        Paths.Add(TEXT("/Game"));
+    }
+    for (FString& Path : Paths)
+    {
+        Path.RemoveFromEnd(TEXT("/"));
+        OutQuery.PackagePaths.AddUnique(FName(*Path));
+    }
+    Params->TryGetBoolField(TEXT("recursive"), OutQuery.bRecursivePaths);
+
+    TArray<FString> ClassNames;
+    ReadStringOrArray(Params, TEXT("classes"), TEXT("class"), ClassNames);
+    for (const FString& ClassName : ClassNames)
+    {
+        FTopLevelAssetPath ClassPath;
+        if (!ResolveClassPath(ClassName, ClassPath))
+        {
+            OutError = FString::Printf(TEXT("Class not found: %s (use a short native class name or a full class path)"), *ClassName);
+            return false;
+        }
+        OutQuery.ClassPaths.AddUnique(ClassPath);
+    }
+    Params->TryGetBoolField(TEXT("recursive_classes"), OutQuery.bRecursiveClasses);
+    Params->TryGetBoolField(TEXT("on_disk_only"), OutQuery.bOnDiskOnly);
+    Params->TryGetStringField(TEXT("name"), OutQuery.NamePattern);
+
+    const TArray<TSharedPtr<FJsonValue>>* TagValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("tags"), TagValues))
+    {
+        for (const TSharedPtr<FJsonValue>& TagValue : *TagValues)
+        {
+            const TSharedPtr<FJsonObject>* TagObj = nullptr;
+            FString Key;
+            if (!TagValue.IsValid() || !TagValue->TryGetObject(TagObj) || !(*TagObj)->TryGetStringField(TEXT("key"), Key) || Key.IsEmpty())
+            {
+                OutError = TEXT("Each 'tags' entry must be an object with 'key' (and optionally 'op', 'value')");
+                return false;
+            }
+
+            FMCPAssetTagPredicate& Predicate = OutQuery.Tags.AddDefaulted_GetRef();
+            Predicate.Key = FName(*Key);
+            FString OpText;
+            if ((*TagObj)->TryGetStringField(TEXT("op"), OpText) && !ParseTagOp(OpText, Predicate.Op))
+            {
+                OutError = FString::Printf(TEXT("Unknown tag op '%s' (eq, ne, contains, glob, exists, missing, lt, le, gt, ge)"), *OpText);
+                return false;
+            }
+            // Numbers and bools are accepted for convenience and compared as the registry's text
+            const TSharedPtr<FJsonValue> Value = (*TagObj)->TryGetField(TEXT("value"));
+            if (Value.IsValid())
+            {
+                Predicate.Value = Value->AsString();
+            }
+        }
+    }
+
+    FString Sort;
+    if (Params->TryGetStringField(TEXT("sort"), Sort) && !Sort.IsEmpty())
+    {
+        if (Sort == TEXT("name"))
+        {
+            OutQuery.Sort = EMCPAssetSort::Name;
+        }
+        else if (Sort == TEXT("path"))
+        {
+            OutQuery.Sort = EMCPAssetSort::Path;
+        }
+        else if (Sort == TEXT("class"))
+        {
+            OutQuery.Sort = EMCPAssetSort::Class;
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unknown sort '%s' (name, path, class)"), *Sort);
+            return false;
+        }
+    }
+    Params->TryGetBoolField(TEXT("descending"), OutQuery.bDescending);
+    return true;
+}
+
+TSharedRef<const FMCPAssetQueryResult> FUnrealMCPAssetQuery::Run(const FMCPAssetQuery& Query, bool bUseCache, bool& bOutCacheHit)
+{
+    bOutCacheHit = false;
+    const FString CacheKey = Query.GetCacheKey();
+    if (bUseCache)
+    {
+        if (const TSharedRef<const FMCPAssetQueryResult>* Cached = ResultCache.Find(CacheKey))
+        {
+            ResultLru.Remove(CacheKey);
+            ResultLru.Add(CacheKey);
+            bOutCacheHit = true;
+            return *Cached;
+        }
+    }
+
+    FARFilter Filter;
+    Filter.PackagePaths = Query.PackagePaths;
+    Filter.bRecursivePaths = Query.bRecursivePaths;
+    Filter.ClassPaths = Query.ClassPaths;
+    Filter.bRecursiveClasses = Query.bRecursiveClasses && Query.ClassPaths.Num() > 0;
+    Filter.bIncludeOnlyOnDiskAssets = Query.bOnDiskOnly;
+
+    TArray<FAssetData> Assets;
+    GetAssetRegistry().GetAssets(Filter, Assets);
+
+    TSharedRef<FMCPAssetQueryResult> Result = MakeShared<FMCPAssetQueryResult>();
+    Result->bDescending = Query.bDescending;
+    Result->Generation = Generation;
+    Result->Entries.Reserve(Assets.Num());
+    for (FAssetData& Asset : Assets)
+    {
+        if (!Query.NamePattern.IsEmpty() && !Asset.AssetName.ToString().MatchesWildcard(Query.NamePattern, ESearchCase::IgnoreCase))
+        {
+            continue;
+        }
+        if (!Query.Tags.ContainsByPredicate([&Asset](const FMCPAssetTagPredicate& Tag) { return !Tag.Matches(Asset); }))
+        {
+            FMCPAssetQueryResult::FEntry& Entry = Result->Entries.AddDefaulted_GetRef();
+            Entry.Key = MakeSortKey(Asset, Query.Sort);
+            Entry.Asset = MoveTemp(Asset);
+        }
+    }
+
+    if (Query.bDescending)
+    {
+        Result->Entries.Sort([](const FMCPAssetQueryResult::FEntry& A, const FMCPAssetQueryResult::FEntry& B) { return A.Key.Compare(B.Key) > 0; });
+    }
+    else
+    {
+        Result->Entries.Sort([](const FMCPAssetQueryResult::FEntry& A, const FMCPAssetQueryResult::FEntry& B) { return A.Key.Compare(B.Key) < 0; });
+    }
+
+    // A partial scan must not be served later as the full answer
+    if (bUseCache && !IsRegistryLoading() && Result->Entries.Num() <= MaxCachedEntries)
+    {
+        if (const TSharedRef<const FMCPAssetQueryResult>* Stale = ResultCache.Find(CacheKey))
+        {
+            CachedEntryCount -= (*Stale)->Entries.Num();
+            ResultLru.Remove(CacheKey);
+        }
+        while (ResultLru.Num() > 0 && (ResultLru.Num() >= MaxCachedQueries || CachedEntryCount + Result->Entries.Num() > MaxCachedEntries))
+        {
+            const FString Evicted = ResultLru[0];
+            ResultLru.RemoveAt(0);
+            CachedEntryCount -= ResultCache.FindChecked(Evicted)->Entries.Num();
+            ResultCache.Remove(Evicted);
+        }
+        ResultCache.Add(CacheKey, Result);
+        ResultLru.Add(CacheKey);
+        CachedEntryCount += Result->Entries.Num();
+    }
+    return Result;
+}
+
+bool FUnrealMCPAssetQuery::IsRegistryLoading()
+{
+    return GetAssetRegistry().IsLoadingAssets();
+}
+
+void FUnrealMCPAssetQuery::Invalidate()
+{
+    ++Generation;
+    ResultCache.Reset();
+    ResultLru.Reset();
+    CachedEntryCount = 0;
+}
+
+void FUnrealMCPAssetQuery::HandleAssetChanged(const FAssetData& /*AssetData*/)
+{
+    // During the initial scan nothing is cached yet, so there is nothing to drop per asset
+    if (ResultCache.Num() > 0)
+    {
+        Invalidate();
+    }
+    else
+    {
+        ++Generation;
+    }
+}
+
+void FUnrealMCPAssetQuery::HandleAssetRenamed(const FAssetData& AssetData, const FString& /*OldObjectPath*/)
+{
+    HandleAssetChanged(AssetData);
+}
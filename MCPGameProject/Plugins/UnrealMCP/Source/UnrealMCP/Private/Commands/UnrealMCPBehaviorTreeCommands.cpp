@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPBehaviorTreeCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPReadLoads.h"
 #include "EditorAssetLibrary.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BTCompositeNode.h"
@@ -39,12 +40,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBehaviorTreeCommands::HandleGetBehaviorTreeInf
     }
 
     // --- Load the asset ---
+    const bool bWasResident = FUnrealMCPReadLoads::IsResident(AssetPath);
     UObject* LoadedObj = UEditorAssetLibrary::LoadAsset(AssetPath);
     if (!LoadedObj)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
             FString::Printf(TEXT("Could not load asset at path: %s"), *AssetPath));
     }
+    FUnrealMCPReadLoads::Get().TrackRead(LoadedObj, bWasResident);
 
     UBehaviorTree* BT = Cast<UBehaviorTree>(LoadedObj);
     if (!BT)
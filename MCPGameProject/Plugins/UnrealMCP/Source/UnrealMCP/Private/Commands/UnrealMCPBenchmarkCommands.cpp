@@ -0,0 +1,708 @@
+#include "Commands/UnrealMCPBenchmarkCommands.h"
+
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "ScopedTransaction.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "GameFramework/Actor.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/DirectionalLight.h"
+#include "Engine/PointLight.h"
+#include "Engine/SpotLight.h"
+#include "Camera/CameraActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Factories/BlueprintFactory.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "WidgetBlueprint.h"
+#include "WidgetBlueprintFactory.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/HorizontalBox.h"
+#include "Components/Image.h"
+#include "Components/Overlay.h"
+#include "Components/Spacer.h"
+#include "Components/TextBlock.h"
+#include "Components/VerticalBox.h"
+
+namespace
+{
+// Hard caps so a typo in a perf script cannot hang the editor for minutes.
+const int32 MaxBenchmarkActors = 1000000;
+const int32 MaxBenchmarkBlueprintNodes = 20000;
+const int32 MaxBenchmarkWidgets = 200000;
+
+// Every Nth generated blueprint node is an impure PrintString on the BeginPlay exec chain;
+// the rest are pure math nodes wired into a random DAG.
+const int32 BenchmarkImpureNodeInterval = 8;
+// Pure nodes only pull inputs from this many preceding nodes so wires stay local in the graph view.
+const int32 BenchmarkLinkWindow = 16;
+const int32 BenchmarkNodesPerColumn = 16;
+
+enum class EBenchmarkDistribution : uint8
+{
+    Grid,
+    Random,
+    Sphere
+};
+
+bool ParseBenchmarkDistribution(const FString& Name, EBenchmarkDistribution& OutDistribution)
+{
+    if (Name.Equals(TEXT("grid"), ESearchCase::IgnoreCase))
+    {
+        OutDistribution = EBenchmarkDistribution::Grid;
+        return true;
+    }
+    if (Name.Equals(TEXT("random"), ESearchCase::IgnoreCase))
+    {
+        OutDistribution = EBenchmarkDistribution::Random;
+        return true;
+    }
+    if (Name.Equals(TEXT("sphere"), ESearchCase::IgnoreCase))
+    {
+        OutDistribution = EBenchmarkDistribution::Sphere;
+        return true;
+    }
+    return false;
+}
+
+FVector ComputeBenchmarkLocation(
+    EBenchmarkDistribution Distribution,
+    int32 Index,
+    int32 Count,
+    const FVector& Origin,
+    double Spacing,
+    double Extent,
+    FRandomStream& Stream)
+{
+    switch (Distribution)
+    {
+    case EBenchmarkDistribution::Grid:
+    {
+        const int32 Columns = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<double>(Count))));
+        const double HalfSpan = (Columns - 1) * Spacing * 0.5;
+        return Origin + FVector((Index % Columns) * Spacing - HalfSpan, (Index / Columns) * Spacing - HalfSpan, 0.0);
+    }
+    case EBenchmarkDistribution::Random:
+        return Origin + FVector(
+            Stream.FRandRange(-Extent, Extent),
+            Stream.FRandRange(-Extent, Extent),
+            Stream.FRandRange(-Extent, Extent));
+    case EBenchmarkDistribution::Sphere:
+    default:
+        // Cube-root radius keeps the points uniform over the ball's volume instead of clustering at the centre.
+        return Origin + Stream.GetUnitVector() * (Extent * FMath::Pow(Stream.GetFraction(), 1.0f / 3.0f));
+    }
+}
+
+UClass* ResolveBenchmarkActorClass(const FString& ClassName)
+{
+    if (ClassName.IsEmpty() || ClassName == TEXT("StaticMeshActor"))
+    {
+        return AStaticMeshActor::StaticClass();
+    }
+    if (ClassName == TEXT("PointLight"))
+    {
+        return APointLight::StaticClass();
+    }
+    if (ClassName == TEXT("SpotLight"))
+    {
+        return ASpotLight::StaticClass();
+    }
+    if (ClassName == TEXT("DirectionalLight"))
+    {
+        return ADirectionalLight::StaticClass();
+    }
+    if (ClassName == TEXT("CameraActor"))
+    {
+        return ACameraActor::StaticClass();
+    }
+    if (ClassName == TEXT("Actor"))
+    {
+        return AActor::StaticClass();
+    }
+
+    return FUnrealMCPClassIndex::Get().FindClass(ClassName, AActor::StaticClass());
+}
+
+FString GetBenchmarkPackagePath(const TSharedPtr<FJsonObject>& Params)
+{
+    FString PackagePath = TEXT("/Game/Benchmark");
+    Params->TryGetStringField(TEXT("path"), PackagePath);
+    PackagePath.TrimStartAndEndInline();
+    if (PackagePath.IsEmpty())
+    {
+        PackagePath = TEXT("/Game/Benchmark");
+    }
+    if (!PackagePath.StartsWith(TEXT("/")))
+    {
+        PackagePath = TEXT("/") + PackagePath;
+    }
+    if (PackagePath.EndsWith(TEXT("/")))
+    {
+        PackagePath.LeftChopInline(1, EAllowShrinking::No);
+    }
+    return PackagePath;
+}
+
+double GetElapsedMs(double StartSeconds)
+{
+    return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+}
+
+/** Graph nodes are added without per-node notifications; the caller notifies once when the graph is complete. */
+UK2Node_CallFunction* AddBenchmarkCallNode(UEdGraph* Graph, UFunction* Function, int32 PosX, int32 PosY)
+{
+    UK2Node_CallFunction* FunctionNode = NewObject<UK2Node_CallFunction>(Graph);
+    FunctionNode->SetFromFunction(Function);
+    FunctionNode->NodePosX = PosX;
+    FunctionNode->NodePosY = PosY;
+    Graph->AddNode(FunctionNode, false, false);
+    FunctionNode->CreateNewGuid();
+    FunctionNode->PostPlacedNewNode();
+    FunctionNode->AllocateDefaultPins();
+    return FunctionNode;
+}
+
+int64 CountWidgetTreeNodes(int32 Depth, int32 Fanout)
+{
+    int64 Total = 1;
+    int64 LevelCount = 1;
+    for (int32 Level = 0; Level < Depth; ++Level)
+    {
+        LevelCount *= Fanout;
+        Total += LevelCount;
+        if (Total > MaxBenchmarkWidgets)
+        {
+            break;
+        }
+    }
+    return Total;
+}
+}
+
+FUnrealMCPBenchmarkCommands::FUnrealMCPBenchmarkCommands()
+{
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBenchmarkCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("generate_benchmark_actors"))
+    {
+        return HandleGenerateBenchmarkActors(Params);
+    }
+    else if (CommandType == TEXT("generate_benchmark_blueprint"))
+    {
+        return HandleGenerateBenchmarkBlueprint(Params);
+    }
+    else if (CommandType == TEXT("generate_benchmark_widget_tree"))
+    {
+        return HandleGenerateBenchmarkWidgetTree(Params);
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown benchmark command: %s"), *CommandType));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBenchmarkCommands::HandleGenerateBenchmarkActors(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+        {TEXT("count"), TEXT("class"), TEXT("distribution"), TEXT("seed"), TEXT("origin"), TEXT("spacing"),
+         TEXT("extent"), TEXT("random_yaw"), TEXT("static_mesh"), TEXT("name_prefix"), TEXT("folder")}))
+    {
+        return Err;
+    }
+
+    int32 Count = 0;
+    if (!Params->TryGetNumberField(TEXT("count"), Count))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'count' parameter"));
+    }
+    if (Count <= 0 || Count > MaxBenchmarkActors)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("'count' must be between 1 and %d"), MaxBenchmarkActors));
+    }
+
+    FString ClassName = TEXT("StaticMeshActor");
+    Params->TryGetStringField(TEXT("class"), ClassName);
+    UClass* ActorClass = ResolveBenchmarkActorClass(ClassName);
+    if (!ActorClass)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unable to find or load actor class: %s"), *ClassName));
+    }
+
+    FString DistributionName = TEXT("grid");
+    Params->TryGetStringField(TEXT("distribution"), DistributionName);
+    EBenchmarkDistribution Distribution;
+    if (!ParseBenchmarkDistribution(DistributionName, Distribution))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Invalid distribution '%s'. Must be grid, random, or sphere."), *DistributionName));
+    }
+
+    int32 Seed = 0;
+    Params->TryGetNumberField(TEXT("seed"), Seed);
+    double Spacing = 200.0;
+    Params->TryGetNumberField(TEXT("spacing"), Spacing);
+    double Extent = 10000.0;
+    Params->TryGetNumberField(TEXT("extent"), Extent);
+    bool bRandomYaw = false;
+    Params->TryGetBoolField(TEXT("random_yaw"), bRandomYaw);
+    FVector Origin = FVector::ZeroVector;
+    if (Params->HasField(TEXT("origin")))
+    {
+        Origin = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("origin"));
+    }
+
+    FString NamePrefix = TEXT("Bench");
+    Params->TryGetStringField(TEXT("name_prefix"), NamePrefix);
+    FString Folder = TEXT("Benchmark");
+    Params->TryGetStringField(TEXT("folder"), Folder);
+
+    UStaticMesh* StaticMesh = nullptr;
+    FString StaticMeshPath;
+    if (Params->TryGetStringField(TEXT("static_mesh"), StaticMeshPath) && !StaticMeshPath.IsEmpty())
+    {
+        StaticMesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(StaticMeshPath));
+        if (!StaticMesh)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Could not load static mesh: %s"), *StaticMeshPath));
+        }
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    FRandomStream Stream(Seed);
+    const FName FolderPath = Folder.IsEmpty() ? NAME_None : FName(*Folder);
+
+    int32 SpawnedCount = 0;
+    int32 FailedCount = 0;
+    FString FirstActorName;
+    FString LastActorName;
+    {
+        // One undo entry for the whole fixture.
+        FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Generate %d Benchmark Actors"), Count)));
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transactional;
+        // Re-running with the same prefix must not trip the fatal duplicate-name check.
+        SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const FVector Location = ComputeBenchmarkLocation(Distribution, Index, Count, Origin, Spacing, Extent, Stream);
+            const FRotator Rotation(0.0f, bRandomYaw ? Stream.FRandRange(0.0f, 360.0f) : 0.0f, 0.0f);
+
+            SpawnParams.Name = FName(*NamePrefix, NAME_EXTERNAL_TO_INTERNAL(Index));
+            AActor* NewActor = World->SpawnActor(ActorClass, &Location, &Rotation, SpawnParams);
+            if (!NewActor)
+            {
+                ++FailedCount;
+                continue;
+            }
+
+            if (StaticMesh)
+            {
+                if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(NewActor))
+                {
+                    MeshActor->GetStaticMeshComponent()->SetStaticMesh(StaticMesh);
+                }
+            }
+            if (!FolderPath.IsNone())
+            {
+                NewActor->SetFolderPath(FolderPath);
+            }
+
+            if (SpawnedCount == 0)
+            {
+                FirstActorName = NewActor->GetName();
+            }
+            LastActorName = NewActor->GetName();
+            ++SpawnedCount;
+        }
+    }
+
+    GEditor->RedrawLevelEditingViewports();
+
+    const double ElapsedMs = GetElapsedMs(StartSeconds);
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBenchmarkCommands: Spawned %d/%d '%s' actors in %.1f ms"),
+        SpawnedCount, Count, *ActorClass->GetName(), ElapsedMs);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), FailedCount == 0);
+    ResultObj->SetNumberField(TEXT("spawned_count"), SpawnedCount);
+    ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResultObj->SetStringField(TEXT("class"), ActorClass->GetPathName());
+    ResultObj->SetStringField(TEXT("distribution"), DistributionName.ToLower());
+    ResultObj->SetNumberField(TEXT("seed"), Seed);
+    ResultObj->SetStringField(TEXT("folder"), Folder);
+    ResultObj->SetStringField(TEXT("first_actor"), FirstActorName);
+    ResultObj->SetStringField(TEXT("last_actor"), LastActorName);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), ElapsedMs);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBenchmarkCommands::HandleGenerateBenchmarkBlueprint(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+        {TEXT("name"), TEXT("path"), TEXT("node_count"), TEXT("seed"), TEXT("link_probability"),
+         TEXT("compile"), TEXT("save")}))
+    {
+        return Err;
+    }
+
+    FString AssetName;
+    if (!Params->TryGetStringField(TEXT("name"), AssetName) || AssetName.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    int32 NodeCount = 0;
+    if (!Params->TryGetNumberField(TEXT("node_count"), NodeCount))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'node_count' parameter"));
+    }
+    if (NodeCount <= 0 || NodeCount > MaxBenchmarkBlueprintNodes)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("'node_count' must be between 1 and %d"), MaxBenchmarkBlueprintNodes));
+    }
+
+    int32 Seed = 0;
+    Params->TryGetNumberField(TEXT("seed"), Seed);
+    double LinkProbability = 0.5;
+    Params->TryGetNumberField(TEXT("link_probability"), LinkProbability);
+    LinkProbability = FMath::Clamp(LinkProbability, 0.0, 1.0);
+    bool bCompile = true;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+    bool bSave = false;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
+    const FString FullPath = GetBenchmarkPackagePath(Params) + TEXT("/") + AssetName;
+    if (UEditorAssetLibrary::DoesAssetExist(FullPath))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint already exists: %s"), *FullPath));
+    }
+
+    TArray<UFunction*> PureFunctions;
+    for (const TCHAR* FunctionName : {TEXT("Add_DoubleDouble"), TEXT("Subtract_DoubleDouble"), TEXT("Multiply_DoubleDouble"), TEXT("FMax"), TEXT("FMin")})
+    {
+        if (UFunction* Function = UKismetMathLibrary::StaticClass()->FindFunctionByName(FunctionName))
+        {
+            PureFunctions.Add(Function);
+        }
+    }
+    UFunction* PrintFunction = UKismetSystemLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+    if (PureFunctions.Num() == 0 || !PrintFunction)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to resolve Kismet library functions for graph generation"));
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    UBlueprintFactory* Factory = NewObject<UBlueprintFactory>();
+    Factory->ParentClass = AActor::StaticClass();
+    UPackage* Package = CreatePackage(*FullPath);
+    UBlueprint* Blueprint = Cast<UBlueprint>(Factory->FactoryCreateNew(UBlueprint::StaticClass(), Package, *AssetName, RF_Standalone | RF_Public, nullptr, GWarn));
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create blueprint"));
+    }
+    FAssetRegistryModule::AssetCreated(Blueprint);
+
+    UEdGraph* EventGraph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
+    UK2Node_Event* BeginPlayNode = FUnrealMCPCommonUtils::CreateEventNode(EventGraph, TEXT("ReceiveBeginPlay"), FVector2D(-400.0, 0.0));
+    if (!EventGraph || !BeginPlayNode)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to prepare BeginPlay in the generated blueprint"));
+    }
+    // The factory places BeginPlay as a disabled "ghost" node; it becomes the head of the exec chain.
+    BeginPlayNode->SetEnabledState(ENodeEnabledState::Enabled, false);
+
+    FRandomStream Stream(Seed);
+    TArray<UK2Node_CallFunction*> PureNodes;
+    PureNodes.Reserve(NodeCount);
+    UEdGraphPin* LastThenPin = BeginPlayNode->FindPin(UEdGraphSchema_K2::PN_Then);
+    int32 DataLinkCount = 0;
+    int32 ExecNodeCount = 0;
+
+    for (int32 Index = 0; Index < NodeCount; ++Index)
+    {
+        const int32 PosX = (Index / BenchmarkNodesPerColumn) * 320;
+        const int32 PosY = (Index % BenchmarkNodesPerColumn) * 160;
+
+        if (Index % BenchmarkImpureNodeInterval == BenchmarkImpureNodeInterval - 1)
+        {
+            UK2Node_CallFunction* PrintNode = AddBenchmarkCallNode(EventGraph, PrintFunction, PosX, PosY);
+            if (UEdGraphPin* InStringPin = PrintNode->FindPin(TEXT("InString")))
+            {
+                InStringPin->DefaultValue = FString::Printf(TEXT("Bench %d"), Index);
+            }
+            if (UEdGraphPin* ExecPin = PrintNode->GetExecPin())
+            {
+                if (LastThenPin)
+                {
+                    LastThenPin->MakeLinkTo(ExecPin);
+                }
+            }
+            LastThenPin = PrintNode->GetThenPin();
+            ++ExecNodeCount;
+            continue;
+        }
+
+        UK2Node_CallFunction* MathNode = AddBenchmarkCallNode(EventGraph, PureFunctions[Stream.RandHelper(PureFunctions.Num())], PosX, PosY);
+        for (const TCHAR* InputName : {TEXT("A"), TEXT("B")})
+        {
+            UEdGraphPin* InputPin = MathNode->FindPin(InputName);
+            if (!InputPin)
+            {
+                continue;
+            }
+
+            // Only link to earlier nodes so the generated data graph is always acyclic.
+            if (PureNodes.Num() > 0 && Stream.GetFraction() < LinkProbability)
+            {
+                const int32 WindowStart = FMath::Max(0, PureNodes.Num() - BenchmarkLinkWindow);
+                UK2Node_CallFunction* SourceNode = PureNodes[Stream.RandRange(WindowStart, PureNodes.Num() - 1)];
+                if (UEdGraphPin* ReturnPin = SourceNode->FindPin(UEdGraphSchema_K2::PN_ReturnValue))
+                {
+                    ReturnPin->MakeLinkTo(InputPin);
+                    ++DataLinkCount;
+                    continue;
+                }
+            }
+            InputPin->DefaultValue = FString::SanitizeFloat(Stream.FRandRange(-100.0f, 100.0f));
+        }
+        PureNodes.Add(MathNode);
+    }
+
+    EventGraph->NotifyGraphChanged();
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+
+    const double BuildMs = GetElapsedMs(StartSeconds);
+    double CompileMs = 0.0;
+    if (bCompile)
+    {
+        const double CompileStartSeconds = FPlatformTime::Seconds();
+        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        CompileMs = GetElapsedMs(CompileStartSeconds);
+    }
+    Blueprint->MarkPackageDirty();
+    if (bSave)
+    {
+        UEditorAssetLibrary::SaveAsset(FullPath, false);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("blueprint_path"), FullPath);
+    ResultObj->SetNumberField(TEXT("node_count"), NodeCount);
+    ResultObj->SetNumberField(TEXT("pure_node_count"), PureNodes.Num());
+    ResultObj->SetNumberField(TEXT("exec_node_count"), ExecNodeCount);
+    ResultObj->SetNumberField(TEXT("data_link_count"), DataLinkCount);
+    ResultObj->SetNumberField(TEXT("seed"), Seed);
+    ResultObj->SetBoolField(TEXT("compiled"), bCompile);
+    if (bCompile)
+    {
+        ResultObj->SetBoolField(TEXT("compile_ok"), Blueprint->Status != BS_Error);
+    }
+    ResultObj->SetNumberField(TEXT("build_ms"), BuildMs);
+    ResultObj->SetNumberField(TEXT("compile_ms"), CompileMs);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), GetElapsedMs(StartSeconds));
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBenchmarkCommands::HandleGenerateBenchmarkWidgetTree(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+        {TEXT("name"), TEXT("path"), TEXT("depth"), TEXT("fanout"), TEXT("seed"), TEXT("compile"), TEXT("save")}))
+    {
+        return Err;
+    }
+
+    FString AssetName;
+    if (!Params->TryGetStringField(TEXT("name"), AssetName) || AssetName.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    int32 Depth = 0;
+    int32 Fanout = 0;
+    if (!Params->TryGetNumberField(TEXT("depth"), Depth) || !Params->TryGetNumberField(TEXT("fanout"), Fanout))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'depth' or 'fanout' parameter"));
+    }
+    if (Depth < 1 || Fanout < 1)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'depth' and 'fanout' must be at least 1"));
+    }
+    const int64 ExpectedWidgets = CountWidgetTreeNodes(Depth, Fanout);
+    if (ExpectedWidgets > MaxBenchmarkWidgets)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("depth=%d fanout=%d exceeds the %d widget limit"), Depth, Fanout, MaxBenchmarkWidgets));
+    }
+
+    int32 Seed = 0;
+    Params->TryGetNumberField(TEXT("seed"), Seed);
+    bool bCompile = true;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+    bool bSave = false;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
+    const FString FullPath = GetBenchmarkPackagePath(Params) + TEXT("/") + AssetName;
+    if (UEditorAssetLibrary::DoesAssetExist(FullPath))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget Blueprint already exists: %s"), *FullPath));
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    UWidgetBlueprintFactory* Factory = NewObject<UWidgetBlueprintFactory>();
+    Factory->ParentClass = UUserWidget::StaticClass();
+    Factory->BlueprintType = BPTYPE_Normal;
+    UPackage* Package = CreatePackage(*FullPath);
+    UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Factory->FactoryCreateNew(
+        UWidgetBlueprint::StaticClass(), Package, FName(*AssetName), RF_Public | RF_Standalone, nullptr, GWarn));
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create Widget Blueprint"));
+    }
+    FAssetRegistryModule::AssetCreated(WidgetBlueprint);
+
+    const TArray<UClass*> PanelClasses = {UVerticalBox::StaticClass(), UHorizontalBox::StaticClass(), UOverlay::StaticClass()};
+    const TArray<UClass*> LeafClasses = {UTextBlock::StaticClass(), UImage::StaticClass(), USpacer::StaticClass()};
+
+    UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+    FRandomStream Stream(Seed);
+    int32 PanelCount = 1;
+    int32 LeafCount = 0;
+
+    UPanelWidget* Root = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), FName(TEXT("BenchRoot")));
+    WidgetTree->RootWidget = Root;
+
+    // Breadth-first so widget numbering follows tree levels and is stable for a given seed.
+    TArray<UPanelWidget*> CurrentLevel = {Root};
+    for (int32 Level = 1; Level <= Depth; ++Level)
+    {
+        const bool bLeafLevel = Level == Depth;
+        TArray<UPanelWidget*> NextLevel;
+        NextLevel.Reserve(bLeafLevel ? 0 : CurrentLevel.Num() * Fanout);
+
+        for (UPanelWidget* Parent : CurrentLevel)
+        {
+            for (int32 ChildIndex = 0; ChildIndex < Fanout; ++ChildIndex)
+            {
+                if (bLeafLevel)
+                {
+                    UClass* LeafClass = LeafClasses[Stream.RandHelper(LeafClasses.Num())];
+                    UWidget* Leaf = WidgetTree->ConstructWidget<UWidget>(LeafClass, FName(TEXT("BenchLeaf"), NAME_EXTERNAL_TO_INTERNAL(LeafCount)));
+                    if (UTextBlock* TextBlock = Cast<UTextBlock>(Leaf))
+                    {
+                        TextBlock->SetText(FText::FromString(FString::Printf(TEXT("Item %d"), LeafCount)));
+                    }
+                    Parent->AddChild(Leaf);
+                    ++LeafCount;
+                }
+                else
+                {
+                    UClass* PanelClass = PanelClasses[Stream.RandHelper(PanelClasses.Num())];
+                    UPanelWidget* Panel = WidgetTree->ConstructWidget<UPanelWidget>(PanelClass, FName(TEXT("BenchPanel"), NAME_EXTERNAL_TO_INTERNAL(PanelCount)));
+                    Parent->AddChild(Panel);
+                    NextLevel.Add(Panel);
+                    ++PanelCount;
+                }
+            }
+        }
+        CurrentLevel = MoveTemp(NextLevel);
+    }
+
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+
+    const double BuildMs = GetElapsedMs(StartSeconds);
+    double CompileMs = 0.0;
+    if (bCompile)
+    {
+        const double CompileStartSeconds = FPlatformTime::Seconds();
+        FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+        CompileMs = GetElapsedMs(CompileStartSeconds);
+    }
+    WidgetBlueprint->MarkPackageDirty();
+    if (bSave)
+    {
+        UEditorAssetLibrary::SaveAsset(FullPath, false);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("blueprint_path"), FullPath);
+    ResultObj->SetNumberField(TEXT("widget_count"), PanelCount + LeafCount);
+    ResultObj->SetNumberField(TEXT("panel_count"), PanelCount);
+    ResultObj->SetNumberField(TEXT("leaf_count"), LeafCount);
+    ResultObj->SetNumberField(TEXT("depth"), Depth);
+    ResultObj->SetNumberField(TEXT("fanout"), Fanout);
+    ResultObj->SetNumberField(TEXT("seed"), Seed);
+    ResultObj->SetBoolField(TEXT("compiled"), bCompile);
+    if (bCompile)
+    {
+        ResultObj->SetBoolField(TEXT("compile_ok"), WidgetBlueprint->Status != BS_Error);
+    }
+    ResultObj->SetNumberField(TEXT("build_ms"), BuildMs);
+    ResultObj->SetNumberField(TEXT("compile_ms"), CompileMs);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), GetElapsedMs(StartSeconds));
+    return ResultObj;
+}
+
+TArray<FMCPCommandMeta> FUnrealMCPBenchmarkCommands::GetCommandMetadata()
+{
+	return {
+		{TEXT("generate_benchmark_actors"), TEXT("benchmark"), TEXT("Spawn N seeded actors in one transaction (grid/random/sphere layout)"), {
+			{TEXT("count"), TEXT("number"), true, TEXT("Number of actors to spawn")},
+			{TEXT("class"), TEXT("string"), false, TEXT("Actor class (shorthand like StaticMeshActor/PointLight or class path, default: StaticMeshActor)")},
+			{TEXT("distribution"), TEXT("string"), false, TEXT("grid, random or sphere (default: grid)")},
+			{TEXT("seed"), TEXT("number"), false, TEXT("Random seed (default: 0)")},
+			{TEXT("origin"), TEXT("array"), false, TEXT("[x, y, z] centre of the layout")},
+			{TEXT("spacing"), TEXT("number"), false, TEXT("Grid cell size in cm (default: 200)")},
+			{TEXT("extent"), TEXT("number"), false, TEXT("Half-size of the random box / radius of the sphere in cm (default: 10000)")},
+			{TEXT("random_yaw"), TEXT("bool"), false, TEXT("Randomize yaw per actor (default: false)")},
+			{TEXT("static_mesh"), TEXT("string"), false, TEXT("Static mesh asset assigned to StaticMeshActors")},
+			{TEXT("name_prefix"), TEXT("string"), false, TEXT("Actor name prefix (default: Bench)")},
+			{TEXT("folder"), TEXT("string"), false, TEXT("Outliner folder (default: Benchmark, empty = none)")}
+		}},
+		{TEXT("generate_benchmark_blueprint"), TEXT("benchmark"), TEXT("Create an Actor blueprint with a seeded random node graph of M nodes, compiled once"), {
+			{TEXT("name"), TEXT("string"), true, TEXT("Blueprint asset name")},
+			{TEXT("node_count"), TEXT("number"), true, TEXT("Number of generated graph nodes")},
+			{TEXT("path"), TEXT("string"), false, TEXT("Content folder (default: /Game/Benchmark)")},
+			{TEXT("seed"), TEXT("number"), false, TEXT("Random seed (default: 0)")},
+			{TEXT("link_probability"), TEXT("number"), false, TEXT("Chance each math input is wired to an earlier node (default: 0.5)")},
+			{TEXT("compile"), TEXT("bool"), false, TEXT("Compile after generation (default: true)")},
+			{TEXT("save"), TEXT("bool"), false, TEXT("Save the asset after generation (default: false)")}
+		}},
+		{TEXT("generate_benchmark_widget_tree"), TEXT("benchmark"), TEXT("Create a Widget Blueprint with a seeded tree of given depth and fanout, compiled once"), {
+			{TEXT("name"), TEXT("string"), true, TEXT("Widget Blueprint asset name")},
+			{TEXT("depth"), TEXT("number"), true, TEXT("Tree depth below the root")},
+			{TEXT("fanout"), TEXT("number"), true, TEXT("Children per panel")},
+			{TEXT("path"), TEXT("string"), false, TEXT("Content folder (default: /Game/Benchmark)")},
+			{TEXT("seed"), TEXT("number"), false, TEXT("Random seed (default: 0)")},
+			{TEXT("compile"), TEXT("bool"), false, TEXT("Compile after generation (default: true)")},
+			{TEXT("save"), TEXT("bool"), false, TEXT("Save the asset after generation (default: false)")}
+		}}
+	};
+}
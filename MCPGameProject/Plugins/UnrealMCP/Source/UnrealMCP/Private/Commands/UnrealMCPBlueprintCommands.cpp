@@ -1,5 +1,10 @@
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPAssetQuery.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPPropertyPlans.h"
+#include "Commands/UnrealMCPLevelChangeFeed.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "JsonObjectConverter.h"
@@ -13,6 +18,10 @@
 #include "Components/SphereComponent.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "BlueprintCompilationManager.h"
+#include "ScopedTransaction.h"
+#include "Logging/TokenizedMessage.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
 #include "UObject/Field.h"
@@ -20,6 +29,7 @@
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "GameFramework/Actor.h"
+#include "EngineUtils.h"
 #include "GameFramework/Pawn.h"
 
 FUnrealMCPBlueprintCommands::FUnrealMCPBlueprintCommands()
@@ -72,6 +82,18 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString
     {
         return HandleGetBlueprintDefaults(Params);
     }
+    else if (CommandType == TEXT("resolve_blueprint"))
+    {
+        return HandleResolveBlueprint(Params);
+    }
+    else if (CommandType == TEXT("set_blueprint_properties"))
+    {
+        return HandleSetBlueprintProperties(Params);
+    }
+    else if (CommandType == TEXT("compile_blueprints"))
+    {
+        return HandleCompileBlueprints(Params);
+    }
 
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
 }
@@ -199,31 +221,12 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
     }
 
-    // Create the component - dynamically find the component class by name
-    UClass* ComponentClass = nullptr;
-
-    // Try to find the class with exact name first
-    ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentType);
-    
-    // If not found, try with "Component" suffix
+    // Create the component - dynamically find the component class by name, with or without
+    // the "U" prefix and "Component" suffix
+    UClass* ComponentClass = FUnrealMCPClassIndex::Get().FindClass(ComponentType, UActorComponent::StaticClass());
     if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
     {
-        FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithSuffix);
-    }
-    
-    // If still not found, try with "U" prefix
-    if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
-    {
-        FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithPrefix);
-        
-        // Try with both prefix and suffix
-        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-        {
-            FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
-            ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithBoth);
-        }
+        ComponentClass = FUnrealMCPClassIndex::Get().FindClass(ComponentType + TEXT("Component"), UActorComponent::StaticClass());
     }
     
     // Verify that the class is a valid component type
@@ -378,384 +381,71 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid component template"));
     }
 
-    // Check if this is a Spring Arm component and log special debug info
-    if (ComponentTemplate->GetClass()->GetName().Contains(TEXT("SpringArm")))
+    if (!Params->HasField(TEXT("property_value")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - SpringArm component detected! Class: %s"), 
-            *ComponentTemplate->GetClass()->GetPathName());
-            
-        // Log all properties of the SpringArm component class
-        UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - SpringArm properties:"));
+        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Missing 'property_value' parameter"));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_value' parameter"));
+    }
+    TSharedPtr<FJsonValue> JsonValue = Params->Values.FindRef(TEXT("property_value"));
+
+    // Resolve the property (or path, e.g. "BodyInstance.MassScale") to its cached setter plan
+    FMCPPropertyPathTarget Target;
+    FString ResolveError;
+    if (!FUnrealMCPPropertyPlans::Get().ResolvePath(ComponentTemplate, PropertyName, true, Target, ResolveError))
+    {
+        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s on component %s"), 
+            *ResolveError, *ComponentName);
+
+        // List all available properties for this component
+        UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Available properties for %s:"), *ComponentName);
         for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
         {
             FProperty* Prop = *PropIt;
             UE_LOG(LogTemp, Warning, TEXT("  - %s (%s)"), *Prop->GetName(), *Prop->GetCPPType());
         }
 
-        // Special handling for Spring Arm properties
-        if (Params->HasField(TEXT("property_value")))
-        {
-            TSharedPtr<FJsonValue> JsonValue = Params->Values.FindRef(TEXT("property_value"));
-            
-            // Get the property using the new FField system
-            FProperty* Property = FindFProperty<FProperty>(ComponentTemplate->GetClass(), *PropertyName);
-            if (!Property)
-            {
-                UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Property %s not found on SpringArm component"), *PropertyName);
-                return FUnrealMCPCommonUtils::CreateErrorResponse(
-                    FString::Printf(TEXT("Property %s not found on SpringArm component"), *PropertyName));
-            }
-
-            // Create a scope guard to ensure property cleanup
-            struct FScopeGuard
-            {
-                UObject* Object;
-                FScopeGuard(UObject* InObject) : Object(InObject) 
-                {
-                    if (Object)
-                    {
-                        Object->Modify();
-                    }
-                }
-                ~FScopeGuard()
-                {
-                    if (Object)
-                    {
-                        Object->PostEditChange();
-                    }
-                }
-            } ScopeGuard(ComponentTemplate);
-
-            bool bSuccess = false;
-            FString ErrorMessage;
-
-            // Handle specific Spring Arm property types
-            if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-            {
-                if (JsonValue->Type == EJson::Number)
-                {
-                    const float Value = JsonValue->AsNumber();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting float property %s to %f"), *PropertyName, Value);
-                    FloatProp->SetPropertyValue_InContainer(ComponentTemplate, Value);
-                    bSuccess = true;
-                }
-            }
-            else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-            {
-                if (JsonValue->Type == EJson::Boolean)
-                {
-                    const bool Value = JsonValue->AsBool();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting bool property %s to %d"), *PropertyName, Value);
-                    BoolProp->SetPropertyValue_InContainer(ComponentTemplate, Value);
-                    bSuccess = true;
-                }
-            }
-            else if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-            {
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Handling struct property %s of type %s"), 
-                    *PropertyName, *StructProp->Struct->GetName());
-                
-                // Special handling for common Spring Arm struct properties
-                if (StructProp->Struct == TBaseStructure<FVector>::Get())
-                {
-                    if (JsonValue->Type == EJson::Array)
-                    {
-                        const TArray<TSharedPtr<FJsonValue>>& Arr = JsonValue->AsArray();
-                        if (Arr.Num() == 3)
-                        {
-                            FVector Vec(
-                                Arr[0]->AsNumber(),
-                                Arr[1]->AsNumber(),
-                                Arr[2]->AsNumber()
-                            );
-                            void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                            StructProp->CopySingleValue(PropertyAddr, &Vec);
-                            bSuccess = true;
-                        }
-                    }
-                }
-                else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
-                {
-                    if (JsonValue->Type == EJson::Array)
-                    {
-                        const TArray<TSharedPtr<FJsonValue>>& Arr = JsonValue->AsArray();
-                        if (Arr.Num() == 3)
-                        {
-                            FRotator Rot(
-                                Arr[0]->AsNumber(),
-                                Arr[1]->AsNumber(),
-                                Arr[2]->AsNumber()
-                            );
-                            void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                            StructProp->CopySingleValue(PropertyAddr, &Rot);
-                            bSuccess = true;
-                        }
-                    }
-                }
-            }
-
-            if (bSuccess)
-            {
-                // Mark the blueprint as modified
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Successfully set SpringArm property %s"), *PropertyName);
-                FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-
-                TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-                ResultObj->SetStringField(TEXT("component"), ComponentName);
-                ResultObj->SetStringField(TEXT("property"), PropertyName);
-                ResultObj->SetBoolField(TEXT("success"), true);
-                return ResultObj;
-            }
-            else
-            {
-                UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set SpringArm property %s"), *PropertyName);
-                return FUnrealMCPCommonUtils::CreateErrorResponse(
-                    FString::Printf(TEXT("Failed to set SpringArm property %s"), *PropertyName));
-            }
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("%s (component %s)"), *ResolveError, *ComponentName));
+    }
+    if (!Target.Plan.IsValid())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Property path ends on an object, not a property: %s"), *PropertyName));
     }
 
-    // Regular property handling for non-Spring Arm components continues...
+    // Modify/PostEditChange let components that derive state from their properties (spring arms,
+    // primitives) refresh it, and record the edit for undo
+    Target.Object->Modify();
 
-    // Set the property value
-    if (Params->HasField(TEXT("property_value")))
+    FString ErrorMessage;
+    if (!Target.Plan->Apply(Target.ValuePtr, JsonValue, ErrorMessage))
     {
-        TSharedPtr<FJsonValue> JsonValue = Params->Values.FindRef(TEXT("property_value"));
-        
-        // Get the property
-        FProperty* Property = FindFProperty<FProperty>(ComponentTemplate->GetClass(), *PropertyName);
-        if (!Property)
-        {
-            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Property %s not found on component %s"), 
-                *PropertyName, *ComponentName);
-            
-            // List all available properties for this component
-            UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Available properties for %s:"), *ComponentName);
-            for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
-            {
-                FProperty* Prop = *PropIt;
-                UE_LOG(LogTemp, Warning, TEXT("  - %s (%s)"), *Prop->GetName(), *Prop->GetCPPType());
-            }
-            
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Property %s not found on component %s"), *PropertyName, *ComponentName));
-        }
-        else
-        {
-            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property found: %s (Type: %s)"), 
-                *PropertyName, *Property->GetCPPType());
-        }
-
-        bool bSuccess = false;
-        FString ErrorMessage;
+        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set property %s: %s"), 
+            *PropertyName, *ErrorMessage);
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
 
-        // Handle different property types
-        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Attempting to set property %s"), *PropertyName);
-        
-        // Add try-catch block to catch and log any crashes
-        try
-        {
-            if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-            {
-                // Handle vector properties
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property is a struct: %s"), 
-                    StructProp->Struct ? *StructProp->Struct->GetName() : TEXT("NULL"));
-                    
-                if (StructProp->Struct == TBaseStructure<FVector>::Get())
-                {
-                    if (JsonValue->Type == EJson::Array)
-                    {
-                        // Handle array input [x, y, z]
-                        const TArray<TSharedPtr<FJsonValue>>& Arr = JsonValue->AsArray();
-                        if (Arr.Num() == 3)
-                        {
-                            FVector Vec(
-                                Arr[0]->AsNumber(),
-                                Arr[1]->AsNumber(),
-                                Arr[2]->AsNumber()
-                            );
-                            void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting Vector(%f, %f, %f)"), 
-                                Vec.X, Vec.Y, Vec.Z);
-                            StructProp->CopySingleValue(PropertyAddr, &Vec);
-                            bSuccess = true;
-                        }
-                        else
-                        {
-                            ErrorMessage = FString::Printf(TEXT("Vector property requires 3 values, got %d"), Arr.Num());
-                            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                        }
-                    }
-                    else if (JsonValue->Type == EJson::Number)
-                    {
-                        // Handle scalar input (sets all components to same value)
-                        float Value = JsonValue->AsNumber();
-                        FVector Vec(Value, Value, Value);
-                        void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting Vector(%f, %f, %f) from scalar"), 
-                            Vec.X, Vec.Y, Vec.Z);
-                        StructProp->CopySingleValue(PropertyAddr, &Vec);
-                        bSuccess = true;
-                    }
-                    else
-                    {
-                        ErrorMessage = TEXT("Vector property requires either a single number or array of 3 numbers");
-                        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                    }
-                }
-                else
-                {
-                    // Handle other struct properties using default handler
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Using generic struct handler for %s"), 
-                        *PropertyName);
-                    bSuccess = FUnrealMCPCommonUtils::SetObjectProperty(ComponentTemplate, PropertyName, JsonValue, ErrorMessage);
-                    if (!bSuccess)
-                    {
-                        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set struct property: %s"), *ErrorMessage);
-                    }
-                }
-            }
-            else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
-            {
-                // Handle enum properties
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property is an enum"));
-                if (JsonValue->Type == EJson::String)
-                {
-                    FString EnumValueName = JsonValue->AsString();
-                    UEnum* Enum = EnumProp->GetEnum();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting enum from string: %s"), *EnumValueName);
-                    
-                    if (Enum)
-                    {
-                        int64 EnumValue = Enum->GetValueByNameString(EnumValueName);
-                        
-                        if (EnumValue != INDEX_NONE)
-                        {
-                            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Found enum value: %lld"), EnumValue);
-                            EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(
-                                ComponentTemplate, 
-                                EnumValue
-                            );
-                            bSuccess = true;
-                        }
-                        else
-                        {
-                            // List all possible enum values
-                            UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Available enum values for %s:"), 
-                                *Enum->GetName());
-                            for (int32 i = 0; i < Enum->NumEnums(); i++)
-                            {
-                                UE_LOG(LogTemp, Warning, TEXT("  - %s (%lld)"), 
-                                    *Enum->GetNameStringByIndex(i),
-                                    Enum->GetValueByIndex(i));
-                            }
-                            
-                            ErrorMessage = FString::Printf(TEXT("Invalid enum value '%s' for property %s"), 
-                                *EnumValueName, *PropertyName);
-                            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                        }
-                    }
-                    else
-                    {
-                        ErrorMessage = TEXT("Enum object is NULL");
-                        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                    }
-                }
-                else if (JsonValue->Type == EJson::Number)
-                {
-                    // Allow setting enum by integer value
-                    int64 EnumValue = JsonValue->AsNumber();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting enum from number: %lld"), EnumValue);
-                    EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(
-                        ComponentTemplate, 
-                        EnumValue
-                    );
-                    bSuccess = true;
-                }
-                else
-                {
-                    ErrorMessage = TEXT("Enum property requires either a string name or integer value");
-                    UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                }
-            }
-            else if (FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
-            {
-                // Handle numeric properties
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property is numeric: IsInteger=%d, IsFloat=%d"), 
-                    NumericProp->IsInteger(), NumericProp->IsFloatingPoint());
-                    
-                if (JsonValue->Type == EJson::Number)
-                {
-                    double Value = JsonValue->AsNumber();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting numeric value: %f"), Value);
-                    
-                    if (NumericProp->IsInteger())
-                    {
-                        NumericProp->SetIntPropertyValue(ComponentTemplate, (int64)Value);
-                        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Set integer value: %lld"), (int64)Value);
-                        bSuccess = true;
-                    }
-                    else if (NumericProp->IsFloatingPoint())
-                    {
-                        NumericProp->SetFloatingPointPropertyValue(ComponentTemplate, Value);
-                        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Set float value: %f"), Value);
-                        bSuccess = true;
-                    }
-                }
-                else
-                {
-                    ErrorMessage = TEXT("Numeric property requires a number value");
-                    UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                }
-            }
-            else
-            {
-                // Handle all other property types using default handler
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Using generic property handler for %s (Type: %s)"), 
-                    *PropertyName, *Property->GetCPPType());
-                bSuccess = FUnrealMCPCommonUtils::SetObjectProperty(ComponentTemplate, PropertyName, JsonValue, ErrorMessage);
-                if (!bSuccess)
-                {
-                    UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set property: %s"), *ErrorMessage);
-                }
-            }
-        }
-        catch (const std::exception& Ex)
-        {
-            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - EXCEPTION: %s"), ANSI_TO_TCHAR(Ex.what()));
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Exception while setting property %s: %s"), *PropertyName, ANSI_TO_TCHAR(Ex.what())));
-        }
-        catch (...)
-        {
-            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - UNKNOWN EXCEPTION occurred while setting property %s"), *PropertyName);
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Unknown exception while setting property %s"), *PropertyName));
-        }
+    Target.Object->PostEditChange();
 
-        if (bSuccess)
-        {
-            // Mark the blueprint as modified
-            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Successfully set property %s on component %s"), 
-                *PropertyName, *ComponentName);
-            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    // Mark the blueprint as modified
+    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Successfully set property %s on component %s"), 
+        *PropertyName, *ComponentName);
+    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
-            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-            ResultObj->SetStringField(TEXT("component"), ComponentName);
-            ResultObj->SetStringField(TEXT("property"), PropertyName);
-            ResultObj->SetBoolField(TEXT("success"), true);
-            return ResultObj;
-        }
-        else
+    // Template edits reach the placed instances without an editor event on them
+    if (GWorld && Blueprint->GeneratedClass && Blueprint->GeneratedClass->IsChildOf(AActor::StaticClass()))
+    {
+        for (TActorIterator<AActor> It(GWorld, Blueprint->GeneratedClass); It; ++It)
         {
-            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set property %s: %s"), 
-                *PropertyName, *ErrorMessage);
-            return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+            FUnrealMCPLevelChangeFeed::Get().RecordChange(*It, EMCPLevelChangeType::Modified);
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Missing 'property_value' parameter"));
-    return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_value' parameter"));
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("component"), ComponentName);
+    ResultObj->SetStringField(TEXT("property"), PropertyName);
+    ResultObj->SetBoolField(TEXT("success"), true);
+    return ResultObj;
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(const TSharedPtr<FJsonObject>& Params)
@@ -949,8 +639,23 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty(
     {
         TSharedPtr<FJsonValue> JsonValue = Params->Values.FindRef(TEXT("property_value"));
         
+        FMCPPropertyPathTarget Target;
         FString ErrorMessage;
-        if (FUnrealMCPCommonUtils::SetObjectProperty(DefaultObject, PropertyName, JsonValue, ErrorMessage))
+        if (!FUnrealMCPPropertyPlans::Get().ResolvePath(DefaultObject, PropertyName, true, Target, ErrorMessage))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+        }
+        if (!Target.Plan.IsValid())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Property path ends on an object, not a property: %s"), *PropertyName));
+        }
+
+        // Bracket the write so the CDO edit is undoable and propagates like an editor edit
+        Target.Object->Modify();
+        const bool bApplied = Target.Plan->Apply(Target.ValuePtr, JsonValue, ErrorMessage);
+        Target.Object->PostEditChange();
+        if (bApplied)
         {
             // Mark the blueprint as modified
             FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
@@ -1300,6 +1005,68 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintInfo(cons
     return Result;
 }
 
+namespace
+{
+// Serialize the properties of Object whose values differ from Reference's. Both containers are
+// compared in place with Identical before anything is converted to JSON; properties Reference's
+// class lacks (or declares with a different type) always count as changed.
+void DiffPropertiesToJson(UObject* Object, UObject* Reference, int64 SkipFlags,
+    const TSharedRef<FJsonObject>& OutProperties, int32& OutComparedCount)
+{
+    UClass* Class = Object->GetClass();
+    UClass* ReferenceClass = Reference->GetClass();
+    // Shared ancestry means shared layout: the same FProperty reads both objects
+    const bool bSameLayout = Class->IsChildOf(ReferenceClass);
+    const uint32 PortFlags = PPF_DeepComparison | PPF_DeepCompareInstances;
+
+    OutComparedCount = 0;
+    for (TFieldIterator<FProperty> PropIt(Class); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        if (Property->HasAnyPropertyFlags(SkipFlags))
+        {
+            continue;
+        }
+        ++OutComparedCount;
+
+        const FProperty* ReferenceProperty = nullptr;
+        if (bSameLayout && Property->GetOwnerClass() && ReferenceClass->IsChildOf(Property->GetOwnerClass()))
+        {
+            ReferenceProperty = Property;
+        }
+        else if (!bSameLayout)
+        {
+            const FProperty* Candidate = ReferenceClass->FindPropertyByName(Property->GetFName());
+            if (Candidate && Candidate->SameType(Property) && Candidate->ArrayDim == Property->ArrayDim)
+            {
+                ReferenceProperty = Candidate;
+            }
+        }
+
+        bool bIdentical = ReferenceProperty != nullptr;
+        for (int32 Index = 0; bIdentical && Index < Property->ArrayDim; ++Index)
+        {
+            bIdentical = Property->Identical(
+                Property->ContainerPtrToValuePtr<void>(Object, Index),
+                ReferenceProperty->ContainerPtrToValuePtr<void>(Reference, Index),
+                PortFlags);
+        }
+        if (bIdentical)
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonValue> Value = FJsonObjectConverter::UPropertyToJsonValue(
+            Property, Property->ContainerPtrToValuePtr<void>(Object), 0, SkipFlags);
+        if (Value.IsValid())
+        {
+            // Same keys as the full dump
+            OutProperties->SetField(FJsonObjectConverter::StandardizeCase(Property->GetName()), Value);
+        }
+    }
+}
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintDefaults(const TSharedPtr<FJsonObject>& Params)
 {
     FString BlueprintName;
@@ -1331,12 +1098,47 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintDefaults(
     FString PropertyPath;
     Params->TryGetStringField(TEXT("property_path"), PropertyPath);
 
+    // "parent" or a class / blueprint name: emit only properties that differ from that CDO
+    FString DiffAgainst;
+    Params->TryGetStringField(TEXT("diff_against"), DiffAgainst);
+    UClass* ReferenceClass = nullptr;
+    if (!DiffAgainst.IsEmpty())
+    {
+        if (!PropertyPath.IsEmpty())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'diff_against' cannot be combined with 'property_path'"));
+        }
+        if (DiffAgainst.Equals(TEXT("parent"), ESearchCase::IgnoreCase))
+        {
+            ReferenceClass = GeneratedClass->GetSuperClass();
+        }
+        else
+        {
+            ReferenceClass = FUnrealMCPClassIndex::Get().FindClass(DiffAgainst);
+            if (!ReferenceClass)
+            {
+                UBlueprint* ReferenceBlueprint = FUnrealMCPCommonUtils::FindBlueprint(DiffAgainst);
+                ReferenceClass = ReferenceBlueprint ? ReferenceBlueprint->GeneratedClass.Get() : nullptr;
+            }
+        }
+        if (!ReferenceClass || !ReferenceClass->GetDefaultObject())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Reference class not found for diff_against: %s"), *DiffAgainst));
+        }
+    }
+
     // Skip transient (runtime-only) fields; editor-facing config lives in serialized UPROPERTYs.
     const int64 CheckFlags = 0;
     const int64 SkipFlags = CPF_Transient;
 
     TSharedPtr<FJsonObject> PropsObj = MakeShared<FJsonObject>();
-    if (PropertyPath.IsEmpty())
+    int32 ComparedCount = 0;
+    if (ReferenceClass)
+    {
+        DiffPropertiesToJson(CDO, ReferenceClass->GetDefaultObject(), SkipFlags, PropsObj.ToSharedRef(), ComparedCount);
+    }
+    else if (PropertyPath.IsEmpty())
     {
         // Dump the full CDO property container.
         FJsonObjectConverter::UStructToJsonObject(
@@ -1344,20 +1146,16 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintDefaults(
     }
     else
     {
-        // Single top-level property by name. Nested paths (e.g. "Comp.Field") are
-        // deferred — callers can follow the returned object path with another read.
-        FProperty* Property = GeneratedClass->FindPropertyByName(FName(*PropertyPath));
-        if (!Property)
+        // Only the value at the path is serialized ("Comp.Field", "Subobject:Name.Prop");
+        // blueprint component variables resolve to their construction script templates.
+        FString PathError;
+        TSharedPtr<FJsonValue> Value = FUnrealMCPPropertyPlans::Get().ReadPath(CDO, PropertyPath, SkipFlags, PathError);
+        if (!Value.IsValid())
         {
             return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Property not found on '%s': %s"), *BlueprintName, *PropertyPath));
-        }
-        TSharedPtr<FJsonValue> Value = FJsonObjectConverter::UPropertyToJsonValue(
-            Property, Property->ContainerPtrToValuePtr<void>(CDO), CheckFlags, SkipFlags);
-        if (Value.IsValid())
-        {
-            PropsObj->SetField(PropertyPath, Value);
+                FString::Printf(TEXT("%s (blueprint '%s')"), *PathError, *BlueprintName));
         }
+        PropsObj->SetField(PropertyPath, Value);
     }
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -1372,10 +1170,475 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintDefaults(
     {
         Result->SetStringField(TEXT("property_path"), PropertyPath);
     }
+    if (ReferenceClass)
+    {
+        Result->SetStringField(TEXT("diff_against"), ReferenceClass->GetPathName());
+        Result->SetNumberField(TEXT("changed_count"), PropsObj->Values.Num());
+        Result->SetNumberField(TEXT("compared_count"), ComparedCount);
+    }
     Result->SetObjectField(TEXT("properties"), PropsObj);
     return Result;
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleResolveBlueprint(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, {TEXT("blueprint_name")}))
+    {
+        return Err;
+    }
+
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    FUnrealMCPBlueprintIndex& BlueprintIndex = FUnrealMCPBlueprintIndex::Get();
+    TArray<FSoftObjectPath> Candidates;
+    bool bAmbiguous = false;
+    BlueprintIndex.GetCandidates(BlueprintName, Candidates, bAmbiguous);
+
+    TArray<TSharedPtr<FJsonValue>> CandidateArray;
+    for (const FSoftObjectPath& Candidate : Candidates)
+    {
+        CandidateArray.Add(MakeShared<FJsonValueString>(Candidate.ToString()));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
+    if (UBlueprint* Blueprint = BlueprintIndex.FindBlueprint(BlueprintName))
+    {
+        ResultObj->SetBoolField(TEXT("found"), true);
+        ResultObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+    }
+    else
+    {
+        ResultObj->SetBoolField(TEXT("found"), false);
+    }
+    ResultObj->SetBoolField(TEXT("ambiguous"), bAmbiguous);
+    ResultObj->SetArrayField(TEXT("candidates"), CandidateArray);
+    ResultObj->SetNumberField(TEXT("indexed_count"), BlueprintIndex.Num());
+    return ResultObj;
+}
+
+namespace
+{
+const int32 MaxBulkEditBlueprints = 1000;
+
+struct FMCPPropertyAssignment
+{
+    // Property path from the CDO: the component variable name prefixes the property for component edits
+    FString Path;
+    TSharedPtr<FJsonValue> Value;
+};
+
+// Blueprints named by 'blueprints', matched by a query_assets 'filter' (Blueprint and subclasses unless it
+// names classes) or, when bAllowDirty, every loaded Blueprint awaiting a recompile ('dirty': true)
+bool SelectBlueprints(const TSharedPtr<FJsonObject>& Params, bool bAllowDirty, TArray<UBlueprint*>& OutBlueprints,
+    TArray<TSharedPtr<FJsonValue>>& OutMissing, FString& OutError)
+{
+    const TArray<TSharedPtr<FJsonValue>>* NameValues = nullptr;
+    const TSharedPtr<FJsonObject>* FilterObj = nullptr;
+    bool bDirty = false;
+    const bool bHasNames = Params->TryGetArrayField(TEXT("blueprints"), NameValues);
+    const bool bHasFilter = Params->TryGetObjectField(TEXT("filter"), FilterObj);
+    const bool bHasDirty = bAllowDirty && Params->TryGetBoolField(TEXT("dirty"), bDirty) && bDirty;
+    if (int32(bHasNames) + int32(bHasFilter) + int32(bHasDirty) != 1)
+    {
+        OutError = bAllowDirty ? TEXT("Select blueprints with exactly one of 'blueprints', 'filter' or 'dirty'")
+                               : TEXT("Select blueprints with either 'blueprints' or 'filter'");
+        return false;
+    }
+
+    if (bHasNames)
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *NameValues)
+        {
+            const FString Name = NameValue.IsValid() ? NameValue->AsString() : FString();
+            if (UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(Name))
+            {
+                OutBlueprints.AddUnique(Blueprint);
+            }
+            else
+            {
+                OutMissing.Add(MakeShared<FJsonValueString>(Name));
+            }
+        }
+    }
+    else if (bHasFilter)
+    {
+        // A misspelt key or an empty filter would otherwise select every Blueprint under /Game
+        if (const TSharedPtr<FJsonObject> UnknownErr = FUnrealMCPCommonUtils::CheckUnknownParams(*FilterObj, FUnrealMCPAssetQuery::GetQueryParamKeys()))
+        {
+            OutError = TEXT("'filter': ") + UnknownErr->GetStringField(TEXT("error"));
+            return false;
+        }
+        static const TCHAR* const PredicateKeys[] = {TEXT("path"), TEXT("paths"), TEXT("class"), TEXT("classes"), TEXT("name"), TEXT("tags")};
+        bool bHasPredicate = false;
+        for (const TCHAR* Key : PredicateKeys)
+        {
+            bHasPredicate |= (*FilterObj)->HasField(Key);
+        }
+        if (!bHasPredicate)
+        {
+            OutError = TEXT("'filter' needs at least one of path, paths, class, classes, name or tags");
+            return false;
+        }
+
+        FMCPAssetQuery Query;
+        if (!FUnrealMCPAssetQuery::Get().ParseQuery(*FilterObj, Query, OutError))
+        {
+            return false;
+        }
+        if (Query.ClassPaths.Num() == 0)
+        {
+            Query.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+            Query.bRecursiveClasses = true;
+        }
+
+        bool bCacheHit = false;
+        const TSharedRef<const FMCPAssetQueryResult> QueryResult = FUnrealMCPAssetQuery::Get().Run(Query, true, bCacheHit);
+        if (QueryResult->Entries.Num() > MaxBulkEditBlueprints)
+        {
+            OutError = FString::Printf(TEXT("Filter matches %d assets (max: %d per call); narrow it down"), QueryResult->Entries.Num(), MaxBulkEditBlueprints);
+            return false;
+        }
+        for (const FMCPAssetQueryResult::FEntry& Entry : QueryResult->Entries)
+        {
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(Entry.Asset.GetAsset()))
+            {
+                OutBlueprints.AddUnique(Blueprint);
+            }
+            else
+            {
+                OutMissing.Add(MakeShared<FJsonValueString>(Entry.Asset.GetObjectPathString()));
+            }
+        }
+    }
+    else
+    {
+        // Only loaded Blueprints can be dirty; skip the transient ones editors and the compiler create
+        for (TObjectIterator<UBlueprint> It; It; ++It)
+        {
+            UBlueprint* Blueprint = *It;
+            if (IsValid(Blueprint) && Blueprint->Status == BS_Dirty && Blueprint->IsAsset() &&
+                !Blueprint->GetPackage()->HasAnyFlags(RF_Transient))
+            {
+                OutBlueprints.Add(Blueprint);
+            }
+        }
+    }
+
+    if (OutBlueprints.Num() > MaxBulkEditBlueprints)
+    {
+        OutError = FString::Printf(TEXT("Too many blueprints: %d (max: %d per call)"), OutBlueprints.Num(), MaxBulkEditBlueprints);
+        return false;
+    }
+    return true;
+}
+
+// One queued compile for the whole set, so shared dependents are reinstanced once rather than per blueprint
+void CompileBlueprintsQueued(const TArray<UBlueprint*>& Blueprints)
+{
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+    }
+    FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+}
+
+// Errors and warnings the last compile left on the Blueprint's nodes, as the graph editor shows them
+void CollectNodeMessages(const UBlueprint* Blueprint, TArray<TSharedPtr<FJsonValue>>& OutErrors, TArray<TSharedPtr<FJsonValue>>& OutWarnings)
+{
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (const UEdGraph* Graph : Graphs)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node || !Node->bHasCompilerMessage || Node->ErrorType > EMessageSeverity::Warning)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+            MessageObj->SetStringField(TEXT("graph"), Graph->GetName());
+            MessageObj->SetStringField(TEXT("node_id"), Node->NodeGuid.ToString());
+            MessageObj->SetStringField(TEXT("node_title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+            MessageObj->SetStringField(TEXT("message"), Node->ErrorMsg);
+            (Node->ErrorType <= EMessageSeverity::Error ? OutErrors : OutWarnings).Add(MakeShared<FJsonValueObject>(MessageObj));
+        }
+    }
+}
+
+// Messages of a compile log that no node carries (class layout, inheritance, generated class
+// errors); node messages are left to CollectNodeMessages, which reports where they are
+void CollectClassMessages(const FCompilerResultsLog& Log, TArray<TSharedPtr<FJsonValue>>& OutErrors, TArray<TSharedPtr<FJsonValue>>& OutWarnings)
+{
+    for (const TSharedRef<FTokenizedMessage>& Message : Log.Messages)
+    {
+        if (Message->GetSeverity() > EMessageSeverity::Warning ||
+            Message->GetMessageTokens().ContainsByPredicate([](const TSharedRef<IMessageToken>& Token) { return Token->GetType() == EMessageToken::EdGraph; }))
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+        MessageObj->SetStringField(TEXT("message"), Message->ToText().ToString());
+        (Message->GetSeverity() <= EMessageSeverity::Error ? OutErrors : OutWarnings).Add(MakeShared<FJsonValueObject>(MessageObj));
+    }
+}
+
+FString BlueprintStatusName(const UBlueprint* Blueprint)
+{
+    return StaticEnum<EBlueprintStatus>()->GetNameStringByValue(static_cast<int64>(Blueprint->Status.GetValue()));
+}
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperties(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, {TEXT("blueprints"), TEXT("filter"), TEXT("assignments"), TEXT("compile")}))
+    {
+        return Err;
+    }
+
+    // Assignments: [{property, value, component?}], validated before anything is touched
+    const TArray<TSharedPtr<FJsonValue>>* AssignmentValues = nullptr;
+    if (!Params->TryGetArrayField(TEXT("assignments"), AssignmentValues) || AssignmentValues->Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'assignments' parameter ([{property, value, component?}])"));
+    }
+
+    TArray<FMCPPropertyAssignment> Assignments;
+    for (const TSharedPtr<FJsonValue>& AssignmentValue : *AssignmentValues)
+    {
+        const TSharedPtr<FJsonObject>* AssignmentObj = nullptr;
+        FString Property;
+        if (!AssignmentValue.IsValid() || !AssignmentValue->TryGetObject(AssignmentObj) ||
+            !(*AssignmentObj)->TryGetStringField(TEXT("property"), Property) || !(*AssignmentObj)->HasField(TEXT("value")))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Each assignment needs 'property' and 'value'"));
+        }
+
+        FString Component;
+        (*AssignmentObj)->TryGetStringField(TEXT("component"), Component);
+        Assignments.Add({Component.IsEmpty() ? Property : Component + TEXT(".") + Property, (*AssignmentObj)->Values.FindRef(TEXT("value"))});
+    }
+
+    bool bCompile = true;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+
+    TArray<UBlueprint*> Blueprints;
+    TArray<TSharedPtr<FJsonValue>> MissingArr;
+    FString SelectError;
+    if (!SelectBlueprints(Params, false, Blueprints, MissingArr, SelectError))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(SelectError);
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    TArray<UBlueprint*> Modified;
+    TArray<TSharedPtr<FJsonObject>> ModifiedEntries;
+    TArray<TSharedPtr<FJsonValue>> BlueprintsArr;
+    int32 AppliedCount = 0;
+    int32 FailedCount = 0;
+    {
+        // One undo entry for the whole batch
+        FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Set Properties on %d Blueprints"), Blueprints.Num())));
+        FUnrealMCPPropertyPlans& PropertyPlans = FUnrealMCPPropertyPlans::Get();
+
+        for (UBlueprint* Blueprint : Blueprints)
+        {
+            TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+            EntryObj->SetStringField(TEXT("name"), Blueprint->GetName());
+            EntryObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+
+            UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+            TArray<TSharedPtr<FJsonValue>> ErrorsArr;
+            // CDO and component templates written to, each notified once after all its assignments
+            TArray<UObject*, TInlineAllocator<4>> Touched;
+            int32 Applied = 0;
+            for (const FMCPPropertyAssignment& Assignment : Assignments)
+            {
+                FMCPPropertyPathTarget Target;
+                FString AssignmentError = TEXT("Blueprint has no GeneratedClass yet (may need compile)");
+                if (CDO && PropertyPlans.ResolvePath(CDO, Assignment.Path, true, Target, AssignmentError))
+                {
+                    if (!Target.Plan.IsValid())
+                    {
+                        AssignmentError = TEXT("Property path ends on an object, not a property");
+                    }
+                    else
+                    {
+                        if (!Touched.Contains(Target.Object))
+                        {
+                            Target.Object->Modify();
+                            Touched.Add(Target.Object);
+                        }
+                        if (Target.Plan->Apply(Target.ValuePtr, Assignment.Value, AssignmentError))
+                        {
+                            ++Applied;
+                            continue;
+                        }
+                    }
+                }
+                ErrorsArr.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s: %s"), *Assignment.Path, *AssignmentError)));
+            }
+
+            for (UObject* Object : Touched)
+            {
+                Object->PostEditChange();
+            }
+            if (Applied > 0)
+            {
+                Modified.Add(Blueprint);
+                ModifiedEntries.Add(EntryObj);
+                if (!bCompile)
+                {
+                    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+                }
+            }
+
+            AppliedCount += Applied;
+            FailedCount += ErrorsArr.Num();
+            EntryObj->SetNumberField(TEXT("applied"), Applied);
+            if (ErrorsArr.Num() > 0)
+            {
+                EntryObj->SetArrayField(TEXT("errors"), ErrorsArr);
+            }
+            BlueprintsArr.Add(MakeShared<FJsonValueObject>(EntryObj));
+        }
+    }
+
+    // compile_ms stays 0 when nothing was queued for compile
+    const bool bCompiled = bCompile && Modified.Num() > 0;
+    double CompileMs = 0.0;
+    if (bCompiled)
+    {
+        const double CompileStartSeconds = FPlatformTime::Seconds();
+        CompileBlueprintsQueued(Modified);
+        CompileMs = (FPlatformTime::Seconds() - CompileStartSeconds) * 1000.0;
+        for (int32 Index = 0; Index < Modified.Num(); ++Index)
+        {
+            ModifiedEntries[Index]->SetStringField(TEXT("status"), BlueprintStatusName(Modified[Index]));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("blueprints"), BlueprintsArr);
+    ResultObj->SetNumberField(TEXT("count"), Modified.Num());
+    ResultObj->SetNumberField(TEXT("applied_count"), AppliedCount);
+    ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResultObj->SetArrayField(TEXT("missing"), MissingArr);
+    ResultObj->SetBoolField(TEXT("compiled"), bCompiled);
+    ResultObj->SetNumberField(TEXT("compile_ms"), CompileMs);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, {TEXT("blueprints"), TEXT("filter"), TEXT("dirty"), TEXT("mode")}))
+    {
+        return Err;
+    }
+
+    FString Mode = TEXT("queued");
+    Params->TryGetStringField(TEXT("mode"), Mode);
+    const bool bSequential = Mode == TEXT("sequential");
+    if (!bSequential && Mode != TEXT("queued"))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown mode '%s' (queued, sequential)"), *Mode));
+    }
+
+    TArray<UBlueprint*> Blueprints;
+    TArray<TSharedPtr<FJsonValue>> MissingArr;
+    FString SelectError;
+    if (!SelectBlueprints(Params, true, Blueprints, MissingArr, SelectError))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(SelectError);
+    }
+
+    // Queued: one compilation manager pass, so shared dependents are recompiled and reinstanced once.
+    // Sequential: one full compile per Blueprint, which is what timing each of them requires.
+    TArray<double> Milliseconds;
+    TArray<TArray<TSharedPtr<FJsonValue>>> ClassErrors;
+    TArray<TArray<TSharedPtr<FJsonValue>>> ClassWarnings;
+    const double StartSeconds = FPlatformTime::Seconds();
+    if (bSequential)
+    {
+        ClassErrors.SetNum(Blueprints.Num());
+        ClassWarnings.SetNum(Blueprints.Num());
+        for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+        {
+            FCompilerResultsLog Log;
+            const double BlueprintStartSeconds = FPlatformTime::Seconds();
+            FKismetEditorUtilities::CompileBlueprint(Blueprints[Index], EBlueprintCompileOptions::None, &Log);
+            Milliseconds.Add((FPlatformTime::Seconds() - BlueprintStartSeconds) * 1000.0);
+            CollectClassMessages(Log, ClassErrors[Index], ClassWarnings[Index]);
+        }
+    }
+    else if (Blueprints.Num() > 0)
+    {
+        CompileBlueprintsQueued(Blueprints);
+    }
+    const double CompileMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+    TArray<TSharedPtr<FJsonValue>> BlueprintsArr;
+    int32 ErrorCount = 0;
+    int32 WarningCount = 0;
+    int32 FailedCount = 0;
+    for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+    {
+        UBlueprint* Blueprint = Blueprints[Index];
+        TArray<TSharedPtr<FJsonValue>> ErrorsArr;
+        TArray<TSharedPtr<FJsonValue>> WarningsArr;
+        CollectNodeMessages(Blueprint, ErrorsArr, WarningsArr);
+        if (bSequential)
+        {
+            ErrorsArr.Append(ClassErrors[Index]);
+            WarningsArr.Append(ClassWarnings[Index]);
+        }
+        // The queued compile keeps no per-Blueprint log: a failure no node explains still gets an entry
+        if (Blueprint->Status == BS_Error && ErrorsArr.Num() == 0)
+        {
+            TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+            MessageObj->SetStringField(TEXT("message"), bSequential
+                ? TEXT("Blueprint failed to compile")
+                : TEXT("Blueprint failed to compile with no node error; compile it with mode 'sequential' for the class-level messages"));
+            ErrorsArr.Add(MakeShared<FJsonValueObject>(MessageObj));
+        }
+
+        TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+        EntryObj->SetStringField(TEXT("name"), Blueprint->GetName());
+        EntryObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+        EntryObj->SetStringField(TEXT("status"), BlueprintStatusName(Blueprint));
+        EntryObj->SetArrayField(TEXT("errors"), ErrorsArr);
+        EntryObj->SetArrayField(TEXT("warnings"), WarningsArr);
+        if (bSequential)
+        {
+            EntryObj->SetNumberField(TEXT("ms"), Milliseconds[Index]);
+        }
+        BlueprintsArr.Add(MakeShared<FJsonValueObject>(EntryObj));
+
+        ErrorCount += ErrorsArr.Num();
+        WarningCount += WarningsArr.Num();
+        FailedCount += Blueprint->Status == BS_Error ? 1 : 0;
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("mode"), Mode);
+    ResultObj->SetArrayField(TEXT("blueprints"), BlueprintsArr);
+    ResultObj->SetNumberField(TEXT("count"), Blueprints.Num());
+    ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResultObj->SetNumberField(TEXT("error_count"), ErrorCount);
+    ResultObj->SetNumberField(TEXT("warning_count"), WarningCount);
+    ResultObj->SetArrayField(TEXT("missing"), MissingArr);
+    ResultObj->SetNumberField(TEXT("compile_ms"), CompileMs);
+    ResultObj->SetNumberField(TEXT("ms_per_blueprint"), Blueprints.Num() > 0 ? CompileMs / Blueprints.Num() : 0.0);
+    return ResultObj;
+}
+
 TArray<FMCPCommandMeta> FUnrealMCPBlueprintCommands::GetCommandMetadata()
 {
 	return {
@@ -1394,7 +1657,7 @@ TArray<FMCPCommandMeta> FUnrealMCPBlueprintCommands::GetCommandMetadata()
 		{TEXT("set_component_property"), TEXT("blueprint"), TEXT("Set a property on a Blueprint component"), {
 			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Target Blueprint")},
 			{TEXT("component_name"), TEXT("string"), true, TEXT("Component instance name")},
-			{TEXT("property_name"), TEXT("string"), true, TEXT("Property to set")},
+			{TEXT("property_name"), TEXT("string"), true, TEXT("Property name or path (e.g. BodyInstance.MassScale)")},
 			{TEXT("property_value"), TEXT("any"), true, TEXT("Value to set")}
 		}},
 		{TEXT("set_physics_properties"), TEXT("blueprint"), TEXT("Set physics properties on a primitive component"), {
@@ -1410,7 +1673,7 @@ TArray<FMCPCommandMeta> FUnrealMCPBlueprintCommands::GetCommandMetadata()
 		}},
 		{TEXT("set_blueprint_property"), TEXT("blueprint"), TEXT("Set a class default property on a Blueprint"), {
 			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Target Blueprint")},
-			{TEXT("property_name"), TEXT("string"), true, TEXT("Property name")},
+			{TEXT("property_name"), TEXT("string"), true, TEXT("Property name or path (e.g. Subobject:Name.Prop, Items[0].Count)")},
 			{TEXT("property_value"), TEXT("any"), true, TEXT("Value to set")}
 		}},
 		{TEXT("set_static_mesh_properties"), TEXT("blueprint"), TEXT("Set mesh/material on a StaticMeshComponent"), {
@@ -1432,7 +1695,23 @@ TArray<FMCPCommandMeta> FUnrealMCPBlueprintCommands::GetCommandMetadata()
 		}},
 		{TEXT("get_blueprint_defaults"), TEXT("blueprint"), TEXT("Read a Blueprint CDO's property values (Details-panel level data: arrays, enums, struct fields, object references)"), {
 			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Target Blueprint")},
-			{TEXT("property_path"), TEXT("string"), false, TEXT("Optional top-level property name to narrow the dump")}
+			{TEXT("property_path"), TEXT("string"), false, TEXT("Optional property path to read instead of the full dump (e.g. Mesh.RelativeScale3D, Subobject:Name.Prop, Items[2])")},
+			{TEXT("diff_against"), TEXT("string"), false, TEXT("Only emit properties that differ from this CDO: 'parent' or a class / blueprint name")}
+		}},
+		{TEXT("resolve_blueprint"), TEXT("blueprint"), TEXT("Show which asset a Blueprint name resolves to, and every indexed candidate when the short name is shared"), {
+			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Short name, package path, object path or generated class path")}
+		}},
+		{TEXT("set_blueprint_properties"), TEXT("blueprint"), TEXT("Apply property assignments to many Blueprints' defaults and component templates in one transaction, then compile them in one queued pass"), {
+			{TEXT("blueprints"), TEXT("array"), false, TEXT("Blueprint names or paths")},
+			{TEXT("filter"), TEXT("object"), false, TEXT("query_assets filter selecting the Blueprints instead (classes default to Blueprint; max 1000 matches)")},
+			{TEXT("assignments"), TEXT("array"), true, TEXT("[{property, value, component?}]; property accepts paths, component targets that component's template")},
+			{TEXT("compile"), TEXT("bool"), false, TEXT("Compile the edited Blueprints in one queued pass (default: true); false only marks them modified")}
+		}},
+		{TEXT("compile_blueprints"), TEXT("blueprint"), TEXT("Compile many Blueprints in one compilation manager pass and report errors and warnings per node"), {
+			{TEXT("blueprints"), TEXT("array"), false, TEXT("Blueprint names or paths")},
+			{TEXT("filter"), TEXT("object"), false, TEXT("query_assets filter selecting the Blueprints instead (classes default to Blueprint; max 1000 matches)")},
+			{TEXT("dirty"), TEXT("bool"), false, TEXT("Compile every loaded Blueprint that needs a recompile instead")},
+			{TEXT("mode"), TEXT("string"), false, TEXT("queued (default: one pass, reinstancing once; only an average ms_per_blueprint, no per-Blueprint ms) or sequential (one compile per Blueprint, each timed in its ms field)")}
 		}}
 	};
 } 
\ No newline at end of file
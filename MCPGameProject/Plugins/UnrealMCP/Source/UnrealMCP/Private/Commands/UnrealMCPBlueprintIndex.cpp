@@ -0,0 +1,463 @@
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPReadLoads.h"
+#include "AssetRegistry/ARFilter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Level.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/LevelScriptBlueprint.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+// Folders a bare short name is looked up in first, in order (the pre-index candidate paths)
+const TCHAR* const PreferredFolders[] = {
+    TEXT("/Game/Blueprints/"),
+    TEXT("/Game/Widgets/"),
+    TEXT("/Game/Maps/"),
+    TEXT("/Game/"),
+};
+
+void AddBlueprintCandidatePath(TArray<FString>& OutCandidatePaths, const FString& InPath)
+{
+    FString Path = InPath;
+    Path.TrimStartAndEndInline();
+    if (Path.IsEmpty())
+    {
+        return;
+    }
+
+    if (Path.EndsWith(TEXT("_C")))
+    {
+        Path.LeftChopInline(2, EAllowShrinking::No);
+    }
+
+    OutCandidatePaths.AddUnique(Path);
+
+    if (!Path.Contains(TEXT(".")))
+    {
+        const FString AssetName = FPackageName::GetShortName(Path);
+        if (!AssetName.IsEmpty())
+        {
+            OutCandidatePaths.AddUnique(Path + TEXT(".") + AssetName);
+        }
+    }
+}
+
+// The exact paths a key names, in priority order: a rooted path as given, anything else (a short
+// name or a relative path such as "Characters/BP_Hero") under each preferred folder
+void AddKeyCandidatePaths(TArray<FString>& OutCandidatePaths, const FString& Key)
+{
+    if (Key.StartsWith(TEXT("/")))
+    {
+        AddBlueprintCandidatePath(OutCandidatePaths, Key);
+        return;
+    }
+    for (const TCHAR* Folder : PreferredFolders)
+    {
+        AddBlueprintCandidatePath(OutCandidatePaths, FString(Folder) + Key);
+    }
+}
+
+UBlueprint* ResolveBlueprintFromObject(UObject* LoadedObject)
+{
+    if (!LoadedObject)
+    {
+        return nullptr;
+    }
+
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(LoadedObject))
+    {
+        return Blueprint;
+    }
+
+    if (UClass* LoadedClass = Cast<UClass>(LoadedObject))
+    {
+        return Cast<UBlueprint>(LoadedClass->ClassGeneratedBy);
+    }
+
+    if (UWorld* LoadedWorld = Cast<UWorld>(LoadedObject))
+    {
+        if (ULevel* PersistentLevel = LoadedWorld->PersistentLevel)
+        {
+            if (ULevelScriptBlueprint* LevelScriptBlueprint = PersistentLevel->GetLevelScriptBlueprint())
+            {
+                return LevelScriptBlueprint;
+            }
+        }
+    }
+
+    if (ULevel* LoadedLevel = Cast<ULevel>(LoadedObject))
+    {
+        if (ULevelScriptBlueprint* LevelScriptBlueprint = LoadedLevel->GetLevelScriptBlueprint())
+        {
+            return LevelScriptBlueprint;
+        }
+    }
+
+    if (ALevelScriptActor* LoadedLevelScriptActor = Cast<ALevelScriptActor>(LoadedObject))
+    {
+        if (UClass* ActorClass = LoadedLevelScriptActor->GetClass())
+        {
+            return Cast<UBlueprint>(ActorClass->ClassGeneratedBy);
+        }
+    }
+
+    return nullptr;
+}
+
+UBlueprint* LoadBlueprintAt(const FSoftObjectPath& Path)
+{
+    // TryLoad returns the in-memory object without touching disk when it is already loaded
+    const bool bWasResident = FUnrealMCPReadLoads::IsResident(Path.ToString());
+    UBlueprint* Blueprint = ResolveBlueprintFromObject(Path.TryLoad());
+    FUnrealMCPReadLoads::Get().TrackRead(Blueprint, bWasResident);
+    return Blueprint;
+}
+
+IAssetRegistry& GetAssetRegistry()
+{
+    return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+}
+
+// Blueprints anywhere (plugin content included) and maps under /Game, as the registry walks did
+bool ClassifyAsset(const FAssetData& AssetData, bool& bOutWorld)
+{
+    if (AssetData.AssetClassPath == UWorld::StaticClass()->GetClassPathName())
+    {
+        bOutWorld = true;
+        return AssetData.PackageName.ToString().StartsWith(TEXT("/Game/"));
+    }
+
+    bOutWorld = false;
+    // Blueprint asset classes (UBlueprint, UWidgetBlueprint, UAnimBlueprint, ...) are native
+    const UClass* AssetClass = AssetData.GetClass();
+    return AssetClass && AssetClass->IsChildOf(UBlueprint::StaticClass());
+}
+}
+
+FUnrealMCPBlueprintIndex& FUnrealMCPBlueprintIndex::Get()
+{
+    static FUnrealMCPBlueprintIndex Index;
+    return Index;
+}
+
+FUnrealMCPBlueprintIndex::FUnrealMCPBlueprintIndex()
+    : NumEntries(0)
+    , bBuilt(false)
+    , bInitialized(false)
+{
+}
+
+void FUnrealMCPBlueprintIndex::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = GetAssetRegistry();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FUnrealMCPBlueprintIndex::HandleAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FUnrealMCPBlueprintIndex::HandleAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FUnrealMCPBlueprintIndex::HandleAssetRenamed);
+
+    bInitialized = true;
+    Invalidate();
+}
+
+void FUnrealMCPBlueprintIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    bInitialized = false;
+    Invalidate();
+}
+
+UBlueprint* FUnrealMCPBlueprintIndex::FindBlueprint(const FString& NameOrPath)
+{
+    FString Key = NameOrPath;
+    Key.TrimStartAndEndInline();
+    if (Key.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    const FString CacheKey = Key.ToLower();
+    if (const TWeakObjectPtr<UBlueprint>* Cached = Resolved.Find(CacheKey))
+    {
+        if (UBlueprint* Blueprint = Cached->Get())
+        {
+            return Blueprint;
+        }
+        Resolved.Remove(CacheKey);
+    }
+
+    EnsureBuilt();
+
+    TArray<FSoftObjectPath> Exact;
+    TArray<FSoftObjectPath> ByName;
+    bool bAmbiguous = false;
+    CollectCandidates(Key, Exact, ByName, bAmbiguous);
+
+    UBlueprint* Found = nullptr;
+    for (const FSoftObjectPath& Path : Exact)
+    {
+        if ((Found = LoadBlueprintAt(Path)) != nullptr)
+        {
+            break;
+        }
+    }
+
+    if (!Found && Key.Contains(TEXT("/")))
+    {
+        // Paths the index does not cover (maps outside /Game, class or subobject paths) may still load
+        TArray<FString> CandidatePaths;
+        AddKeyCandidatePaths(CandidatePaths, Key);
+        for (const FString& CandidatePath : CandidatePaths)
+        {
+            const bool bWasResident = FUnrealMCPReadLoads::IsResident(CandidatePath);
+            if ((Found = ResolveBlueprintFromObject(UEditorAssetLibrary::LoadAsset(CandidatePath))) != nullptr)
+            {
+                FUnrealMCPReadLoads::Get().TrackRead(Found, bWasResident);
+                break;
+            }
+        }
+    }
+
+    if (!Found)
+    {
+        for (const FSoftObjectPath& Path : ByName)
+        {
+            if ((Found = LoadBlueprintAt(Path)) != nullptr)
+            {
+                if (bAmbiguous && !ReportedAmbiguous.Contains(CacheKey))
+                {
+                    ReportedAmbiguous.Add(CacheKey);
+                    UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: Blueprint name '%s' matches %d assets; using %s. Pass a full path to pick another."),
+                        *Key, ByName.Num(), *Path.ToString());
+                }
+                break;
+            }
+        }
+    }
+
+    if (Found)
+    {
+        Resolved.Add(CacheKey, Found);
+    }
+    return Found;
+}
+
+void FUnrealMCPBlueprintIndex::GetCandidates(const FString& NameOrPath, TArray<FSoftObjectPath>& OutCandidates, bool& bOutAmbiguous)
+{
+    FString Key = NameOrPath;
+    Key.TrimStartAndEndInline();
+    OutCandidates.Reset();
+    bOutAmbiguous = false;
+    if (Key.IsEmpty())
+    {
+        return;
+    }
+
+    EnsureBuilt();
+
+    TArray<FSoftObjectPath> ByName;
+    CollectCandidates(Key, OutCandidates, ByName, bOutAmbiguous);
+    OutCandidates.Append(ByName);
+}
+
+int32 FUnrealMCPBlueprintIndex::Num()
+{
+    EnsureBuilt();
+    return NumEntries;
+}
+
+void FUnrealMCPBlueprintIndex::Invalidate()
+{
+    EntriesByName.Reset();
+    Resolved.Reset();
+    ReportedAmbiguous.Reset();
+    NumEntries = 0;
+    bBuilt = false;
+}
+
+void FUnrealMCPBlueprintIndex::EnsureBuilt()
+{
+    if (bBuilt)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = GetAssetRegistry();
+
+    // No PackagePaths filter: search all paths including plugin content (e.g. /AIPoint/, /Game/, etc.)
+    FARFilter BlueprintFilter;
+    BlueprintFilter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    BlueprintFilter.bRecursiveClasses = true;
+
+    FARFilter WorldFilter;
+    WorldFilter.PackagePaths.Add(FName(TEXT("/Game")));
+    WorldFilter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
+    WorldFilter.bRecursivePaths = true;
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(BlueprintFilter, Assets);
+    TArray<FAssetData> WorldAssets;
+    AssetRegistry.GetAssets(WorldFilter, WorldAssets);
+
+    EntriesByName.Reserve(Assets.Num() + WorldAssets.Num());
+    for (const FAssetData& Asset : Assets)
+    {
+        AddAsset(Asset);
+    }
+    for (const FAssetData& Asset : WorldAssets)
+    {
+        AddAsset(Asset);
+    }
+
+    // Anything the registry discovers later arrives through OnAssetAdded
+    bBuilt = true;
+}
+
+void FUnrealMCPBlueprintIndex::AddAsset(const FAssetData& AssetData)
+{
+    bool bWorld = false;
+    if (!ClassifyAsset(AssetData, bWorld))
+    {
+        return;
+    }
+
+    const FSoftObjectPath Path = AssetData.GetSoftObjectPath();
+    TArray<FEntry, TInlineAllocator<1>>& Entries = EntriesByName.FindOrAdd(AssetData.AssetName.ToString().ToLower());
+    if (!Entries.ContainsByPredicate([&Path](const FEntry& Entry) { return Entry.Path == Path; }))
+    {
+        Entries.Add({Path, bWorld});
+        ++NumEntries;
+    }
+}
+
+void FUnrealMCPBlueprintIndex::RemoveAsset(const FSoftObjectPath& Path)
+{
+    const FString NameKey = Path.GetAssetName().ToLower();
+    if (TArray<FEntry, TInlineAllocator<1>>* Entries = EntriesByName.Find(NameKey))
+    {
+        NumEntries -= Entries->RemoveAll([&Path](const FEntry& Entry) { return Entry.Path == Path; });
+        if (Entries->Num() == 0)
+        {
+            EntriesByName.Remove(NameKey);
+        }
+    }
+}
+
+void FUnrealMCPBlueprintIndex::CollectCandidates(const FString& Key, TArray<FSoftObjectPath>& OutExact, TArray<FSoftObjectPath>& OutByName, bool& bOutAmbiguous)
+{
+    // Exact object paths in priority order; the last candidate is always Package.Asset
+    TArray<FString> ExactPaths;
+    AddKeyCandidatePaths(ExactPaths, Key);
+    if (ExactPaths.Num() == 0)
+    {
+        return;
+    }
+    const FString AssetName = FPackageName::ObjectPathToObjectName(ExactPaths.Last());
+
+    const TArray<FEntry, TInlineAllocator<1>>* Entries = EntriesByName.Find(AssetName.ToLower());
+    if (!Entries)
+    {
+        return;
+    }
+
+    TArray<const FEntry*> Remaining;
+    for (const FEntry& Entry : *Entries)
+    {
+        Remaining.Add(&Entry);
+    }
+
+    for (const FString& ExactPath : ExactPaths)
+    {
+        const int32 Index = Remaining.IndexOfByPredicate([&ExactPath](const FEntry* Entry)
+        {
+            return Entry->Path.ToString().Equals(ExactPath, ESearchCase::IgnoreCase);
+        });
+        if (Index != INDEX_NONE)
+        {
+            OutExact.Add(Remaining[Index]->Path);
+            Remaining.RemoveAt(Index);
+        }
+    }
+
+    // A relative path names its folders, so other assets that merely share the short name do not qualify
+    if (!Key.StartsWith(TEXT("/")) && Key.Contains(TEXT("/")))
+    {
+        return;
+    }
+
+    // Blueprints before maps, then by path so the pick does not depend on registry order
+    Remaining.Sort([](const FEntry& A, const FEntry& B)
+    {
+        if (A.bWorld != B.bWorld)
+        {
+            return !A.bWorld;
+        }
+        return A.Path.ToString() < B.Path.ToString();
+    });
+
+    int32 NumBlueprints = 0;
+    for (const FEntry* Entry : Remaining)
+    {
+        OutByName.Add(Entry->Path);
+        NumBlueprints += Entry->bWorld ? 0 : 1;
+    }
+
+    const int32 FirstTier = NumBlueprints > 0 ? NumBlueprints : Remaining.Num();
+    bOutAmbiguous = OutExact.Num() == 0 && FirstTier > 1;
+}
+
+void FUnrealMCPBlueprintIndex::HandleAssetAdded(const FAssetData& AssetData)
+{
+    if (!bBuilt)
+    {
+        return;
+    }
+
+    AddAsset(AssetData);
+    // A new asset can outrank what a short name resolved to before; path keys are unaffected
+    Resolved.Remove(AssetData.AssetName.ToString().ToLower());
+}
+
+void FUnrealMCPBlueprintIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if (!bBuilt)
+    {
+        return;
+    }
+
+    RemoveAsset(AssetData.GetSoftObjectPath());
+    Resolved.Reset();
+}
+
+void FUnrealMCPBlueprintIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (!bBuilt)
+    {
+        return;
+    }
+
+    RemoveAsset(FSoftObjectPath(OldObjectPath));
+    AddAsset(AssetData);
+    Resolved.Reset();
+}
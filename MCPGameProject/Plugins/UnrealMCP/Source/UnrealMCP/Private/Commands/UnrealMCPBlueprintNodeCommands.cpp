@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPClassIndex.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EdGraph/EdGraph.h"
@@ -37,47 +38,7 @@ namespace
 {
 UClass* ResolveClassByName(const FString& InClassName)
 {
-    FString ClassName = InClassName;
-    ClassName.TrimStartAndEndInline();
-    if (ClassName.IsEmpty())
-    {
-        return nullptr;
-    }
-
-    UClass* ResolvedClass = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-    if (!ResolvedClass && ClassName.StartsWith(TEXT("/Script/")))
-    {
-        ResolvedClass = LoadObject<UClass>(nullptr, *ClassName);
-    }
-    if (!ResolvedClass && !ClassName.StartsWith(TEXT("U")))
-    {
-        const FString WithUPrefix = FString(TEXT("U")) + ClassName;
-        ResolvedClass = FindObject<UClass>(ANY_PACKAGE, *WithUPrefix);
-    }
-
-    if (!ResolvedClass)
-    {
-        const FString TargetNoPrefix = ClassName.StartsWith(TEXT("U")) ? ClassName.RightChop(1) : ClassName;
-        for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
-        {
-            UClass* CandidateClass = *ClassIt;
-            if (!IsValid(CandidateClass))
-            {
-                continue;
-            }
-
-            const FString CandidateName = CandidateClass->GetName();
-            const FString CandidateNoPrefix = CandidateName.StartsWith(TEXT("U")) ? CandidateName.RightChop(1) : CandidateName;
-            if (CandidateName.Equals(ClassName, ESearchCase::IgnoreCase) ||
-                CandidateNoPrefix.Equals(TargetNoPrefix, ESearchCase::IgnoreCase))
-            {
-                ResolvedClass = CandidateClass;
-                break;
-            }
-        }
-    }
-
-    return ResolvedClass;
+    return FUnrealMCPClassIndex::Get().FindClass(InClassName);
 }
 
 UEdGraphPin* FindNodePinByName(UEdGraphNode* Node, const FString& PinName)
@@ -825,87 +786,15 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     // Check if we have a target class specified
     if (!Target.IsEmpty())
     {
-        // Try to find the target class
-        UClass* TargetClass = nullptr;
-        
-        // First try without a prefix
-        TargetClass = FindObject<UClass>(ANY_PACKAGE, *Target);
-        UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-               *Target, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        
-        // If not found, try with U prefix (common convention for UE classes)
-        if (!TargetClass && !Target.StartsWith(TEXT("U")))
-        {
-            FString TargetWithPrefix = FString(TEXT("U")) + Target;
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, *TargetWithPrefix);
-            UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-                   *TargetWithPrefix, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        }
-        
-        // If still not found, try with common component names
-        if (!TargetClass)
+        // Accepts "GameplayStatics", "UGameplayStatics", "/Script/Engine.GameplayStatics", or a
+        // component's short name without its "Component" suffix
+        UClass* TargetClass = ResolveClassByName(Target);
+        if (!TargetClass && !Target.EndsWith(TEXT("Component")))
         {
-            // Try some common component class names
-            TArray<FString> PossibleClassNames;
-            PossibleClassNames.Add(FString(TEXT("U")) + Target + TEXT("Component"));
-            PossibleClassNames.Add(Target + TEXT("Component"));
-            
-            for (const FString& ClassName : PossibleClassNames)
-            {
-                TargetClass = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-                if (TargetClass)
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Found class using alternative name '%s'"), *ClassName);
-                    break;
-                }
-            }
-        }
-
-        // Try script path if caller passed fully qualified object path.
-        if (!TargetClass && Target.StartsWith(TEXT("/Script/")))
-        {
-            TargetClass = LoadObject<UClass>(nullptr, *Target);
-            UE_LOG(LogTemp, Display, TEXT("Tried to load class by script path '%s': %s"),
-                   *Target, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        }
-
-        // Fallback: iterate loaded classes by short name.
-        if (!TargetClass)
-        {
-            const FString TargetNoPrefix = Target.StartsWith(TEXT("U")) ? Target.RightChop(1) : Target;
-            for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
-            {
-                UClass* CandidateClass = *ClassIt;
-                if (!IsValid(CandidateClass))
-                {
-                    continue;
-                }
-
-                const FString CandidateName = CandidateClass->GetName();
-                const FString CandidateNoPrefix = CandidateName.StartsWith(TEXT("U")) ? CandidateName.RightChop(1) : CandidateName;
-                if (CandidateName.Equals(Target, ESearchCase::IgnoreCase) ||
-                    CandidateNoPrefix.Equals(TargetNoPrefix, ESearchCase::IgnoreCase))
-                {
-                    TargetClass = CandidateClass;
-                    UE_LOG(LogTemp, Display, TEXT("Found class by iterator fallback: %s"), *CandidateClass->GetPathName());
-                    break;
-                }
-            }
-        }
-        
-        // Special case handling for common classes like UGameplayStatics
-        if (!TargetClass && Target == TEXT("UGameplayStatics"))
-        {
-            // For UGameplayStatics, use a direct reference to known class
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, TEXT("UGameplayStatics"));
-            if (!TargetClass)
-            {
-                // Try loading it from its known package
-                TargetClass = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.GameplayStatics"));
-                UE_LOG(LogTemp, Display, TEXT("Explicitly loading GameplayStatics: %s"), 
-                       TargetClass ? TEXT("Success") : TEXT("Failed"));
-            }
+            TargetClass = ResolveClassByName(Target + TEXT("Component"));
         }
+        UE_LOG(LogTemp, Display, TEXT("Resolved target class '%s': %s"),
+               *Target, TargetClass ? *TargetClass->GetPathName() : TEXT("Not found"));
         
         // If we found a target class, look for the function there
         if (TargetClass)
@@ -1041,13 +930,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
                         // Handle class reference parameters (e.g., ActorClass in GetActorOfClass)
                         if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Class)
                         {
-                            // For class references, we require the exact class name with proper prefix
-                            // - Actor classes must start with 'A' (e.g., ACameraActor)
-                            // - Non-actor classes must start with 'U' (e.g., UObject)
+                            // Class name with or without its C++ prefix (CameraActor, ACameraActor) or a class path
                             const FString& ClassName = StringVal;
                             
-                            // TODO: This likely won't work in UE5.5+, so don't rely on it.
-                            UClass* Class = FindObject<UClass>(ANY_PACKAGE, *ClassName);
+                            UClass* Class = ResolveClassByName(ClassName);
 
                             if (!Class)
                             {
@@ -0,0 +1,275 @@
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+// Transient classes the compiler and reloaders leave in memory alongside the real one
+bool IsIndexableClass(const UClass* Class)
+{
+    if (!IsValid(Class) || Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+    {
+        return false;
+    }
+
+    const FString Name = Class->GetName();
+    return !Name.StartsWith(TEXT("SKEL_")) &&
+        !Name.StartsWith(TEXT("REINST_")) &&
+        !Name.StartsWith(TEXT("TRASHCLASS_")) &&
+        !Name.StartsWith(TEXT("HOTRELOADED_")) &&
+        !Name.StartsWith(TEXT("PLACEHOLDER-CLASS"));
+}
+
+// "UGameplayStatics" -> "GameplayStatics", "AStaticMeshActor" -> "StaticMeshActor"; UClass names carry no prefix
+bool StripCppPrefix(const FString& Name, FString& OutStripped)
+{
+    if (Name.Len() > 1 && (Name[0] == TEXT('U') || Name[0] == TEXT('A')) && FChar::IsUpper(Name[1]))
+    {
+        OutStripped = Name.RightChop(1);
+        return true;
+    }
+    return false;
+}
+
+bool PassesBase(const UClass* Class, const UClass* RequiredBase)
+{
+    return !RequiredBase || Class->IsChildOf(RequiredBase);
+}
+}
+
+FUnrealMCPClassIndex& FUnrealMCPClassIndex::Get()
+{
+    static FUnrealMCPClassIndex Index;
+    return Index;
+}
+
+FUnrealMCPClassIndex::FUnrealMCPClassIndex()
+    : NumClasses(0)
+    , bDirty(true)
+    , bInitialized(false)
+{
+}
+
+void FUnrealMCPClassIndex::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealMCPClassIndex::HandleModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason /*Reason*/) { Invalidate(); });
+    if (GEditor)
+    {
+        BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FUnrealMCPClassIndex::HandleBlueprintPreCompile);
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FUnrealMCPClassIndex::HandleBlueprintCompiled);
+    }
+
+    bInitialized = true;
+    Invalidate();
+}
+
+void FUnrealMCPClassIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    CompilingBlueprints.Reset();
+
+    bInitialized = false;
+    Invalidate();
+}
+
+UClass* FUnrealMCPClassIndex::FindClass(const FString& InClassName, const UClass* RequiredBase)
+{
+    FString ClassName = InClassName;
+    ClassName.TrimStartAndEndInline();
+    if (ClassName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    if (ClassName.StartsWith(TEXT("/")))
+    {
+        UClass* Class = FindObject<UClass>(nullptr, *ClassName);
+        if (!Class)
+        {
+            // Blueprint class paths load their package; /Script paths only resolve loaded modules
+            Class = StaticLoadClass(RequiredBase ? const_cast<UClass*>(RequiredBase) : UObject::StaticClass(), nullptr, *ClassName);
+        }
+        return Class && PassesBase(Class, RequiredBase) ? Class : nullptr;
+    }
+
+    EnsureBuilt();
+
+    if (UClass* Class = FindIndexed(ClassName.ToLower(), RequiredBase))
+    {
+        return Class;
+    }
+
+    FString Stripped;
+    if (StripCppPrefix(ClassName, Stripped))
+    {
+        if (UClass* Class = FindIndexed(Stripped.ToLower(), RequiredBase))
+        {
+            return Class;
+        }
+    }
+
+    return FindUnindexed(ClassName, RequiredBase);
+}
+
+int32 FUnrealMCPClassIndex::Num()
+{
+    EnsureBuilt();
+    return NumClasses;
+}
+
+void FUnrealMCPClassIndex::Invalidate()
+{
+    ClassesByName.Reset();
+    NumClasses = 0;
+    bDirty = true;
+}
+
+void FUnrealMCPClassIndex::EnsureBuilt()
+{
+    if (!bDirty)
+    {
+        return;
+    }
+
+    ClassesByName.Reset();
+    NumClasses = 0;
+    for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+    {
+        AddClass(*ClassIt);
+    }
+    bDirty = false;
+}
+
+void FUnrealMCPClassIndex::AddClass(UClass* Class)
+{
+    if (!IsIndexableClass(Class))
+    {
+        return;
+    }
+
+    const FString Key = Class->GetName().ToLower();
+    TArray<TWeakObjectPtr<UClass>, TInlineAllocator<1>>& Entries = ClassesByName.FindOrAdd(Key);
+    if (Entries.Contains(Class))
+    {
+        return;
+    }
+    Entries.Add(Class);
+    ++NumClasses;
+
+    // "BP_Door" finds "BP_Door_C"
+    if (Key.EndsWith(TEXT("_c")) && Class->ClassGeneratedBy)
+    {
+        ClassesByName.FindOrAdd(Key.LeftChop(2)).AddUnique(Class);
+    }
+}
+
+UClass* FUnrealMCPClassIndex::FindIndexed(const FString& Key, const UClass* RequiredBase)
+{
+    TArray<TWeakObjectPtr<UClass>, TInlineAllocator<1>>* Entries = ClassesByName.Find(Key);
+    if (!Entries)
+    {
+        return nullptr;
+    }
+
+    UClass* Best = nullptr;
+    for (int32 Index = Entries->Num() - 1; Index >= 0; --Index)
+    {
+        UClass* Class = (*Entries)[Index].Get();
+        if (!Class || !IsIndexableClass(Class))
+        {
+            // Collected or superseded since it was indexed
+            Entries->RemoveAtSwap(Index);
+            continue;
+        }
+        if (!PassesBase(Class, RequiredBase))
+        {
+            continue;
+        }
+        // Native classes win over a blueprint class of the same name
+        if (!Best || (Class->HasAnyClassFlags(CLASS_Native) && !Best->HasAnyClassFlags(CLASS_Native)))
+        {
+            Best = Class;
+        }
+    }
+    return Best;
+}
+
+UClass* FUnrealMCPClassIndex::FindUnindexed(const FString& Name, const UClass* RequiredBase)
+{
+    // Classes created since the last build (newly loaded blueprint packages): FName-hashed lookups
+    TArray<FString, TInlineAllocator<3>> Candidates;
+    Candidates.Add(Name);
+    FString Stripped;
+    if (StripCppPrefix(Name, Stripped))
+    {
+        Candidates.Add(Stripped);
+    }
+    if (!Name.EndsWith(TEXT("_C")))
+    {
+        Candidates.Add(Name + TEXT("_C"));
+    }
+
+    for (const FString& Candidate : Candidates)
+    {
+        UClass* Class = FindFirstObject<UClass>(*Candidate, EFindFirstObjectOptions::NativeFirst);
+        if (Class && IsIndexableClass(Class) && PassesBase(Class, RequiredBase))
+        {
+            AddClass(Class);
+            return Class;
+        }
+    }
+    return nullptr;
+}
+
+void FUnrealMCPClassIndex::HandleModulesChanged(FName /*ModuleName*/, EModuleChangeReason Reason)
+{
+    if (Reason == EModuleChangeReason::ModuleLoaded)
+    {
+        Invalidate();
+    }
+}
+
+void FUnrealMCPClassIndex::HandleBlueprintPreCompile(UBlueprint* Blueprint)
+{
+    if (Blueprint)
+    {
+        CompilingBlueprints.AddUnique(Blueprint);
+    }
+}
+
+void FUnrealMCPClassIndex::HandleBlueprintCompiled()
+{
+    // A full rebuild is pending anyway; otherwise index just the classes the compile produced
+    if (!bDirty)
+    {
+        for (const TWeakObjectPtr<UBlueprint>& Blueprint : CompilingBlueprints)
+        {
+            if (Blueprint.IsValid())
+            {
+                AddClass(Blueprint->GeneratedClass);
+            }
+        }
+    }
+    CompilingBlueprints.Reset();
+}
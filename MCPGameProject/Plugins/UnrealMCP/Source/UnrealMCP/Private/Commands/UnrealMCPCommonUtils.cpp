@@ -1,4 +1,7 @@
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPPropertyPlans.h"
+#include "Commands/UnrealMCPReadLoads.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
@@ -33,82 +36,6 @@
 #include "Misc/PackageName.h"
 #include "Modules/ModuleManager.h"
 
-namespace
-{
-void AddBlueprintCandidatePath(TArray<FString>& OutCandidatePaths, const FString& InPath)
-{
-    FString Path = InPath;
-    Path.TrimStartAndEndInline();
-    if (Path.IsEmpty())
-    {
-        return;
-    }
-
-    if (Path.EndsWith(TEXT("_C")))
-    {
-        Path.LeftChopInline(2, EAllowShrinking::No);
-    }
-
-    OutCandidatePaths.AddUnique(Path);
-
-    if (!Path.Contains(TEXT(".")))
-    {
-        const FString AssetName = FPackageName::GetShortName(Path);
-        if (!AssetName.IsEmpty())
-        {
-            OutCandidatePaths.AddUnique(Path + TEXT(".") + AssetName);
-        }
-    }
-}
-
-UBlueprint* ResolveBlueprintFromObject(UObject* LoadedObject)
-{
-    if (!LoadedObject)
-    {
-        return nullptr;
-    }
-
-    if (UBlueprint* Blueprint = Cast<UBlueprint>(LoadedObject))
-    {
-        return Blueprint;
-    }
-
-    if (UClass* LoadedClass = Cast<UClass>(LoadedObject))
-    {
-        return Cast<UBlueprint>(LoadedClass->ClassGeneratedBy);
-    }
-
-    if (UWorld* LoadedWorld = Cast<UWorld>(LoadedObject))
-    {
-        if (ULevel* PersistentLevel = LoadedWorld->PersistentLevel)
-        {
-            if (ULevelScriptBlueprint* LevelScriptBlueprint = PersistentLevel->GetLevelScriptBlueprint())
-            {
-                return LevelScriptBlueprint;
-            }
-        }
-    }
-
-    if (ULevel* LoadedLevel = Cast<ULevel>(LoadedObject))
-    {
-        if (ULevelScriptBlueprint* LevelScriptBlueprint = LoadedLevel->GetLevelScriptBlueprint())
-        {
-            return LevelScriptBlueprint;
-        }
-    }
-
-    if (ALevelScriptActor* LoadedLevelScriptActor = Cast<ALevelScriptActor>(LoadedObject))
-    {
-        if (UClass* ActorClass = LoadedLevelScriptActor->GetClass())
-        {
-            return Cast<UBlueprint>(ActorClass->ClassGeneratedBy);
-        }
-    }
-
-    return nullptr;
-}
-}
-
 // JSON Utilities
 TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::CreateErrorResponse(const FString& Message)
 {
@@ -236,109 +163,10 @@ UBlueprint* FUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName)
 
 UBlueprint* FUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintName)
 {
-    FString SearchKey = BlueprintName;
-    SearchKey.TrimStartAndEndInline();
-    if (SearchKey.IsEmpty())
-    {
-        return nullptr;
-    }
-
-    TArray<FString> CandidatePaths;
-    if (SearchKey.StartsWith(TEXT("/")))
-    {
-        AddBlueprintCandidatePath(CandidatePaths, SearchKey);
-    }
-    else
-    {
-        AddBlueprintCandidatePath(CandidatePaths, TEXT("/Game/Blueprints/") + SearchKey);
-        AddBlueprintCandidatePath(CandidatePaths, TEXT("/Game/Widgets/") + SearchKey);
-        AddBlueprintCandidatePath(CandidatePaths, TEXT("/Game/Maps/") + SearchKey);
-        AddBlueprintCandidatePath(CandidatePaths, TEXT("/Game/") + SearchKey);
-    }
-
-    for (const FString& CandidatePath : CandidatePaths)
-    {
-        if (UObject* LoadedObject = UEditorAssetLibrary::LoadAsset(CandidatePath))
-        {
-            if (UBlueprint* Blueprint = ResolveBlueprintFromObject(LoadedObject))
-            {
-                return Blueprint;
-            }
-        }
-    }
-
-    const FString ShortName = SearchKey.StartsWith(TEXT("/")) ? FPackageName::GetShortName(SearchKey) : SearchKey;
-    if (ShortName.IsEmpty())
-    {
-        return nullptr;
-    }
-
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    FARFilter Filter;
-    // No PackagePaths filter: search all paths including plugin content (e.g. /AIPoint/, /Game/, etc.)
-    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-    Filter.bRecursivePaths = true;
-    Filter.bRecursiveClasses = true;
-
-    TArray<FAssetData> Assets;
-    AssetRegistryModule.Get().GetAssets(Filter, Assets);
-
-    for (const FAssetData& Asset : Assets)
-    {
-        if (!Asset.AssetName.ToString().Equals(ShortName, ESearchCase::IgnoreCase))
-        {
-            continue;
-        }
-
-        const FString ObjectPath = Asset.GetObjectPathString();
-        if (UObject* LoadedObject = UEditorAssetLibrary::LoadAsset(ObjectPath))
-        {
-            if (UBlueprint* Blueprint = ResolveBlueprintFromObject(LoadedObject))
-            {
-                return Blueprint;
-            }
-        }
-
-        if (UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath))
-        {
-            return Blueprint;
-        }
-    }
-
-    FARFilter WorldFilter;
-    WorldFilter.PackagePaths.Add(FName(TEXT("/Game")));
-    WorldFilter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
-    WorldFilter.bRecursivePaths = true;
-    WorldFilter.bRecursiveClasses = true;
-
-    TArray<FAssetData> WorldAssets;
-    AssetRegistryModule.Get().GetAssets(WorldFilter, WorldAssets);
-    for (const FAssetData& Asset : WorldAssets)
-    {
-        if (!Asset.AssetName.ToString().Equals(ShortName, ESearchCase::IgnoreCase))
-        {
-            continue;
-        }
-
-        const FString ObjectPath = Asset.GetObjectPathString();
-        if (UObject* LoadedObject = UEditorAssetLibrary::LoadAsset(ObjectPath))
-        {
-            if (UBlueprint* Blueprint = ResolveBlueprintFromObject(LoadedObject))
-            {
-                return Blueprint;
-            }
-        }
-
-        if (UWorld* LoadedWorld = LoadObject<UWorld>(nullptr, *ObjectPath))
-        {
-            if (UBlueprint* Blueprint = ResolveBlueprintFromObject(LoadedWorld))
-            {
-                return Blueprint;
-            }
-        }
-    }
-
-    return nullptr;
+    // Indexed name -> path resolution with a weak-pointer cache of resolved blueprints
+    UBlueprint* Blueprint = FUnrealMCPBlueprintIndex::Get().FindBlueprint(BlueprintName);
+    FUnrealMCPReadLoads::Get().Touch(Blueprint);
+    return Blueprint;
 }
 
 UEdGraph* FUnrealMCPCommonUtils::FindOrCreateEventGraph(UBlueprint* Blueprint)
@@ -723,290 +551,8 @@ UK2Node_Event* FUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, con
 bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                      const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
 {
-    if (!Object)
-    {
-        OutErrorMessage = TEXT("Invalid object");
-        return false;
-    }
-
-    FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property)
-    {
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
-        return false;
-    }
-
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
-    
-    // Handle different property types
-    if (Property->IsA<FBoolProperty>())
-    {
-        ((FBoolProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsBool());
-        return true;
-    }
-    else if (Property->IsA<FIntProperty>())
-    {
-        int32 IntValue = static_cast<int32>(Value->AsNumber());
-        FIntProperty* IntProperty = CastField<FIntProperty>(Property);
-        if (IntProperty)
-        {
-            IntProperty->SetPropertyValue_InContainer(Object, IntValue);
-            return true;
-        }
-    }
-    else if (Property->IsA<FFloatProperty>())
-    {
-        ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
-        return true;
-    }
-    else if (Property->IsA<FStrProperty>())
-    {
-        ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
-        return true;
-    }
-    else if (Property->IsA<FByteProperty>())
-    {
-        FByteProperty* ByteProp = CastField<FByteProperty>(Property);
-        UEnum* EnumDef = ByteProp ? ByteProp->GetIntPropertyEnum() : nullptr;
-        
-        // If this is a TEnumAsByte property (has associated enum)
-        if (EnumDef)
-        {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-                ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
-                      *PropertyName, ByteValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    uint8 ByteValue = FCString::Atoi(*EnumValueName);
-                    ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
-                          *PropertyName, *EnumValueName, ByteValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
-        }
-        else
-        {
-            // Regular byte property
-            uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-            ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-            return true;
-        }
-    }
-    else if (Property->IsA<FEnumProperty>())
-    {
-        FEnumProperty* EnumProp = CastField<FEnumProperty>(Property);
-        UEnum* EnumDef = EnumProp ? EnumProp->GetEnum() : nullptr;
-        FNumericProperty* UnderlyingNumericProp = EnumProp ? EnumProp->GetUnderlyingProperty() : nullptr;
-        
-        if (EnumDef && UnderlyingNumericProp)
-        {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                int64 EnumValue = static_cast<int64>(Value->AsNumber());
-                UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
-                      *PropertyName, EnumValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    int64 EnumValue = FCString::Atoi64(*EnumValueName);
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
-        }
-    }
-    else if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-    {
-        // Handle struct properties (e.g., FLinearColor, FVector, FRotator)
-        UScriptStruct* Struct = StructProp->Struct;
-
-        if (Struct == TBaseStructure<FLinearColor>::Get())
-        {
-            // Handle FLinearColor from JSON object
-            if (Value->Type == EJson::Object)
-            {
-                const TSharedPtr<FJsonObject>& JsonObj = Value->AsObject();
-                FLinearColor Color;
-
-                Color.R = JsonObj->GetNumberField(TEXT("R"));
-                Color.G = JsonObj->GetNumberField(TEXT("G"));
-                Color.B = JsonObj->GetNumberField(TEXT("B"));
-                Color.A = JsonObj->HasField(TEXT("A")) ? JsonObj->GetNumberField(TEXT("A")) : 1.0f;
-
-                StructProp->CopyCompleteValue(PropertyAddr, &Color);
-
-                UE_LOG(LogTemp, Display, TEXT("Setting FLinearColor property %s to RGBA(%.2f, %.2f, %.2f, %.2f)"),
-                      *PropertyName, Color.R, Color.G, Color.B, Color.A);
-                return true;
-            }
-        }
-        else if (Struct == TBaseStructure<FVector>::Get())
-        {
-            // Handle FVector from JSON object or array
-            if (Value->Type == EJson::Object)
-            {
-                const TSharedPtr<FJsonObject>& JsonObj = Value->AsObject();
-                FVector Vec;
-
-                Vec.X = JsonObj->GetNumberField(TEXT("X"));
-                Vec.Y = JsonObj->GetNumberField(TEXT("Y"));
-                Vec.Z = JsonObj->GetNumberField(TEXT("Z"));
-
-                StructProp->CopyCompleteValue(PropertyAddr, &Vec);
-                return true;
-            }
-            else if (Value->Type == EJson::Array)
-            {
-                const TArray<TSharedPtr<FJsonValue>>& JsonArray = Value->AsArray();
-                if (JsonArray.Num() >= 3)
-                {
-                    FVector Vec;
-                    Vec.X = JsonArray[0]->AsNumber();
-                    Vec.Y = JsonArray[1]->AsNumber();
-                    Vec.Z = JsonArray[2]->AsNumber();
-
-                    StructProp->CopyCompleteValue(PropertyAddr, &Vec);
-                    return true;
-                }
-            }
-        }
-        else if (Struct == TBaseStructure<FRotator>::Get())
-        {
-            // Handle FRotator from JSON object or array
-            if (Value->Type == EJson::Object)
-            {
-                const TSharedPtr<FJsonObject>& JsonObj = Value->AsObject();
-                FRotator Rot;
-
-                Rot.Pitch = JsonObj->GetNumberField(TEXT("Pitch"));
-                Rot.Yaw = JsonObj->GetNumberField(TEXT("Yaw"));
-                Rot.Roll = JsonObj->GetNumberField(TEXT("Roll"));
-
-                StructProp->CopyCompleteValue(PropertyAddr, &Rot);
-                return true;
-            }
-            else if (Value->Type == EJson::Array)
-            {
-                const TArray<TSharedPtr<FJsonValue>>& JsonArray = Value->AsArray();
-                if (JsonArray.Num() >= 3)
-                {
-                    FRotator Rot;
-                    Rot.Pitch = JsonArray[0]->AsNumber();
-                    Rot.Yaw = JsonArray[1]->AsNumber();
-                    Rot.Roll = JsonArray[2]->AsNumber();
-
-                    StructProp->CopyCompleteValue(PropertyAddr, &Rot);
-                    return true;
-                }
-            }
-        }
-
-        OutErrorMessage = FString::Printf(TEXT("Unsupported struct type: %s for property %s"),
-                                        *Struct->GetName(), *PropertyName);
-        return false;
-    }
-
-    OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"),
-                                    *Property->GetClass()->GetName(), *PropertyName);
-    return false;
+    // Lookup and type dispatch are cached per class and property
+    return FUnrealMCPPropertyPlans::Get().SetProperty(Object, PropertyName, Value, OutErrorMessage);
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::CheckUnknownParams(
@@ -1,5 +1,16 @@
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPActorIndex.h"
+#include "Commands/UnrealMCPActorQuery.h"
+#include "Commands/UnrealMCPAssetQuery.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPFunctionPlans.h"
+#include "Commands/UnrealMCPLevelChangeFeed.h"
+#include "Commands/UnrealMCPPropertyPlans.h"
+#include "Commands/UnrealMCPReadLoads.h"
+#include "Commands/UnrealMCPSpatialIndex.h"
+#include "Commands/UnrealMCPWorldPartitionActors.h"
+#include "ConvexVolume.h"
 #include "Editor.h"
 #include "FileHelpers.h"
 #include "EditorViewportClient.h"
@@ -10,6 +21,10 @@
 #include "Misc/FileHelper.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Selection.h"
+#include "Engine/Level.h"
+#include "AI/NavigationSystemBase.h"
+#include "ScopedTransaction.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/DirectionalLight.h"
@@ -17,6 +32,9 @@
 #include "Engine/SpotLight.h"
 #include "Camera/CameraActor.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "EditorAssetLibrary.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "UObject/UObjectIterator.h"
@@ -26,6 +44,8 @@
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/DataAsset.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "JsonObjectConverter.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -71,6 +91,519 @@ FDirtyPackageStats CollectDirtyPackageStats()
     return Stats;
 }
 
+const int32 DefaultActorPageSize = 1000;
+const int32 MaxActorPageSize = 10000;
+
+/** Sort key for get_actors_in_level pages: level package, then actor name, both lexical. */
+struct FActorPageKey
+{
+    FName LevelName;
+    FName ActorName;
+
+    bool operator<(const FActorPageKey& Other) const
+    {
+        const int32 LevelOrder = LevelName.Compare(Other.LevelName);
+        return LevelOrder != 0 ? LevelOrder < 0 : ActorName.Compare(Other.ActorName) < 0;
+    }
+};
+
+FActorPageKey MakeActorPageKey(const AActor* Actor)
+{
+    const ULevel* Level = Actor->GetLevel();
+    return {Level ? Level->GetOutermost()->GetFName() : NAME_None, Actor->GetFName()};
+}
+
+// '|' is not allowed in object or package names, so it cannot be ambiguous
+FString EncodeActorCursor(const FActorPageKey& Key)
+{
+    return Key.LevelName.ToString() + TEXT("|") + Key.ActorName.ToString();
+}
+
+bool DecodeActorCursor(const FString& Cursor, FActorPageKey& OutKey)
+{
+    FString LevelName, ActorName;
+    if (!Cursor.Split(TEXT("|"), &LevelName, &ActorName) || ActorName.IsEmpty())
+    {
+        return false;
+    }
+    OutKey = {FName(*LevelName), FName(*ActorName)};
+    return true;
+}
+
+FString MakeActorSnapshotToken(const UWorld* World)
+{
+    return FString::Printf(TEXT("%s:%llu"), World ? *World->GetName() : TEXT("None"),
+        static_cast<unsigned long long>(FUnrealMCPActorIndex::Get().GetGeneration()));
+}
+
+const int32 DefaultSpatialQueryLimit = 1000;
+
+/** Filter, projection and result cap shared by the spatial query commands. */
+struct FSpatialQueryOptions
+{
+    FMCPActorFilter Filter;
+    EMCPActorFields Fields = EMCPActorFields::Default;
+    FMCPActorLayout Layout;
+    int32 Limit = DefaultSpatialQueryLimit;
+};
+
+bool ParseSpatialQueryOptions(const TSharedPtr<FJsonObject>& Params, FSpatialQueryOptions& OutOptions, FString& OutError)
+{
+    if (!FUnrealMCPActorQuery::ParseFilter(Params, GWorld, OutOptions.Filter, OutError) ||
+        !FUnrealMCPActorQuery::ParseFields(Params, OutOptions.Fields, OutError) ||
+        !FUnrealMCPActorQuery::ParseLayout(Params, OutOptions.Layout, OutError))
+    {
+        return false;
+    }
+
+    int32 Limit = DefaultSpatialQueryLimit;
+    if (Params->TryGetNumberField(TEXT("limit"), Limit))
+    {
+        OutOptions.Limit = FMath::Max(1, Limit);
+    }
+
+    bool bRefresh = false;
+    if (Params->TryGetBoolField(TEXT("refresh"), bRefresh) && bRefresh)
+    {
+        FUnrealMCPSpatialIndex::Get().Invalidate();
+    }
+    return true;
+}
+
+TSet<FString> SpatialQueryParamKeys(std::initializer_list<const TCHAR*> CommandKeys)
+{
+    TSet<FString> Keys = FUnrealMCPActorQuery::GetQueryParamKeys();
+    Keys.Add(TEXT("limit"));
+    Keys.Add(TEXT("refresh"));
+    for (const TCHAR* Key : CommandKeys)
+    {
+        Keys.Add(Key);
+    }
+    return Keys;
+}
+
+/** Collects filtered, projected actors from a spatial query, stopping at the limit. */
+struct FSpatialQueryCollector
+{
+    const FSpatialQueryOptions& Options;
+    TArray<TSharedPtr<FJsonValue>> Actors;
+    FMCPActorColumnWriter Columns;
+    bool bTruncated = false;
+
+    explicit FSpatialQueryCollector(const FSpatialQueryOptions& InOptions)
+        : Options(InOptions)
+        , Columns(InOptions.Fields, InOptions.Layout.Encoding)
+    {
+    }
+
+    int32 Num() const
+    {
+        return Options.Layout.Layout == EMCPActorLayout::Columnar ? Columns.Num() : Actors.Num();
+    }
+
+    void Visit(AActor* Actor, const FBox& /*Bounds*/)
+    {
+        if (!Options.Filter.Matches(Actor))
+        {
+            return;
+        }
+        if (Num() >= Options.Limit)
+        {
+            bTruncated = true;
+            return;
+        }
+        if (Options.Layout.Layout == EMCPActorLayout::Columnar)
+        {
+            Columns.Add(Actor);
+        }
+        else
+        {
+            Actors.Add(MakeShared<FJsonValueObject>(FUnrealMCPActorQuery::ActorToJson(Actor, Options.Fields)));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ToResult()
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetNumberField(TEXT("count"), Num());
+        ResultObj->SetBoolField(TEXT("truncated"), bTruncated);
+        if (Options.Layout.Layout == EMCPActorLayout::Columnar)
+        {
+            Columns.WriteTo(*ResultObj);
+        }
+        else
+        {
+            ResultObj->SetArrayField(TEXT("actors"), Actors);
+        }
+        return ResultObj;
+    }
+};
+
+bool TryGetVectorParam(const TSharedPtr<FJsonObject>& Params, const FString& FieldName, FVector& OutVector)
+{
+    const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
+    if (!Params->TryGetArrayField(FieldName, JsonArray) || JsonArray->Num() < 3)
+    {
+        return false;
+    }
+    OutVector = FUnrealMCPCommonUtils::GetVectorFromJson(Params, FieldName);
+    return true;
+}
+
+// Exact object name: labels are neither unique nor stable, and an editing command must not hit a
+// different actor than the caller named. With bMatchLabel (the commands' match_label param) a
+// label is accepted too, but only when exactly one loaded actor carries it. Loaded actors first;
+// on World Partition maps an unloaded actor is loaded (and pinned) only here, by exact name,
+// package path or GUID, for the commands that edit it; read-only commands never pull cells in.
+AActor* FindActorForEdit(const FString& Name, bool bMatchLabel, FString& OutError)
+{
+    FUnrealMCPActorIndex& ActorIndex = FUnrealMCPActorIndex::Get();
+    if (AActor* Actor = ActorIndex.FindByName(GWorld, Name))
+    {
+        return Actor;
+    }
+
+    if (bMatchLabel)
+    {
+        bool bAmbiguous = false;
+        AActor* Actor = ActorIndex.FindByLabel(GWorld, Name, &bAmbiguous);
+        if (bAmbiguous)
+        {
+            OutError = FString::Printf(TEXT("Several actors are labelled '%s'; pass the actor's object name"), *Name);
+            return nullptr;
+        }
+        if (Actor)
+        {
+            return Actor;
+        }
+    }
+
+    AActor* Actor = FUnrealMCPWorldPartitionActors::Get().ResolveForEdit(GWorld, Name, OutError);
+    if (!Actor && OutError.IsEmpty())
+    {
+        OutError = FString::Printf(TEXT("Actor not found: %s"), *Name);
+    }
+    return Actor;
+}
+
+bool GetMatchLabelParam(const TSharedPtr<FJsonObject>& Params)
+{
+    bool bMatchLabel = false;
+    Params->TryGetBoolField(TEXT("match_label"), bMatchLabel);
+    return bMatchLabel;
+}
+
+const int32 DefaultDescriptorPageSize = 1000;
+const int32 MaxDescriptorPageSize = 10000;
+
+const int32 DefaultAssetPageSize = 500;
+const int32 MaxAssetPageSize = 10000;
+
+const int32 DefaultBulkReadPageSize = 100;
+const int32 MaxBulkReadPageSize = 1000;
+const double DefaultBulkReadBudgetSeconds = 20.0;
+const double MaxBulkReadBudgetSeconds = 50.0;
+// Game-thread slice given to the async loader between passes over the finished loads
+const double BulkReadLoadSliceSeconds = 0.01;
+
+// Properties of Target as get_data_asset reports them: the full dump, or only the value at PropertyPath
+bool ReadAssetProperties(UObject* Target, const FString& PropertyPath, TSharedPtr<FJsonObject>& OutProps, FString& OutError)
+{
+    const int64 CheckFlags = 0;
+    const int64 SkipFlags = CPF_Transient;
+
+    OutProps = MakeShared<FJsonObject>();
+    if (PropertyPath.IsEmpty())
+    {
+        FJsonObjectConverter::UStructToJsonObject(Target->GetClass(), Target, OutProps.ToSharedRef(), CheckFlags, SkipFlags);
+        return true;
+    }
+
+    FString PathError;
+    TSharedPtr<FJsonValue> Value = FUnrealMCPPropertyPlans::Get().ReadPath(Target, PropertyPath, SkipFlags, PathError);
+    if (!Value.IsValid())
+    {
+        OutError = FString::Printf(TEXT("%s (asset class '%s')"), *PathError, *Target->GetClass()->GetName());
+        return false;
+    }
+    OutProps->SetField(PropertyPath, Value);
+    return true;
+}
+
+// Guids from a JSON string array; false (with OutError) on an unparsable entry
+bool ParseGuidArray(const TArray<TSharedPtr<FJsonValue>>& Values, TArray<FGuid>& OutGuids, FString& OutError)
+{
+    for (const TSharedPtr<FJsonValue>& Value : Values)
+    {
+        const FString Text = Value.IsValid() ? Value->AsString() : FString();
+        FGuid Guid;
+        if (!FGuid::Parse(Text, Guid))
+        {
+            OutError = FString::Printf(TEXT("Invalid actor guid: '%s'"), *Text);
+            return false;
+        }
+        OutGuids.Add(Guid);
+    }
+    return true;
+}
+
+TArray<TSharedPtr<FJsonValue>> GuidsToJson(const TArray<FGuid>& Guids)
+{
+    TArray<TSharedPtr<FJsonValue>> Values;
+    Values.Reserve(Guids.Num());
+    for (const FGuid& Guid : Guids)
+    {
+        Values.Add(MakeShared<FJsonValueString>(Guid.ToString(EGuidFormats::DigitsWithHyphens)));
+    }
+    return Values;
+}
+
+/**
+ * One set_actor_transforms edit. Absolute mode overwrites the given components; relative mode
+ * composes matrix -> rotate -> offset -> scale onto each actor. Snapping runs last in both modes.
+ * All composition goes through FTransform, whose vectorized implementation keeps the per-actor
+ * math in VectorRegister form.
+ */
+struct FBatchTransformEdit
+{
+    bool bAbsolute = false;
+    TOptional<FVector> Location;
+    TOptional<FQuat> Rotation;
+    TOptional<FVector> Scale;
+
+    TOptional<FTransform> Matrix;
+    TOptional<FQuat> Rotate;
+    TOptional<FVector> Offset;
+    TOptional<FVector> ScaleBy;
+    TOptional<FVector> Pivot;
+
+    FVector LocationSnap = FVector::ZeroVector;
+    double RotationSnap = 0.0;
+
+    FTransform Apply(const FTransform& Current) const
+    {
+        FTransform Result = Current;
+        if (bAbsolute)
+        {
+            if (Location.IsSet())
+            {
+                Result.SetLocation(Location.GetValue());
+            }
+            if (Rotation.IsSet())
+            {
+                Result.SetRotation(Rotation.GetValue());
+            }
+            if (Scale.IsSet())
+            {
+                Result.SetScale3D(Scale.GetValue());
+            }
+        }
+        else
+        {
+            if (Matrix.IsSet())
+            {
+                Result = Result * AboutPivot(Matrix.GetValue(), Pivot.Get(FVector::ZeroVector));
+            }
+            if (Rotate.IsSet())
+            {
+                // Around the shared pivot if given, otherwise in place
+                Result = Result * AboutPivot(FTransform(Rotate.GetValue()), Pivot.Get(Result.GetLocation()));
+            }
+            if (Offset.IsSet())
+            {
+                Result.AddToTranslation(Offset.GetValue());
+            }
+            if (ScaleBy.IsSet())
+            {
+                Result.MultiplyScale3D(ScaleBy.GetValue());
+            }
+        }
+
+        if (!LocationSnap.IsZero())
+        {
+            const FVector Snapped = Result.GetLocation();
+            Result.SetLocation(FVector(
+                FMath::GridSnap(Snapped.X, LocationSnap.X),
+                FMath::GridSnap(Snapped.Y, LocationSnap.Y),
+                FMath::GridSnap(Snapped.Z, LocationSnap.Z)));
+        }
+        if (RotationSnap > 0.0)
+        {
+            Result.SetRotation(Result.Rotator().GridSnap(FRotator(RotationSnap, RotationSnap, RotationSnap)).Quaternion());
+        }
+        return Result;
+    }
+
+    static FTransform AboutPivot(const FTransform& Delta, const FVector& PivotPoint)
+    {
+        return FTransform(-PivotPoint) * Delta * FTransform(PivotPoint);
+    }
+};
+
+bool ParseBatchTransformEdit(const TSharedPtr<FJsonObject>& Params, FBatchTransformEdit& OutEdit, FString& OutError)
+{
+    FString Mode = TEXT("relative");
+    Params->TryGetStringField(TEXT("mode"), Mode);
+    if (Mode != TEXT("relative") && Mode != TEXT("absolute"))
+    {
+        OutError = FString::Printf(TEXT("Unknown mode '%s'. Valid modes: relative, absolute"), *Mode);
+        return false;
+    }
+    OutEdit.bAbsolute = Mode == TEXT("absolute");
+
+    FVector Vector;
+    if (OutEdit.bAbsolute)
+    {
+        if (TryGetVectorParam(Params, TEXT("location"), Vector))
+        {
+            OutEdit.Location = Vector;
+        }
+        if (Params->HasField(TEXT("rotation")))
+        {
+            OutEdit.Rotation = FUnrealMCPCommonUtils::GetRotatorFromJson(Params, TEXT("rotation")).Quaternion();
+        }
+        if (TryGetVectorParam(Params, TEXT("scale"), Vector))
+        {
+            OutEdit.Scale = Vector;
+        }
+        for (const TCHAR* RelativeKey : {TEXT("matrix"), TEXT("rotate"), TEXT("offset"), TEXT("scale_by"), TEXT("pivot")})
+        {
+            if (Params->HasField(RelativeKey))
+            {
+                OutError = FString::Printf(TEXT("'%s' is only valid in relative mode"), RelativeKey);
+                return false;
+            }
+        }
+    }
+    else
+    {
+        for (const TCHAR* AbsoluteKey : {TEXT("location"), TEXT("rotation"), TEXT("scale")})
+        {
+            if (Params->HasField(AbsoluteKey))
+            {
+                OutError = FString::Printf(TEXT("'%s' is only valid in absolute mode (use offset / rotate / scale_by)"), AbsoluteKey);
+                return false;
+            }
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* MatrixArray = nullptr;
+        if (Params->TryGetArrayField(TEXT("matrix"), MatrixArray))
+        {
+            if (MatrixArray->Num() != 16)
+            {
+                OutError = TEXT("'matrix' must hold 16 numbers (row-major 4x4, translation in the last row)");
+                return false;
+            }
+            FMatrix Matrix;
+            for (int32 Index = 0; Index < 16; ++Index)
+            {
+                Matrix.M[Index / 4][Index % 4] = (*MatrixArray)[Index]->AsNumber();
+            }
+            OutEdit.Matrix = FTransform(Matrix);
+        }
+        if (Params->HasField(TEXT("rotate")))
+        {
+            OutEdit.Rotate = FUnrealMCPCommonUtils::GetRotatorFromJson(Params, TEXT("rotate")).Quaternion();
+        }
+        if (TryGetVectorParam(Params, TEXT("offset"), Vector))
+        {
+            OutEdit.Offset = Vector;
+        }
+        if (TryGetVectorParam(Params, TEXT("scale_by"), Vector))
+        {
+            OutEdit.ScaleBy = Vector;
+        }
+        if (TryGetVectorParam(Params, TEXT("pivot"), Vector))
+        {
+            OutEdit.Pivot = Vector;
+        }
+    }
+
+    double UniformSnap = 0.0;
+    if (TryGetVectorParam(Params, TEXT("snap"), Vector))
+    {
+        OutEdit.LocationSnap = Vector.GetAbs();
+    }
+    else if (Params->TryGetNumberField(TEXT("snap"), UniformSnap))
+    {
+        OutEdit.LocationSnap = FVector(FMath::Abs(UniformSnap));
+    }
+    Params->TryGetNumberField(TEXT("snap_rotation"), OutEdit.RotationSnap);
+
+    const bool bHasEdit = OutEdit.Location || OutEdit.Rotation || OutEdit.Scale || OutEdit.Matrix || OutEdit.Rotate ||
+        OutEdit.Offset || OutEdit.ScaleBy || !OutEdit.LocationSnap.IsZero() || OutEdit.RotationSnap > 0.0;
+    if (!bHasEdit)
+    {
+        OutError = TEXT("Nothing to do: give location/rotation/scale (absolute), matrix/rotate/offset/scale_by (relative), or snap");
+        return false;
+    }
+    return true;
+}
+
+const int32 MaxSpawnBatchSize = 10000;
+
+enum class ESpawnInstancing : uint8
+{
+    None,
+    ISM,
+    HISM,
+};
+
+/** One validated spawn_actors entry. */
+struct FSpawnRequest
+{
+    UClass* Class = nullptr;
+    UStaticMesh* Mesh = nullptr;
+    FName Name;
+    FName Folder;
+    FTransform Transform;
+};
+
+/**
+ * One actor holding an (H)ISM component with an instance per transform. The actor sits at the
+ * centroid so its gizmo lands among the instances; instances are added in world space.
+ */
+AActor* SpawnInstancedMeshActor(UWorld* World, UStaticMesh* Mesh, const TArray<FTransform>& Transforms,
+    bool bHierarchical, const FString& NamePrefix, FName Folder)
+{
+    FVector Centroid = FVector::ZeroVector;
+    for (const FTransform& Transform : Transforms)
+    {
+        Centroid += Transform.GetLocation();
+    }
+    Centroid /= FMath::Max(1, Transforms.Num());
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = FName(*FString::Printf(TEXT("%s_%s"), *NamePrefix, *Mesh->GetName()));
+    SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+    SpawnParams.ObjectFlags |= RF_Transactional;
+    AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Centroid), SpawnParams);
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    UClass* ComponentClass = bHierarchical
+        ? UHierarchicalInstancedStaticMeshComponent::StaticClass()
+        : UInstancedStaticMeshComponent::StaticClass();
+    UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(Actor, ComponentClass, TEXT("Instances"), RF_Transactional);
+    Instances->SetMobility(EComponentMobility::Static);
+    Instances->SetStaticMesh(Mesh);
+    Instances->SetWorldTransform(FTransform(Centroid));
+    Actor->SetRootComponent(Instances);
+    Actor->AddInstanceComponent(Instances);
+    Instances->RegisterComponent();
+    Instances->AddInstances(Transforms, false, true);
+
+    // Requested names are only a hint; label with the name actually granted so labels stay unique
+    Actor->SetActorLabel(Actor->GetName());
+    if (!Folder.IsNone())
+    {
+        Actor->SetFolderPath(Folder);
+    }
+    return Actor;
+}
+
 void ScheduleEditorExit(const bool bForceExit, const float DelaySeconds)
 {
     FTSTicker::GetCoreTicker().AddTicker(
@@ -103,6 +636,40 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     {
         return HandleFindActorsByName(Params);
     }
+    else if (CommandType == TEXT("get_level_changes"))
+    {
+        return HandleGetLevelChanges(Params);
+    }
+    // Spatial queries
+    else if (CommandType == TEXT("find_actors_in_box"))
+    {
+        return HandleFindActorsInBox(Params);
+    }
+    else if (CommandType == TEXT("find_actors_in_sphere"))
+    {
+        return HandleFindActorsInSphere(Params);
+    }
+    else if (CommandType == TEXT("find_actors_in_frustum"))
+    {
+        return HandleFindActorsInFrustum(Params);
+    }
+    else if (CommandType == TEXT("find_nearest_actors"))
+    {
+        return HandleFindNearestActors(Params);
+    }
+    // World Partition descriptor queries
+    else if (CommandType == TEXT("find_world_partition_actors"))
+    {
+        return HandleFindWorldPartitionActors(Params);
+    }
+    else if (CommandType == TEXT("load_world_partition_actors"))
+    {
+        return HandleLoadWorldPartitionActors(Params);
+    }
+    else if (CommandType == TEXT("release_world_partition_actors"))
+    {
+        return HandleReleaseWorldPartitionActors(Params);
+    }
     else if (CommandType == TEXT("spawn_actor") || CommandType == TEXT("create_actor"))
     {
         if (CommandType == TEXT("create_actor"))
@@ -111,6 +678,10 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
         }
         return HandleSpawnActor(Params);
     }
+    else if (CommandType == TEXT("spawn_actors"))
+    {
+        return HandleSpawnActors(Params);
+    }
     else if (CommandType == TEXT("delete_actor"))
     {
         return HandleDeleteActor(Params);
@@ -119,6 +690,10 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     {
         return HandleSetActorTransform(Params);
     }
+    else if (CommandType == TEXT("set_actor_transforms"))
+    {
+        return HandleSetActorTransforms(Params);
+    }
     else if (CommandType == TEXT("get_actor_properties"))
     {
         return HandleGetActorProperties(Params);
@@ -171,53 +746,736 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     {
         return HandleFindAssets(Params);
     }
+    else if (CommandType == TEXT("query_assets"))
+    {
+        return HandleQueryAssets(Params);
+    }
+    else if (CommandType == TEXT("get_assets_bulk"))
+    {
+        return HandleGetAssetsBulk(Params);
+    }
 
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
 {
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> ActorArray;
-    for (AActor* Actor : AllActors)
+    TSet<FString> KnownKeys = FUnrealMCPActorQuery::GetQueryParamKeys();
+    KnownKeys.Append({TEXT("limit"), TEXT("cursor"), TEXT("snapshot")});
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, KnownKeys))
+    {
+        return Err;
+    }
+
+    FMCPActorFilter Filter;
+    EMCPActorFields Fields;
+    FMCPActorLayout Layout;
+    FString Error;
+    if (!FUnrealMCPActorQuery::ParseFilter(Params, GWorld, Filter, Error) ||
+        !FUnrealMCPActorQuery::ParseFields(Params, Fields, Error) ||
+        !FUnrealMCPActorQuery::ParseLayout(Params, Layout, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    int32 Limit = DefaultActorPageSize;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Clamp(Limit, 1, MaxActorPageSize);
+
+    FActorPageKey CursorKey;
+    FString Cursor;
+    const bool bHasCursor = Params->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty();
+    if (bHasCursor && !DecodeActorCursor(Cursor, CursorKey))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Malformed cursor: %s"), *Cursor));
+    }
+
+    // Keyset pagination: each page resumes after the last key returned, so actors added or deleted
+    // between pages never shift the remaining ones or cause duplicates. Only the Limit + 1 smallest
+    // keys after the cursor are kept (a bounded max-heap; the extra one tells whether a page follows),
+    // so a page costs one scan plus O(N log Limit) instead of sorting the whole tail.
+    using FActorPageEntry = TPair<FActorPageKey, AActor*>;
+    auto LargestKeyFirst = [](const FActorPageEntry& A, const FActorPageEntry& B) { return B.Key < A.Key; };
+    const int32 KeepCount = Limit + 1;
+    TArray<FActorPageEntry> Candidates;
+    Candidates.Reserve(KeepCount + 1);
+    int32 Total = 0;
+    FUnrealMCPActorQuery::ForEachActor(GWorld, Filter, [&](AActor* Actor)
+    {
+        ++Total;
+        const FActorPageKey Key = MakeActorPageKey(Actor);
+        if (bHasCursor && !(CursorKey < Key))
+        {
+            return;
+        }
+        if (Candidates.Num() == KeepCount)
+        {
+            if (!(Key < Candidates.HeapTop().Key))
+            {
+                return;
+            }
+            Candidates.HeapPopDiscard(LargestKeyFirst, EAllowShrinking::No);
+        }
+        Candidates.HeapPush(FActorPageEntry(Key, Actor), LargestKeyFirst);
+    });
+    Candidates.Sort([](const FActorPageEntry& A, const FActorPageEntry& B)
+    {
+        return A.Key < B.Key;
+    });
+
+    const int32 PageCount = FMath::Min(Limit, Candidates.Num());
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    if (Layout.Layout == EMCPActorLayout::Columnar)
+    {
+        FMCPActorColumnWriter Columns(Fields, Layout.Encoding, PageCount);
+        for (int32 Index = 0; Index < PageCount; ++Index)
+        {
+            Columns.Add(Candidates[Index].Value);
+        }
+        Columns.WriteTo(*ResultObj);
+    }
+    else
+    {
+        TArray<TSharedPtr<FJsonValue>> ActorArray;
+        ActorArray.Reserve(PageCount);
+        for (int32 Index = 0; Index < PageCount; ++Index)
+        {
+            ActorArray.Add(MakeShared<FJsonValueObject>(FUnrealMCPActorQuery::ActorToJson(Candidates[Index].Value, Fields)));
+        }
+        ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    }
+    ResultObj->SetNumberField(TEXT("count"), PageCount);
+    ResultObj->SetNumberField(TEXT("total"), Total);
+    if (Candidates.Num() > PageCount)
+    {
+        ResultObj->SetStringField(TEXT("next_cursor"), EncodeActorCursor(Candidates[PageCount - 1].Key));
+    }
+
+    // Starting point for get_level_changes
+    ResultObj->SetNumberField(TEXT("revision"), FUnrealMCPLevelChangeFeed::Get().GetRevision());
+    ResultObj->SetStringField(TEXT("epoch"), FUnrealMCPLevelChangeFeed::Get().GetEpoch());
+
+    const FString Snapshot = MakeActorSnapshotToken(GWorld);
+    ResultObj->SetStringField(TEXT("snapshot"), Snapshot);
+    FString RequestSnapshot;
+    if (Params->TryGetStringField(TEXT("snapshot"), RequestSnapshot) && !RequestSnapshot.IsEmpty())
+    {
+        ResultObj->SetBoolField(TEXT("snapshot_changed"), RequestSnapshot != Snapshot);
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetLevelChanges(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+        {TEXT("since_revision"), TEXT("epoch"), TEXT("limit"), TEXT("fields"), TEXT("coalesce")}))
+    {
+        return Err;
+    }
+
+    double SinceValue = 0.0;
+    if (!Params->TryGetNumberField(TEXT("since_revision"), SinceValue) || SinceValue < 0.0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing or negative 'since_revision' (use the 'revision' from get_actors_in_level)"));
+    }
+    const uint64 SinceRevision = static_cast<uint64>(SinceValue);
+
+    EMCPActorFields Fields;
+    FString Error;
+    if (!FUnrealMCPActorQuery::ParseFields(Params, Fields, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    int32 Limit = DefaultActorPageSize;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Clamp(Limit, 1, MaxActorPageSize);
+    bool bCoalesce = true;
+    Params->TryGetBoolField(TEXT("coalesce"), bCoalesce);
+
+    const FUnrealMCPLevelChangeFeed& Feed = FUnrealMCPLevelChangeFeed::Get();
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("revision"), Feed.GetRevision());
+    ResultObj->SetStringField(TEXT("epoch"), Feed.GetEpoch());
+
+    FString Epoch;
+    const bool bEpochMismatch = Params->TryGetStringField(TEXT("epoch"), Epoch) && !Epoch.IsEmpty() && Epoch != Feed.GetEpoch();
+
+    TArray<FMCPLevelChange> Changes;
+    bool bHasMore = false;
+    if (bEpochMismatch || !Feed.GetChangesSince(SinceRevision, Limit, Changes, bHasMore))
+    {
+        ResultObj->SetBoolField(TEXT("resync_required"), true);
+        ResultObj->SetNumberField(TEXT("oldest_revision"), Feed.GetOldestResumableRevision());
+        ResultObj->SetArrayField(TEXT("changes"), TArray<TSharedPtr<FJsonValue>>());
+        return ResultObj;
+    }
+
+    // Net effect per actor within this page, in order of each actor's latest change
+    struct FNetChange
+    {
+        const FMCPLevelChange* Latest = nullptr;
+        bool bAdded = false;
+        bool bRemoved = false;
+        bool bModified = false;
+    };
+    TArray<FNetChange> NetChanges;
+    TMap<FObjectKey, int32> NetIndexByActor;
+    for (const FMCPLevelChange& Change : Changes)
+    {
+        int32 NetIndex = INDEX_NONE;
+        if (bCoalesce)
+        {
+            if (const int32* Existing = NetIndexByActor.Find(Change.ActorKey))
+            {
+                NetIndex = *Existing;
+            }
+        }
+        if (NetIndex == INDEX_NONE)
+        {
+            NetIndex = NetChanges.AddDefaulted();
+            NetIndexByActor.Add(Change.ActorKey, NetIndex);
+            NetChanges[NetIndex].bAdded = Change.Type == EMCPLevelChangeType::Added;
+        }
+
+        FNetChange& Net = NetChanges[NetIndex];
+        Net.Latest = &Change;
+        Net.bRemoved = Change.Type == EMCPLevelChangeType::Removed;
+        Net.bModified |= Change.Type == EMCPLevelChangeType::Modified;
+    }
+    if (bCoalesce)
+    {
+        NetChanges.Sort([](const FNetChange& A, const FNetChange& B) { return A.Latest->Revision < B.Latest->Revision; });
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ChangeArray;
+    ChangeArray.Reserve(NetChanges.Num());
+    for (const FNetChange& Net : NetChanges)
+    {
+        // Created and destroyed within the window: nothing for the client to apply
+        if (bCoalesce && Net.bAdded && Net.bRemoved)
+        {
+            continue;
+        }
+
+        EMCPLevelChangeType Type = Net.Latest->Type;
+        if (bCoalesce)
+        {
+            Type = Net.bRemoved ? EMCPLevelChangeType::Removed
+                : Net.bAdded ? EMCPLevelChangeType::Added
+                : Net.bModified ? EMCPLevelChangeType::Modified
+                : EMCPLevelChangeType::Moved;
+        }
+
+        TSharedPtr<FJsonObject> ChangeObj = MakeShared<FJsonObject>();
+        ChangeObj->SetNumberField(TEXT("revision"), Net.Latest->Revision);
+        ChangeObj->SetStringField(TEXT("type"), FUnrealMCPLevelChangeFeed::ChangeTypeToString(Type));
+        ChangeObj->SetStringField(TEXT("name"), Net.Latest->Name);
+        ChangeObj->SetStringField(TEXT("path"), Net.Latest->Path);
+
+        const AActor* Actor = Net.Latest->Actor.Get();
+        if (Type != EMCPLevelChangeType::Removed && IsValid(Actor))
+        {
+            ChangeObj->SetObjectField(TEXT("actor"), FUnrealMCPActorQuery::ActorToJson(Actor, Fields));
+        }
+        ChangeArray.Add(MakeShared<FJsonValueObject>(ChangeObj));
+    }
+
+    ResultObj->SetBoolField(TEXT("resync_required"), false);
+    ResultObj->SetArrayField(TEXT("changes"), ChangeArray);
+    ResultObj->SetBoolField(TEXT("has_more"), bHasMore);
+    ResultObj->SetNumberField(TEXT("next_revision"), bHasMore ? Changes.Last().Revision : Feed.GetRevision());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Pattern;
+    if (!Params->TryGetStringField(TEXT("pattern"), Pattern))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
+    }
+    
+    TArray<AActor*> AllActors;
+    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    
+    TArray<TSharedPtr<FJsonValue>> MatchingActors;
+    for (AActor* Actor : AllActors)
+    {
+        if (Actor && Actor->GetName().Contains(Pattern))
+        {
+            MatchingActors.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
+        }
+    }
+    
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
+    
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindActorsInBox(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, SpatialQueryParamKeys({TEXT("min"), TEXT("max"), TEXT("center"), TEXT("extent")})))
+    {
+        return Err;
+    }
+
+    FBox Box(ForceInit);
+    FVector Min, Max, Center, Extent;
+    if (TryGetVectorParam(Params, TEXT("min"), Min) && TryGetVectorParam(Params, TEXT("max"), Max))
+    {
+        Box = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+    }
+    else if (TryGetVectorParam(Params, TEXT("center"), Center) && TryGetVectorParam(Params, TEXT("extent"), Extent))
+    {
+        Box = FBox::BuildAABB(Center, Extent.GetAbs());
+    }
+    else
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide either 'min' and 'max' or 'center' and 'extent' ([x, y, z] arrays)"));
+    }
+
+    FSpatialQueryOptions Options;
+    FString Error;
+    if (!ParseSpatialQueryOptions(Params, Options, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    FSpatialQueryCollector Collector(Options);
+    FUnrealMCPSpatialIndex::Get().QueryBox(GWorld, Box, [&Collector](AActor* Actor, const FBox& Bounds)
+    {
+        Collector.Visit(Actor, Bounds);
+    });
+    return Collector.ToResult();
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindActorsInSphere(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, SpatialQueryParamKeys({TEXT("center"), TEXT("radius")})))
+    {
+        return Err;
+    }
+
+    FVector Center;
+    double Radius = 0.0;
+    if (!TryGetVectorParam(Params, TEXT("center"), Center) || !Params->TryGetNumberField(TEXT("radius"), Radius) || Radius <= 0.0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'center' ([x, y, z]) or positive 'radius' parameter"));
+    }
+
+    FSpatialQueryOptions Options;
+    FString Error;
+    if (!ParseSpatialQueryOptions(Params, Options, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    FSpatialQueryCollector Collector(Options);
+    FUnrealMCPSpatialIndex::Get().QuerySphere(GWorld, Center, Radius, [&Collector](AActor* Actor, const FBox& Bounds)
+    {
+        Collector.Visit(Actor, Bounds);
+    });
+    return Collector.ToResult();
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindActorsInFrustum(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, SpatialQueryParamKeys({
+        TEXT("use_viewport"), TEXT("origin"), TEXT("rotation"), TEXT("fov"), TEXT("aspect_ratio"), TEXT("near"), TEXT("far")})))
+    {
+        return Err;
+    }
+
+    FVector Origin = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    double Fov = 90.0;
+    double AspectRatio = 16.0 / 9.0;
+    double NearDistance = 10.0;
+    double FarDistance = 100000.0;
+
+    bool bUseViewport = false;
+    Params->TryGetBoolField(TEXT("use_viewport"), bUseViewport);
+    if (bUseViewport)
+    {
+        FViewport* ActiveViewport = GEditor ? GEditor->GetActiveViewport() : nullptr;
+        FLevelEditorViewportClient* ViewportClient = ActiveViewport ? (FLevelEditorViewportClient*)ActiveViewport->GetClient() : nullptr;
+        if (!ViewportClient)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get active viewport"));
+        }
+        Origin = ViewportClient->GetViewLocation();
+        Rotation = ViewportClient->GetViewRotation();
+        Fov = ViewportClient->ViewFOV;
+        const FIntPoint Size = ActiveViewport->GetSizeXY();
+        if (Size.X > 0 && Size.Y > 0)
+        {
+            AspectRatio = static_cast<double>(Size.X) / Size.Y;
+        }
+    }
+    else
+    {
+        if (!TryGetVectorParam(Params, TEXT("origin"), Origin) || !Params->HasField(TEXT("rotation")))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'origin' and 'rotation', or set 'use_viewport'"));
+        }
+        Rotation = FUnrealMCPCommonUtils::GetRotatorFromJson(Params, TEXT("rotation"));
+    }
+    Params->TryGetNumberField(TEXT("fov"), Fov);
+    Params->TryGetNumberField(TEXT("aspect_ratio"), AspectRatio);
+    Params->TryGetNumberField(TEXT("near"), NearDistance);
+    Params->TryGetNumberField(TEXT("far"), FarDistance);
+    if (Fov <= 0.0 || Fov >= 180.0 || AspectRatio <= 0.0 || NearDistance < 0.0 || FarDistance <= NearDistance)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid frustum: need 0 < fov < 180, aspect_ratio > 0 and 0 <= near < far"));
+    }
+
+    FSpatialQueryOptions Options;
+    FString Error;
+    if (!ParseSpatialQueryOptions(Params, Options, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    // Outward-facing planes: a point is inside when every PlaneDot <= 0
+    const FRotationMatrix Axes(Rotation);
+    const FVector Forward = Axes.GetScaledAxis(EAxis::X);
+    const FVector Right = Axes.GetScaledAxis(EAxis::Y);
+    const FVector Up = Axes.GetScaledAxis(EAxis::Z);
+    const double TanX = FMath::Tan(FMath::DegreesToRadians(Fov) * 0.5);
+    const double TanY = TanX / AspectRatio;
+
+    TArray<FPlane> Planes;
+    Planes.Add(FPlane(Origin, (Right - Forward * TanX).GetSafeNormal()));
+    Planes.Add(FPlane(Origin, (-Right - Forward * TanX).GetSafeNormal()));
+    Planes.Add(FPlane(Origin, (Up - Forward * TanY).GetSafeNormal()));
+    Planes.Add(FPlane(Origin, (-Up - Forward * TanY).GetSafeNormal()));
+    Planes.Add(FPlane(Origin + Forward * NearDistance, -Forward));
+    Planes.Add(FPlane(Origin + Forward * FarDistance, Forward));
+    const FConvexVolume Frustum(Planes);
+
+    FBox BroadPhase(Origin, Origin);
+    const FVector FarCenter = Origin + Forward * FarDistance;
+    for (const double SignX : {-1.0, 1.0})
+    {
+        for (const double SignY : {-1.0, 1.0})
+        {
+            BroadPhase += FarCenter + Right * (SignX * FarDistance * TanX) + Up * (SignY * FarDistance * TanY);
+        }
+    }
+
+    FSpatialQueryCollector Collector(Options);
+    FUnrealMCPSpatialIndex::Get().QueryConvex(GWorld, Frustum, BroadPhase, [&Collector](AActor* Actor, const FBox& Bounds)
+    {
+        Collector.Visit(Actor, Bounds);
+    });
+    return Collector.ToResult();
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindNearestActors(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, SpatialQueryParamKeys({TEXT("point"), TEXT("count"), TEXT("max_distance")})))
+    {
+        return Err;
+    }
+
+    FVector Point;
+    if (!TryGetVectorParam(Params, TEXT("point"), Point))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'point' parameter ([x, y, z])"));
+    }
+
+    int32 Count = 10;
+    Params->TryGetNumberField(TEXT("count"), Count);
+    double MaxDistance = 0.0;
+    Params->TryGetNumberField(TEXT("max_distance"), MaxDistance);
+
+    FSpatialQueryOptions Options;
+    FString Error;
+    if (!ParseSpatialQueryOptions(Params, Options, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    Count = FMath::Clamp(Count, 1, Options.Limit);
+
+    TArray<TPair<AActor*, double>> Nearest;
+    FUnrealMCPSpatialIndex::Get().QueryNearest(GWorld, Point, Count, MaxDistance,
+        [&Options](AActor* Actor) { return Options.Filter.Matches(Actor); }, Nearest);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("count"), Nearest.Num());
+
+    if (Options.Layout.Layout == EMCPActorLayout::Columnar)
+    {
+        FMCPActorColumnWriter Columns(Options.Fields, Options.Layout.Encoding, Nearest.Num());
+        TArray<double> Distances;
+        Distances.Reserve(Nearest.Num());
+        for (const TPair<AActor*, double>& Entry : Nearest)
+        {
+            Columns.Add(Entry.Key);
+            Distances.Add(Entry.Value);
+        }
+        Columns.AddNumberColumn(TEXT("distance"), MoveTemp(Distances));
+        Columns.WriteTo(*ResultObj);
+        return ResultObj;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    ActorArray.Reserve(Nearest.Num());
+    for (const TPair<AActor*, double>& Entry : Nearest)
+    {
+        TSharedPtr<FJsonObject> ActorObj = FUnrealMCPActorQuery::ActorToJson(Entry.Key, Options.Fields);
+        ActorObj->SetNumberField(TEXT("distance"), Entry.Value);
+        ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
+    }
+    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindWorldPartitionActors(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+        {TEXT("class"), TEXT("name"), TEXT("min"), TEXT("max"), TEXT("center"), TEXT("extent"),
+         TEXT("data_layer"), TEXT("loaded"), TEXT("limit"), TEXT("cursor")}))
+    {
+        return Err;
+    }
+
+    if (!FUnrealMCPWorldPartitionActors::GetWorldPartition(GWorld))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("The editor world is not a World Partition map; use get_actors_in_level"));
+    }
+
+    FMCPActorDescFilter Filter;
+    FString ClassName;
+    if (Params->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
+    {
+        Filter.Class = FUnrealMCPActorQuery::ResolveActorClass(ClassName);
+        if (!Filter.Class)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor class: %s"), *ClassName));
+        }
+    }
+    Params->TryGetStringField(TEXT("name"), Filter.NamePattern);
+
+    FVector Min, Max, Center, Extent;
+    if (TryGetVectorParam(Params, TEXT("min"), Min) && TryGetVectorParam(Params, TEXT("max"), Max))
+    {
+        Filter.Bounds = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+    }
+    else if (TryGetVectorParam(Params, TEXT("center"), Center) && TryGetVectorParam(Params, TEXT("extent"), Extent))
+    {
+        Filter.Bounds = FBox::BuildAABB(Center, Extent.GetAbs());
+    }
+
+    FString DataLayer;
+    if (Params->TryGetStringField(TEXT("data_layer"), DataLayer) && !DataLayer.IsEmpty())
+    {
+        TSet<FName> InstanceNames;
+        if (!FUnrealMCPWorldPartitionActors::ResolveDataLayer(GWorld, DataLayer, InstanceNames))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown data layer: %s"), *DataLayer));
+        }
+        Filter.DataLayerInstances = MoveTemp(InstanceNames);
+    }
+
+    bool bLoaded = false;
+    if (Params->TryGetBoolField(TEXT("loaded"), bLoaded))
+    {
+        Filter.bLoaded = bLoaded;
+    }
+
+    int32 Limit = DefaultDescriptorPageSize;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Clamp(Limit, 1, MaxDescriptorPageSize);
+
+    // Keyset paging on the actor name, which is unique within the partition
+    FString Cursor;
+    Params->TryGetStringField(TEXT("cursor"), Cursor);
+    const FName CursorName = Cursor.IsEmpty() ? NAME_None : FName(*Cursor);
+
+    // Same bounded max-heap as get_actors_in_level: only the Limit + 1 smallest names after the cursor
+    // are kept, so walking every page costs one scan plus O(N log Limit) per page.
+    using FDescPageEntry = TPair<FName, const FWorldPartitionActorDescInstance*>;
+    auto LargestNameFirst = [](const FDescPageEntry& A, const FDescPageEntry& B) { return A.Key.Compare(B.Key) > 0; };
+    const int32 KeepCount = Limit + 1;
+    TArray<FDescPageEntry> Candidates;
+    Candidates.Reserve(KeepCount + 1);
+    int32 Total = 0;
+    FUnrealMCPWorldPartitionActors::ForEachActorDesc(GWorld, Filter, [&](const FWorldPartitionActorDescInstance& Desc)
+    {
+        ++Total;
+        const FName ActorName = Desc.GetActorName();
+        if (!CursorName.IsNone() && ActorName.Compare(CursorName) <= 0)
+        {
+            return true;
+        }
+        if (Candidates.Num() == KeepCount)
+        {
+            if (ActorName.Compare(Candidates.HeapTop().Key) >= 0)
+            {
+                return true;
+            }
+            Candidates.HeapPopDiscard(LargestNameFirst, EAllowShrinking::No);
+        }
+        Candidates.HeapPush(FDescPageEntry(ActorName, &Desc), LargestNameFirst);
+        return true;
+    });
+    Candidates.Sort([](const FDescPageEntry& A, const FDescPageEntry& B)
+    {
+        return A.Key.Compare(B.Key) < 0;
+    });
+    const int32 PageCount = FMath::Min(Limit, Candidates.Num());
+
+    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    ActorArray.Reserve(PageCount);
+    for (int32 Index = 0; Index < PageCount; ++Index)
+    {
+        ActorArray.Add(MakeShared<FJsonValueObject>(FUnrealMCPWorldPartitionActors::ActorDescToJson(*Candidates[Index].Value)));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    ResultObj->SetNumberField(TEXT("count"), PageCount);
+    ResultObj->SetNumberField(TEXT("total"), Total);
+    if (PageCount < Candidates.Num())
+    {
+        ResultObj->SetStringField(TEXT("next_cursor"), Candidates[PageCount - 1].Key.ToString());
+    }
+    ResultObj->SetNumberField(TEXT("pinned_count"), FUnrealMCPWorldPartitionActors::Get().NumPinned());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleLoadWorldPartitionActors(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, {TEXT("guids"), TEXT("names")}))
+    {
+        return Err;
+    }
+
+    if (!FUnrealMCPWorldPartitionActors::GetWorldPartition(GWorld))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("The editor world is not a World Partition map"));
+    }
+
+    TArray<FGuid> Guids;
+    FString Error;
+    const TArray<TSharedPtr<FJsonValue>>* GuidValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("guids"), GuidValues) && !ParseGuidArray(*GuidValues, Guids, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> FailedArray;
+    const TArray<TSharedPtr<FJsonValue>>* NameValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("names"), NameValues) && NameValues->Num() > 0)
+    {
+        // One descriptor pass for all names. An object name or package path wins over a label; a name
+        // that still matches several descriptors is refused, as ResolveForEdit does, rather than guessed.
+        struct FNameMatches
+        {
+            TArray<const FWorldPartitionActorDescInstance*> Exact;
+            TArray<const FWorldPartitionActorDescInstance*> Labelled;
+        };
+        TMap<FString, FNameMatches> Matches;
+        for (const TSharedPtr<FJsonValue>& Value : *NameValues)
+        {
+            const FString Name = Value.IsValid() ? Value->AsString() : FString();
+            Matches.Add(Name);
+        }
+        FUnrealMCPWorldPartitionActors::ForEachActorDesc(GWorld, FMCPActorDescFilter(), [&](const FWorldPartitionActorDescInstance& Desc)
+        {
+            if (FNameMatches* Slot = Matches.Find(Desc.GetActorName().ToString()))
+            {
+                Slot->Exact.AddUnique(&Desc);
+            }
+            if (FNameMatches* Slot = Matches.Find(Desc.GetActorPackage().ToString()))
+            {
+                Slot->Exact.AddUnique(&Desc);
+            }
+            if (FNameMatches* Slot = Matches.Find(Desc.GetActorLabel().ToString()))
+            {
+                Slot->Labelled.Add(&Desc);
+            }
+            return true;
+        });
+
+        TArray<FString> Ambiguous;
+        for (const TSharedPtr<FJsonValue>& Value : *NameValues)
+        {
+            const FString Name = Value.IsValid() ? Value->AsString() : FString();
+            const FNameMatches& NameMatches = Matches.FindChecked(Name);
+            const TArray<const FWorldPartitionActorDescInstance*>& Candidates = NameMatches.Exact.Num() > 0 ? NameMatches.Exact : NameMatches.Labelled;
+            if (Candidates.Num() == 1)
+            {
+                Guids.AddUnique(Candidates[0]->GetGuid());
+            }
+            else if (Candidates.Num() > 1)
+            {
+                Ambiguous.Add(FUnrealMCPWorldPartitionActors::AmbiguousMatchError(Name, Candidates));
+            }
+            else
+            {
+                FailedArray.Add(MakeShared<FJsonValueString>(Name));
+            }
+        }
+        if (Ambiguous.Num() > 0)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Join(Ambiguous, TEXT("\n")));
+        }
+    }
+
+    if (Guids.Num() == 0 && FailedArray.Num() == 0)
     {
-        if (Actor)
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'guids' and/or 'names'"));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> LoadedArray;
+    for (const FGuid& Guid : Guids)
+    {
+        AActor* Actor = FUnrealMCPWorldPartitionActors::Get().LoadActor(GWorld, Guid);
+        if (!Actor)
         {
-            ActorArray.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
+            FailedArray.Add(MakeShared<FJsonValueString>(Guid.ToString(EGuidFormats::DigitsWithHyphens)));
+            continue;
         }
+
+        TSharedPtr<FJsonObject> ActorObj = FUnrealMCPActorQuery::ActorToJson(Actor, EMCPActorFields::Default | EMCPActorFields::Label);
+        ActorObj->SetStringField(TEXT("guid"), Guid.ToString(EGuidFormats::DigitsWithHyphens));
+        LoadedArray.Add(MakeShared<FJsonValueObject>(ActorObj));
     }
-    
+
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
-    
+    ResultObj->SetArrayField(TEXT("actors"), LoadedArray);
+    ResultObj->SetArrayField(TEXT("failed"), FailedArray);
+    ResultObj->SetNumberField(TEXT("pinned_count"), FUnrealMCPWorldPartitionActors::Get().NumPinned());
     return ResultObj;
 }
 
-TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleReleaseWorldPartitionActors(const TSharedPtr<FJsonObject>& Params)
 {
-    FString Pattern;
-    if (!Params->TryGetStringField(TEXT("pattern"), Pattern))
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, {TEXT("guids")}))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
+        return Err;
     }
-    
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> MatchingActors;
-    for (AActor* Actor : AllActors)
+
+    TArray<FGuid> Guids;
+    FString Error;
+    const TArray<TSharedPtr<FJsonValue>>* GuidValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("guids"), GuidValues) && !ParseGuidArray(*GuidValues, Guids, Error))
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
-        {
-            MatchingActors.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
     }
-    
+
+    TArray<FGuid> Released;
+    TArray<FGuid> KeptDirty;
+    FUnrealMCPWorldPartitionActors::Get().Release(Guids, Released, KeptDirty);
+
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
-    
+    ResultObj->SetArrayField(TEXT("released"), GuidsToJson(Released));
+    ResultObj->SetArrayField(TEXT("kept_dirty"), GuidsToJson(KeptDirty));
+    ResultObj->SetNumberField(TEXT("pinned_count"), FUnrealMCPWorldPartitionActors::Get().NumPinned());
     return ResultObj;
 }
 
@@ -265,14 +1523,9 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActor(const TShared
     }
 
     // Check if an actor with this name already exists
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-    for (AActor* Actor : AllActors)
+    if (FUnrealMCPActorIndex::Get().FindByName(World, ActorName))
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
     }
 
     FActorSpawnParameters SpawnParams;
@@ -303,14 +1556,8 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActor(const TShared
     }
     else
     {
-        // Try to load as a class path (e.g., "/Script/AIPoint.AIPointInstance")
-        ActorClass = FindObject<UClass>(nullptr, *ActorType);
-
-        if (!ActorClass)
-        {
-            // Try StaticLoadClass as fallback
-            ActorClass = StaticLoadClass(AActor::StaticClass(), nullptr, *ActorType);
-        }
+        // Short name or class path (e.g., "/Script/AIPoint.AIPointInstance"); paths load if needed
+        ActorClass = FUnrealMCPClassIndex::Get().FindClass(ActorType);
 
         if (!ActorClass)
         {
@@ -350,26 +1597,21 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleDeleteActor(const TShare
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
+    FString FindError;
+    if (AActor* Actor = FindActorForEdit(ActorName, GetMatchLabelParam(Params), FindError))
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            // Store actor info before deletion for the response
-            TSharedPtr<FJsonObject> ActorInfo = FUnrealMCPCommonUtils::ActorToJsonObject(Actor);
-            
-            // Delete the actor
-            Actor->Destroy();
-            
-            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-            ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
-            return ResultObj;
-        }
+        // Store actor info before deletion for the response
+        TSharedPtr<FJsonObject> ActorInfo = FUnrealMCPCommonUtils::ActorToJsonObject(Actor);
+
+        // Delete the actor
+        Actor->Destroy();
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
+        return ResultObj;
     }
     
-    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params)
@@ -382,22 +1624,12 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransform(const
     }
 
     // Find the actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
-    }
+    FString FindError;
+    AActor* TargetActor = FindActorForEdit(ActorName, GetMatchLabelParam(Params), FindError);
 
     if (!TargetActor)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get transform parameters
@@ -418,11 +1650,158 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransform(const
 
     // Set the new transform
     TargetActor->SetActorTransform(NewTransform);
+    FUnrealMCPSpatialIndex::Get().MarkActorDirty(TargetActor);
+    FUnrealMCPLevelChangeFeed::Get().RecordChange(TargetActor, EMCPLevelChangeType::Moved);
 
     // Return updated actor info
     return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransforms(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, {
+        TEXT("names"), TEXT("match_label"), TEXT("filter"), TEXT("in_box"), TEXT("in_sphere"),
+        TEXT("mode"), TEXT("location"), TEXT("rotation"), TEXT("scale"),
+        TEXT("matrix"), TEXT("rotate"), TEXT("offset"), TEXT("scale_by"), TEXT("pivot"),
+        TEXT("snap"), TEXT("snap_rotation")}))
+    {
+        return Err;
+    }
+
+    FBatchTransformEdit Edit;
+    FString Error;
+    if (!ParseBatchTransformEdit(Params, Edit, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    // Selection: explicit names, or a filter and/or spatial region
+    TArray<AActor*> Targets;
+    TArray<TSharedPtr<FJsonValue>> MissingNames;
+    const TArray<TSharedPtr<FJsonValue>>* NameArray = nullptr;
+    const TSharedPtr<FJsonObject>* FilterObj = nullptr;
+    const TSharedPtr<FJsonObject>* BoxObj = nullptr;
+    const TSharedPtr<FJsonObject>* SphereObj = nullptr;
+    const bool bHasNames = Params->TryGetArrayField(TEXT("names"), NameArray);
+    const bool bHasFilter = Params->TryGetObjectField(TEXT("filter"), FilterObj);
+    const bool bHasBox = Params->TryGetObjectField(TEXT("in_box"), BoxObj);
+    const bool bHasSphere = Params->TryGetObjectField(TEXT("in_sphere"), SphereObj);
+
+    if (bHasNames == (bHasFilter || bHasBox || bHasSphere) || (bHasBox && bHasSphere))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            TEXT("Select actors with either 'names', or 'filter' and/or one of 'in_box' / 'in_sphere'"));
+    }
+
+    if (bHasNames)
+    {
+        TSet<AActor*> Seen;
+        const bool bMatchLabel = GetMatchLabelParam(Params);
+        for (const TSharedPtr<FJsonValue>& NameValue : *NameArray)
+        {
+            const FString Name = NameValue.IsValid() ? NameValue->AsString() : FString();
+            FString FindError;
+            AActor* Actor = FindActorForEdit(Name, bMatchLabel, FindError);
+            if (!Actor)
+            {
+                MissingNames.Add(MakeShared<FJsonValueString>(Name));
+            }
+            else if (!Seen.Contains(Actor))
+            {
+                Seen.Add(Actor);
+                Targets.Add(Actor);
+            }
+        }
+    }
+    else
+    {
+        FMCPActorFilter Filter;
+        if (bHasFilter)
+        {
+            // Only the selection keys apply here; a typo must not widen the edit to every actor.
+            if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(*FilterObj,
+                {TEXT("class"), TEXT("tag"), TEXT("folder"), TEXT("level"), TEXT("label")}))
+            {
+                return Err;
+            }
+            if (!FUnrealMCPActorQuery::ParseFilter(*FilterObj, GWorld, Filter, Error))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+            }
+            if (!Filter.Class && Filter.Tag.IsNone() && Filter.Folder.IsEmpty() && !Filter.Level && Filter.LabelPattern.IsEmpty())
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(
+                    TEXT("'filter' needs at least one of class, tag, folder, level or label"));
+            }
+        }
+
+        auto Collect = [&Targets, &Filter](AActor* Actor, const FBox& /*Bounds*/)
+        {
+            if (Filter.Matches(Actor))
+            {
+                Targets.Add(Actor);
+            }
+        };
+
+        FVector Min, Max, Center;
+        double Radius = 0.0;
+        if (bHasBox)
+        {
+            if (!TryGetVectorParam(*BoxObj, TEXT("min"), Min) || !TryGetVectorParam(*BoxObj, TEXT("max"), Max))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'in_box' needs 'min' and 'max' ([x, y, z])"));
+            }
+            FUnrealMCPSpatialIndex::Get().QueryBox(GWorld, FBox(Min.ComponentMin(Max), Min.ComponentMax(Max)), Collect);
+        }
+        else if (bHasSphere)
+        {
+            if (!TryGetVectorParam(*SphereObj, TEXT("center"), Center) || !(*SphereObj)->TryGetNumberField(TEXT("radius"), Radius) || Radius <= 0.0)
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'in_sphere' needs 'center' ([x, y, z]) and a positive 'radius'"));
+            }
+            FUnrealMCPSpatialIndex::Get().QuerySphere(GWorld, Center, Radius, Collect);
+        }
+        else
+        {
+            FUnrealMCPActorQuery::ForEachActor(GWorld, Filter, [&Targets](AActor* Actor) { Targets.Add(Actor); });
+        }
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    int32 MovedCount = 0;
+    TArray<TSharedPtr<FJsonValue>> SkippedNames;
+    if (Targets.Num() > 0)
+    {
+        // One undo entry for the whole batch
+        FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Set %d Actor Transforms"), Targets.Num())));
+        // Navigation octree updates are queued while locked and flushed once when the lock goes out of scope.
+        // Render transforms are already batched: moves only mark them dirty for the end-of-frame update.
+        FNavigationLockContext NavigationLock(GWorld, ENavigationLockReason::Unspecified);
+
+        for (AActor* Actor : Targets)
+        {
+            if (!Actor->GetRootComponent())
+            {
+                SkippedNames.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+                continue;
+            }
+
+            Actor->Modify();
+            Actor->SetActorTransform(Edit.Apply(Actor->GetActorTransform()), false, nullptr, ETeleportType::TeleportPhysics);
+            FUnrealMCPSpatialIndex::Get().MarkActorDirty(Actor);
+            FUnrealMCPLevelChangeFeed::Get().RecordChange(Actor, EMCPLevelChangeType::Moved);
+            ++MovedCount;
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("count"), MovedCount);
+    ResultObj->SetArrayField(TEXT("missing"), MissingNames);
+    ResultObj->SetArrayField(TEXT("skipped"), SkippedNames);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorProperties(const TSharedPtr<FJsonObject>& Params)
 {
     // Get actor name
@@ -433,24 +1812,34 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorProperties(const
     }
 
     // Find the actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
-    }
+    AActor* TargetActor = FUnrealMCPActorIndex::Get().FindActor(GWorld, ActorName);
 
     if (!TargetActor)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
     }
 
+    // A property path reads just that value ("RootComponent.RelativeLocation", "Subobject:Mesh.BodyInstance")
+    FString PropertyPath;
+    if (Params->TryGetStringField(TEXT("property_path"), PropertyPath) && !PropertyPath.IsEmpty())
+    {
+        FString PathError;
+        TSharedPtr<FJsonValue> Value = FUnrealMCPPropertyPlans::Get().ReadPath(TargetActor, PropertyPath, CPF_Transient, PathError);
+        if (!Value.IsValid())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(PathError);
+        }
+
+        TSharedPtr<FJsonObject> PropsObj = MakeShared<FJsonObject>();
+        PropsObj->SetField(PropertyPath, Value);
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), TargetActor->GetName());
+        ResultObj->SetStringField(TEXT("property_path"), PropertyPath);
+        ResultObj->SetObjectField(TEXT("properties"), PropsObj);
+        return ResultObj;
+    }
+
     // Always return detailed properties for this command
     return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
@@ -465,22 +1854,12 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
     }
 
     // Find the actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
-    }
+    FString FindError;
+    AActor* TargetActor = FindActorForEdit(ActorName, GetMatchLabelParam(Params), FindError);
 
     if (!TargetActor)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Get property name
@@ -530,6 +1909,7 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
     {
         // First, set the property value normally
         FString ErrorMessage;
+        TargetActor->Modify();
         if (!FUnrealMCPCommonUtils::SetObjectProperty(TargetActor, PropertyName, PropertyValue, ErrorMessage))
         {
             return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
@@ -554,24 +1934,260 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
         return ResultObj;
     }
 
-    // Set the property using our utility function
+    // Resolve the property (or path, e.g. "RootComponent.RelativeScale3D") to its cached setter plan
+    FMCPPropertyPathTarget Target;
     FString ErrorMessage;
-    if (FUnrealMCPCommonUtils::SetObjectProperty(TargetActor, PropertyName, PropertyValue, ErrorMessage))
+    if (!FUnrealMCPPropertyPlans::Get().ResolvePath(TargetActor, PropertyName, true, Target, ErrorMessage))
     {
-        // Property set successfully
-        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-        ResultObj->SetStringField(TEXT("actor"), ActorName);
-        ResultObj->SetStringField(TEXT("property"), PropertyName);
-        ResultObj->SetBoolField(TEXT("success"), true);
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+    if (!Target.Plan.IsValid())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Property path ends on an object, not a property: %s"), *PropertyName));
+    }
+
+    // Modify/PostEditChange record the edit for undo, dirty the package and let the owner refresh
+    // state derived from the property (render state, construction script)
+    Target.Object->Modify();
+    if (!Target.Plan->Apply(Target.ValuePtr, PropertyValue, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+    Target.Object->PostEditChange();
+
+    // The write may land on a subobject the change feed does not map back to the actor
+    FUnrealMCPLevelChangeFeed::Get().RecordChange(TargetActor, EMCPLevelChangeType::Modified);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("actor"), ActorName);
+    ResultObj->SetStringField(TEXT("property"), PropertyName);
+    ResultObj->SetBoolField(TEXT("success"), true);
+
+    // Also include the full actor details
+    ResultObj->SetObjectField(TEXT("actor_details"), FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true));
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActors(const TSharedPtr<FJsonObject>& Params)
+{
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+        {TEXT("actors"), TEXT("class"), TEXT("blueprint"), TEXT("static_mesh"), TEXT("folder"),
+         TEXT("instancing"), TEXT("instance_actor_prefix")}))
+    {
+        return Err;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+    if (!Params->TryGetArrayField(TEXT("actors"), Items) || Items->Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing or empty 'actors' array"));
+    }
+    if (Items->Num() > MaxSpawnBatchSize)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("At most %d actors per spawn_actors call (got %d)"), MaxSpawnBatchSize, Items->Num()));
+    }
+
+    FString InstancingName = TEXT("none");
+    Params->TryGetStringField(TEXT("instancing"), InstancingName);
+    ESpawnInstancing Instancing = ESpawnInstancing::None;
+    if (InstancingName == TEXT("ism"))
+    {
+        Instancing = ESpawnInstancing::ISM;
+    }
+    else if (InstancingName == TEXT("hism"))
+    {
+        Instancing = ESpawnInstancing::HISM;
+    }
+    else if (InstancingName != TEXT("none"))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown instancing '%s'. Valid values: none, ism, hism"), *InstancingName));
+    }
+    FString InstanceActorPrefix = TEXT("ISM");
+    Params->TryGetStringField(TEXT("instance_actor_prefix"), InstanceActorPrefix);
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    // Validate the whole batch before spawning anything, resolving each distinct class and mesh once
+    TMap<FString, UClass*> ClassCache;
+    TMap<FString, UStaticMesh*> MeshCache;
+    TSet<FName> BatchNames;
+    TArray<FSpawnRequest> Requests;
+    Requests.Reserve(Items->Num());
+
+    for (int32 Index = 0; Index < Items->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* ItemPtr = nullptr;
+        if (!(*Items)[Index]->TryGetObject(ItemPtr))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("actors[%d] must be an object"), Index));
+        }
+        const TSharedPtr<FJsonObject>& Item = *ItemPtr;
+        if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Item,
+            {TEXT("class"), TEXT("blueprint"), TEXT("name"), TEXT("location"), TEXT("rotation"), TEXT("scale"),
+             TEXT("static_mesh"), TEXT("folder")}))
+        {
+            return Err;
+        }
+
+        auto GetString = [&Item, &Params](const TCHAR* Field)
+        {
+            FString Value;
+            if (!Item->TryGetStringField(Field, Value))
+            {
+                Params->TryGetStringField(Field, Value);
+            }
+            return Value;
+        };
+
+        FSpawnRequest Request;
+        const FString BlueprintName = Item->HasField(TEXT("class")) ? FString() : GetString(TEXT("blueprint"));
+        const FString ClassName = BlueprintName.IsEmpty() ? GetString(TEXT("class")) : FString();
+        const FString ClassKey = BlueprintName.IsEmpty() ? (ClassName.IsEmpty() ? TEXT("StaticMeshActor") : ClassName) : TEXT("bp:") + BlueprintName;
+        if (UClass** Cached = ClassCache.Find(ClassKey))
+        {
+            Request.Class = *Cached;
+        }
+        else
+        {
+            if (!BlueprintName.IsEmpty())
+            {
+                UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+                Request.Class = Blueprint ? Blueprint->GeneratedClass.Get() : nullptr;
+            }
+            else
+            {
+                Request.Class = FUnrealMCPActorQuery::ResolveActorClass(ClassKey);
+            }
+            ClassCache.Add(ClassKey, Request.Class);
+        }
+        if (!Request.Class || Request.Class->HasAnyClassFlags(CLASS_Abstract))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("actors[%d]: cannot spawn %s '%s'"),
+                Index, BlueprintName.IsEmpty() ? TEXT("class") : TEXT("blueprint"), BlueprintName.IsEmpty() ? *ClassKey : *BlueprintName));
+        }
+
+        const FString MeshPath = GetString(TEXT("static_mesh"));
+        if (!MeshPath.IsEmpty())
+        {
+            if (!Request.Class->IsChildOf(AStaticMeshActor::StaticClass()))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(
+                    FString::Printf(TEXT("actors[%d]: 'static_mesh' needs a StaticMeshActor class"), Index));
+            }
+            UStaticMesh** CachedMesh = MeshCache.Find(MeshPath);
+            Request.Mesh = CachedMesh ? *CachedMesh : MeshCache.Add(MeshPath, Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath)));
+            if (!Request.Mesh)
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(
+                    FString::Printf(TEXT("actors[%d]: could not load static mesh '%s'"), Index, *MeshPath));
+            }
+        }
+
+        FString Name;
+        if (Item->TryGetStringField(TEXT("name"), Name) && !Name.IsEmpty())
+        {
+            Request.Name = FName(*Name);
+            if (BatchNames.Contains(Request.Name) || FUnrealMCPActorIndex::Get().FindByName(World, Name))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(
+                    FString::Printf(TEXT("actors[%d]: actor with name '%s' already exists"), Index, *Name));
+            }
+            BatchNames.Add(Request.Name);
+        }
+
+        const FString Folder = GetString(TEXT("folder"));
+        Request.Folder = Folder.IsEmpty() ? NAME_None : FName(*Folder);
+
+        Request.Transform = FTransform(
+            FUnrealMCPCommonUtils::GetRotatorFromJson(Item, TEXT("rotation")),
+            FUnrealMCPCommonUtils::GetVectorFromJson(Item, TEXT("location")),
+            Item->HasField(TEXT("scale")) ? FUnrealMCPCommonUtils::GetVectorFromJson(Item, TEXT("scale")) : FVector::OneVector);
+        Requests.Add(MoveTemp(Request));
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonValue>> SpawnedNames;
+    TArray<TSharedPtr<FJsonValue>> InstancedActors;
+    int32 FailedCount = 0;
+    {
+        // One undo entry for the whole batch
+        FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Spawn %d Actors"), Requests.Num())));
+        FNavigationLockContext NavigationLock(World, ENavigationLockReason::Unspecified);
+
+        // Unnamed plain StaticMeshActors become instances, grouped by mesh and folder
+        TMap<TPair<UStaticMesh*, FName>, TArray<FTransform>> InstanceGroups;
+
+        for (const FSpawnRequest& Request : Requests)
+        {
+            if (Instancing != ESpawnInstancing::None && Request.Mesh && Request.Name.IsNone() &&
+                Request.Class == AStaticMeshActor::StaticClass())
+            {
+                InstanceGroups.FindOrAdd(TPair<UStaticMesh*, FName>(Request.Mesh, Request.Folder)).Add(Request.Transform);
+                continue;
+            }
+
+            // Deferred construction: the mesh is in place before construction and the first render state
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.Name = Request.Name;
+            SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+            SpawnParams.ObjectFlags |= RF_Transactional;
+            SpawnParams.bDeferConstruction = true;
+
+            AActor* NewActor = World->SpawnActor(Request.Class, &Request.Transform, SpawnParams);
+            if (!NewActor)
+            {
+                ++FailedCount;
+                continue;
+            }
+            if (Request.Mesh)
+            {
+                CastChecked<AStaticMeshActor>(NewActor)->GetStaticMeshComponent()->SetStaticMesh(Request.Mesh);
+            }
+            NewActor->FinishSpawning(Request.Transform);
+            if (!Request.Name.IsNone())
+            {
+                NewActor->SetActorLabel(NewActor->GetName());
+            }
+            if (!Request.Folder.IsNone())
+            {
+                NewActor->SetFolderPath(Request.Folder);
+            }
+            SpawnedNames.Add(MakeShared<FJsonValueString>(NewActor->GetName()));
+        }
+
+        for (const TPair<TPair<UStaticMesh*, FName>, TArray<FTransform>>& Group : InstanceGroups)
+        {
+            AActor* GroupActor = SpawnInstancedMeshActor(World, Group.Key.Key, Group.Value,
+                Instancing == ESpawnInstancing::HISM, InstanceActorPrefix, Group.Key.Value);
+            if (!GroupActor)
+            {
+                FailedCount += Group.Value.Num();
+                continue;
+            }
+            FUnrealMCPSpatialIndex::Get().MarkActorDirty(GroupActor);
 
-        // Also include the full actor details
-        ResultObj->SetObjectField(TEXT("actor_details"), FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true));
-        return ResultObj;
-    }
-    else
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+            TSharedPtr<FJsonObject> GroupObj = MakeShared<FJsonObject>();
+            GroupObj->SetStringField(TEXT("name"), GroupActor->GetName());
+            GroupObj->SetStringField(TEXT("static_mesh"), Group.Key.Key->GetPathName());
+            GroupObj->SetNumberField(TEXT("instance_count"), Group.Value.Num());
+            InstancedActors.Add(MakeShared<FJsonValueObject>(GroupObj));
+        }
     }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("spawned_count"), SpawnedNames.Num());
+    ResultObj->SetArrayField(TEXT("actors"), SpawnedNames);
+    ResultObj->SetArrayField(TEXT("instanced"), InstancedActors);
+    ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    return ResultObj;
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
@@ -686,18 +2302,7 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFocusViewport(const TSha
     if (HasTargetActor)
     {
         // Find the actor
-        AActor* TargetActor = nullptr;
-        TArray<AActor*> AllActors;
-        UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-        
-        for (AActor* Actor : AllActors)
-        {
-            if (Actor && Actor->GetName() == TargetActorName)
-            {
-                TargetActor = Actor;
-                break;
-            }
-        }
+        AActor* TargetActor = FUnrealMCPActorIndex::Get().FindActor(GWorld, TargetActorName);
 
         if (!TargetActor)
         {
@@ -857,7 +2462,7 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCallSubsystemFunction(co
     }
 
     // Find subsystem class
-    UClass* SubsystemClass = FindObject<UClass>(nullptr, *SubsystemClassName);
+    UClass* SubsystemClass = FUnrealMCPClassIndex::Get().FindClass(SubsystemClassName, UWorldSubsystem::StaticClass());
     if (!SubsystemClass)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
@@ -872,116 +2477,72 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCallSubsystemFunction(co
             FString::Printf(TEXT("Failed to get subsystem instance: %s"), *SubsystemClassName));
     }
 
-    // Find function
-    UFunction* Function = Subsystem->FindFunction(*FunctionName);
-    if (!Function)
+    // Cached per (class, function): parameter layout, converters and result serializers
+    TSharedPtr<const FMCPFunctionPlan> Plan = FUnrealMCPFunctionPlans::Get().FindPlan(SubsystemClass, FName(*FunctionName));
+    if (!Plan.IsValid())
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
             FString::Printf(TEXT("Function not found: %s::%s"), *SubsystemClassName, *FunctionName));
     }
 
-    // Prepare function parameters
-    uint8* ParamBuffer = (uint8*)FMemory_Alloca(Function->ParmsSize);
-    FMemory::Memzero(ParamBuffer, Function->ParmsSize);
-
-    // Set parameters from JSON
-    if (Params->HasField(TEXT("parameters")))
+    // Batch form: one invocation per argument set, all in this game-thread hop
+    const TArray<TSharedPtr<FJsonValue>>* ParameterSets = nullptr;
+    if (Params->TryGetArrayField(TEXT("parameter_sets"), ParameterSets))
     {
-        const TSharedPtr<FJsonObject>* ParamsObj;
-        if (Params->TryGetObjectField(TEXT("parameters"), ParamsObj))
+        if (Params->HasField(TEXT("parameters")))
         {
-            for (TFieldIterator<FProperty> It(Function); It && (It->PropertyFlags & CPF_Parm); ++It)
-            {
-                FProperty* Property = *It;
-                if (Property->HasAnyPropertyFlags(CPF_ReturnParm))
-                {
-                    continue;
-                }
-
-                FString PropertyName = Property->GetName();
-                if ((*ParamsObj)->HasField(PropertyName))
-                {
-                    const TSharedPtr<FJsonValue>* JsonValue = (*ParamsObj)->Values.Find(PropertyName);
-                    if (JsonValue && JsonValue->IsValid())
-                    {
-                        // Handle different property types
-                        if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
-                        {
-                            FString StrValue = (*JsonValue)->AsString();
-                            StrProp->SetPropertyValue_InContainer(ParamBuffer, StrValue);
-                        }
-                        else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
-                        {
-                            int32 IntValue = static_cast<int32>((*JsonValue)->AsNumber());
-                            IntProp->SetPropertyValue_InContainer(ParamBuffer, IntValue);
-                        }
-                        else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-                        {
-                            float FloatValue = static_cast<float>((*JsonValue)->AsNumber());
-                            FloatProp->SetPropertyValue_InContainer(ParamBuffer, FloatValue);
-                        }
-                        else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-                        {
-                            bool BoolValue = (*JsonValue)->AsBool();
-                            BoolProp->SetPropertyValue_InContainer(ParamBuffer, BoolValue);
-                        }
-                        // Add more type handlers as needed
-                    }
-                }
-            }
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Pass either 'parameters' or 'parameter_sets', not both"));
         }
-    }
 
-    // Call function
-    Subsystem->ProcessEvent(Function, ParamBuffer);
-
-    // Extract return value(s)
-    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetBoolField(TEXT("success"), true);
+        bool bStopOnError = false;
+        Params->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
 
-    for (TFieldIterator<FProperty> It(Function); It; ++It)
-    {
-        FProperty* Property = *It;
-        if (Property->HasAnyPropertyFlags(CPF_ReturnParm | CPF_OutParm))
+        TArray<TSharedPtr<FJsonValue>> ResultsArr;
+        ResultsArr.Reserve(ParameterSets->Num());
+        int32 FailedCount = 0;
+        for (const TSharedPtr<FJsonValue>& SetValue : *ParameterSets)
         {
-            FString PropertyName = Property->GetName();
-
-            if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
-            {
-                FString StrValue = StrProp->GetPropertyValue_InContainer(ParamBuffer);
-                ResultObj->SetStringField(PropertyName, StrValue);
-            }
-            else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
-            {
-                int32 IntValue = IntProp->GetPropertyValue_InContainer(ParamBuffer);
-                ResultObj->SetNumberField(PropertyName, IntValue);
-            }
-            else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-            {
-                float FloatValue = FloatProp->GetPropertyValue_InContainer(ParamBuffer);
-                ResultObj->SetNumberField(PropertyName, FloatValue);
-            }
-            else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+            TSharedRef<FJsonObject> CallResult = MakeShared<FJsonObject>();
+            CallResult->SetBoolField(TEXT("success"), true);
+            const TSharedPtr<FJsonObject>* Arguments = nullptr;
+            FString CallError = TEXT("Each parameter set must be an object");
+            const bool bCallSucceeded = SetValue.IsValid() && SetValue->TryGetObject(Arguments) &&
+                Plan->Invoke(Subsystem, *Arguments, CallResult, CallError);
+            if (!bCallSucceeded)
             {
-                bool BoolValue = BoolProp->GetPropertyValue_InContainer(ParamBuffer);
-                ResultObj->SetBoolField(PropertyName, BoolValue);
+                CallResult->SetBoolField(TEXT("success"), false);
+                CallResult->SetStringField(TEXT("error"), CallError);
+                ++FailedCount;
             }
-            else if (FObjectProperty* ObjectProp = CastField<FObjectProperty>(Property))
+            ResultsArr.Add(MakeShared<FJsonValueObject>(CallResult));
+            if (!bCallSucceeded && bStopOnError)
             {
-                UObject* ObjectValue = ObjectProp->GetPropertyValue_InContainer(ParamBuffer);
-                if (ObjectValue)
-                {
-                    ResultObj->SetStringField(PropertyName, ObjectValue->GetName());
-                    if (AActor* Actor = Cast<AActor>(ObjectValue))
-                    {
-                        ResultObj->SetObjectField(PropertyName + TEXT("_details"),
-                                                FUnrealMCPCommonUtils::ActorToJsonObject(Actor));
-                    }
-                }
+                break;
             }
         }
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetBoolField(TEXT("success"), true);
+        ResultObj->SetArrayField(TEXT("results"), ResultsArr);
+        ResultObj->SetNumberField(TEXT("count"), ResultsArr.Num());
+        ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+        return ResultObj;
+    }
+
+    TSharedPtr<FJsonObject> Arguments;
+    const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
+    if (Params->TryGetObjectField(TEXT("parameters"), ParamsObj))
+    {
+        Arguments = *ParamsObj;
     }
 
+    TSharedRef<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    FString CallError;
+    if (!Plan->Invoke(Subsystem, Arguments, ResultObj, CallError))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(CallError);
+    }
     return ResultObj;
 }
 
@@ -1032,23 +2593,13 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleAddToActorArrayProperty(
     }
 
     // Find the target actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
-    }
+    const bool bMatchLabel = GetMatchLabelParam(Params);
+    FString FindError;
+    AActor* TargetActor = FindActorForEdit(ActorName, bMatchLabel, FindError);
 
     if (!TargetActor)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FindError);
     }
 
     // Find the property
@@ -1079,20 +2630,11 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleAddToActorArrayProperty(
     TArray<AActor*> ElementActors;
     for (const FString& ElementName : ElementNames)
     {
-        AActor* ElementActor = nullptr;
-        for (AActor* Actor : AllActors)
-        {
-            if (Actor && Actor->GetName() == ElementName)
-            {
-                ElementActor = Actor;
-                break;
-            }
-        }
+        AActor* ElementActor = FindActorForEdit(ElementName, bMatchLabel, FindError);
 
         if (!ElementActor)
         {
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Element actor not found: %s"), *ElementName));
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Element: ") + FindError);
         }
 
         ElementActors.Add(ElementActor);
@@ -1117,6 +2659,7 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleAddToActorArrayProperty(
         TargetActor->GetLevel()->Modify();
         TargetActor->GetLevel()->GetOutermost()->MarkPackageDirty();
     }
+    FUnrealMCPLevelChangeFeed::Get().RecordChange(TargetActor, EMCPLevelChangeType::Modified);
 
     // Return result
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -1139,12 +2682,14 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetDataAsset(const TShar
 
     // StaticLoadObject accepts both content-browser paths ("/Game/X/Y") and full object
     // paths ("/Game/X/Y.Y"); pick whichever the caller provided.
+    const bool bWasResident = FUnrealMCPReadLoads::IsResident(Path);
     UObject* Object = StaticLoadObject(UObject::StaticClass(), nullptr, *Path);
     if (!Object)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
             FString::Printf(TEXT("Could not load asset at path: %s"), *Path));
     }
+    FUnrealMCPReadLoads::Get().TrackRead(Object, bWasResident);
 
     bool bAllowAnyObject = false;
     Params->TryGetBoolField(TEXT("allow_any_object"), bAllowAnyObject);
@@ -1159,30 +2704,11 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetDataAsset(const TShar
     FString PropertyPath;
     Params->TryGetStringField(TEXT("property_path"), PropertyPath);
 
-    const int64 CheckFlags = 0;
-    const int64 SkipFlags = CPF_Transient;
-
-    TSharedPtr<FJsonObject> PropsObj = MakeShared<FJsonObject>();
-    if (PropertyPath.IsEmpty())
+    TSharedPtr<FJsonObject> PropsObj;
+    FString ReadError;
+    if (!ReadAssetProperties(Object, PropertyPath, PropsObj, ReadError))
     {
-        FJsonObjectConverter::UStructToJsonObject(
-            Object->GetClass(), Object, PropsObj.ToSharedRef(), CheckFlags, SkipFlags);
-    }
-    else
-    {
-        FProperty* Property = Object->GetClass()->FindPropertyByName(FName(*PropertyPath));
-        if (!Property)
-        {
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Property not found on asset class '%s': %s"),
-                    *Object->GetClass()->GetName(), *PropertyPath));
-        }
-        TSharedPtr<FJsonValue> Value = FJsonObjectConverter::UPropertyToJsonValue(
-            Property, Property->ContainerPtrToValuePtr<void>(Object), CheckFlags, SkipFlags);
-        if (Value.IsValid())
-        {
-            PropsObj->SetField(PropertyPath, Value);
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ReadError);
     }
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -1224,21 +2750,11 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindAssets(const TShared
     if (!ClassName.IsEmpty())
     {
         // Accept either short name ("Blueprint") or full path ("/Script/Engine.Blueprint").
-        UClass* TargetClass = nullptr;
-        if (ClassName.Contains(TEXT(".")))
-        {
-            TargetClass = FindObject<UClass>(nullptr, *ClassName);
-            ClassResolution = TEXT("full_path");
-        }
-        else
-        {
-            TargetClass = UClass::TryFindTypeSlow<UClass>(ClassName);
-            ClassResolution = TEXT("short_name");
-        }
-
-        if (TargetClass)
+        ClassResolution = ClassName.Contains(TEXT(".")) ? TEXT("full_path") : TEXT("short_name");
+        FTopLevelAssetPath ClassPath;
+        if (FUnrealMCPAssetQuery::Get().ResolveClassPath(ClassName, ClassPath))
         {
-            Filter.ClassPaths.Add(TargetClass->GetClassPathName());
+            Filter.ClassPaths.Add(ClassPath);
             Filter.bRecursiveClasses = true;
         }
         else
@@ -1295,13 +2811,423 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindAssets(const TShared
     return Result;
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleQueryAssets(const TSharedPtr<FJsonObject>& Params)
+{
+    FUnrealMCPAssetQuery& AssetQuery = FUnrealMCPAssetQuery::Get();
+    TSet<FString> AllowedKeys = FUnrealMCPAssetQuery::GetQueryParamKeys();
+    AllowedKeys.Append({TEXT("return_tags"), TEXT("limit"), TEXT("cursor"), TEXT("no_cache")});
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, AllowedKeys))
+    {
+        return Err;
+    }
+
+    FMCPAssetQuery Query;
+    FString Error;
+    if (!AssetQuery.ParseQuery(Params, Query, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    int32 Limit = DefaultAssetPageSize;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Clamp(Limit, 1, MaxAssetPageSize);
+
+    FString Cursor;
+    Params->TryGetStringField(TEXT("cursor"), Cursor);
+
+    bool bNoCache = false;
+    Params->TryGetBoolField(TEXT("no_cache"), bNoCache);
+
+    TArray<FName> ReturnTags;
+    bool bAllTags = false;
+    const TArray<TSharedPtr<FJsonValue>>* ReturnTagValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("return_tags"), ReturnTagValues))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ReturnTagValues)
+        {
+            const FString Tag = Value.IsValid() ? Value->AsString() : FString();
+            if (Tag == TEXT("*"))
+            {
+                bAllTags = true;
+            }
+            else if (!Tag.IsEmpty())
+            {
+                ReturnTags.AddUnique(FName(*Tag));
+            }
+        }
+    }
+
+    bool bCacheHit = false;
+    const TSharedRef<const FMCPAssetQueryResult> QueryResult = AssetQuery.Run(Query, !bNoCache, bCacheHit);
+
+    // Keyset paging: the cursor is the sort key of the last entry returned, so pages stay
+    // consistent across registry changes that land between requests
+    const int32 Start = QueryResult->IndexAfter(Cursor);
+    const int32 End = FMath::Min(Start + Limit, QueryResult->Entries.Num());
+
+    TArray<TSharedPtr<FJsonValue>> AssetsArr;
+    AssetsArr.Reserve(End - Start);
+    for (int32 Index = Start; Index < End; ++Index)
+    {
+        const FAssetData& Asset = QueryResult->Entries[Index].Asset;
+        TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+        AssetObj->SetStringField(TEXT("name"), Asset.AssetName.ToString());
+        AssetObj->SetStringField(TEXT("path"), Asset.GetObjectPathString());
+        AssetObj->SetStringField(TEXT("package_path"), Asset.PackagePath.ToString());
+        AssetObj->SetStringField(TEXT("class"), Asset.AssetClassPath.ToString());
+
+        FString ParentClassTag;
+        if (Asset.GetTagValue(FName(TEXT("ParentClass")), ParentClassTag)
+            || Asset.GetTagValue(FName(TEXT("NativeParentClass")), ParentClassTag))
+        {
+            AssetObj->SetStringField(TEXT("parent_class"), ParentClassTag);
+        }
+
+        if (bAllTags || ReturnTags.Num() > 0)
+        {
+            TSharedPtr<FJsonObject> TagsObj = MakeShared<FJsonObject>();
+            if (bAllTags)
+            {
+                for (const auto& TagAndValue : Asset.TagsAndValues)
+                {
+                    TagsObj->SetStringField(TagAndValue.Key.ToString(), TagAndValue.Value.AsString());
+                }
+            }
+            else
+            {
+                for (const FName& Tag : ReturnTags)
+                {
+                    FString TagValue;
+                    if (Asset.GetTagValue(Tag, TagValue))
+                    {
+                        TagsObj->SetStringField(Tag.ToString(), TagValue);
+                    }
+                }
+            }
+            AssetObj->SetObjectField(TEXT("tags"), TagsObj);
+        }
+
+        AssetsArr.Add(MakeShared<FJsonValueObject>(AssetObj));
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetArrayField(TEXT("assets"), AssetsArr);
+    Result->SetNumberField(TEXT("count"), AssetsArr.Num());
+    Result->SetNumberField(TEXT("total"), QueryResult->Entries.Num());
+    if (End < QueryResult->Entries.Num())
+    {
+        Result->SetStringField(TEXT("next_cursor"), QueryResult->Entries[End - 1].Key);
+    }
+    Result->SetBoolField(TEXT("cached"), bCacheHit);
+    Result->SetNumberField(TEXT("generation"), static_cast<double>(QueryResult->Generation));
+    Result->SetBoolField(TEXT("registry_loading"), FUnrealMCPAssetQuery::IsRegistryLoading());
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetAssetsBulk(const TSharedPtr<FJsonObject>& Params)
+{
+    FUnrealMCPAssetQuery& AssetQuery = FUnrealMCPAssetQuery::Get();
+    TSet<FString> AllowedKeys = FUnrealMCPAssetQuery::GetQueryParamKeys();
+    AllowedKeys.Append({TEXT("assets"), TEXT("limit"), TEXT("cursor"), TEXT("property_path"), TEXT("time_budget_seconds")});
+    if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params, AllowedKeys))
+    {
+        return Err;
+    }
+
+    FString PropertyPath;
+    Params->TryGetStringField(TEXT("property_path"), PropertyPath);
+
+    double BudgetSeconds = DefaultBulkReadBudgetSeconds;
+    Params->TryGetNumberField(TEXT("time_budget_seconds"), BudgetSeconds);
+    BudgetSeconds = FMath::Clamp(BudgetSeconds, 0.0, MaxBulkReadBudgetSeconds);
+
+    // Targets come either as an explicit list or as one page of a query_assets filter
+    TArray<FSoftObjectPath> Targets;
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("assets"), AssetValues))
+    {
+        TSet<FString> FilterKeys = FUnrealMCPAssetQuery::GetQueryParamKeys();
+        FilterKeys.Append({TEXT("limit"), TEXT("cursor")});
+        for (const FString& Key : FilterKeys)
+        {
+            if (Params->HasField(Key))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(
+                    FString::Printf(TEXT("'%s' only applies to filter reads and cannot be combined with 'assets'"), *Key));
+            }
+        }
+        if (AssetValues->Num() > MaxBulkReadPageSize)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Too many assets: %d (max: %d per call)"), AssetValues->Num(), MaxBulkReadPageSize));
+        }
+        for (const TSharedPtr<FJsonValue>& Value : *AssetValues)
+        {
+            FString Path = Value.IsValid() ? Value->AsString() : FString();
+            if (Path.IsEmpty())
+            {
+                continue;
+            }
+            // Content-browser paths ("/Game/X/Y") name the asset after the package
+            if (!Path.Contains(TEXT(".")))
+            {
+                Path += TEXT(".") + FPackageName::GetShortName(Path);
+            }
+            Targets.AddUnique(FSoftObjectPath(Path));
+        }
+    }
+    else
+    {
+        FMCPAssetQuery Query;
+        FString Error;
+        if (!AssetQuery.ParseQuery(Params, Query, Error))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+        }
+
+        int32 Limit = DefaultBulkReadPageSize;
+        Params->TryGetNumberField(TEXT("limit"), Limit);
+        Limit = FMath::Clamp(Limit, 1, MaxBulkReadPageSize);
+
+        FString Cursor;
+        Params->TryGetStringField(TEXT("cursor"), Cursor);
+
+        bool bCacheHit = false;
+        const TSharedRef<const FMCPAssetQueryResult> QueryResult = AssetQuery.Run(Query, true, bCacheHit);
+        const int32 Start = QueryResult->IndexAfter(Cursor);
+        const int32 End = FMath::Min(Start + Limit, QueryResult->Entries.Num());
+        for (int32 Index = Start; Index < End; ++Index)
+        {
+            Targets.Add(QueryResult->Entries[Index].Asset.GetSoftObjectPath());
+        }
+
+        Result->SetNumberField(TEXT("total"), QueryResult->Entries.Num());
+        if (End < QueryResult->Entries.Num())
+        {
+            Result->SetStringField(TEXT("next_cursor"), QueryResult->Entries[End - 1].Key);
+        }
+    }
+
+    if (Targets.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No assets to read: pass 'assets' or a filter that matches something"));
+    }
+
+    // Request every package up front so the loader reads and deserializes them back to back; each
+    // asset is serialized between load slices as soon as its handle completes, in arrival order
+    const double StartSeconds = FPlatformTime::Seconds();
+    FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+    TArray<TSharedPtr<FStreamableHandle>> Handles;
+    Handles.SetNum(Targets.Num());
+    TBitArray<> WasResident(false, Targets.Num());
+    int32 AlreadyLoadedCount = 0;
+    for (int32 Index = 0; Index < Targets.Num(); ++Index)
+    {
+        WasResident[Index] = FUnrealMCPReadLoads::IsResident(Targets[Index].ToString());
+        if (Targets[Index].ResolveObject())
+        {
+            ++AlreadyLoadedCount;
+        }
+        Handles[Index] = StreamableManager.RequestAsyncLoad(Targets[Index], FStreamableDelegate(),
+            FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("UnrealMCP get_assets_bulk"));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> AssetsArr;
+    TBitArray<> Done(false, Targets.Num());
+    int32 Remaining = Targets.Num();
+    int32 FailedCount = 0;
+    const double Deadline = StartSeconds + BudgetSeconds;
+    while (true)
+    {
+        for (int32 Index = 0; Index < Targets.Num(); ++Index)
+        {
+            const TSharedPtr<FStreamableHandle>& Handle = Handles[Index];
+            if (Done[Index] || (Handle.IsValid() && Handle->IsLoadingInProgress()))
+            {
+                continue;
+            }
+            Done[Index] = true;
+            --Remaining;
+
+            TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+            AssetObj->SetStringField(TEXT("path"), Targets[Index].ToString());
+
+            UObject* Asset = Handle.IsValid() ? Handle->GetLoadedAsset() : Targets[Index].ResolveObject();
+            FUnrealMCPReadLoads::Get().TrackRead(Asset, WasResident[Index]);
+            UObject* Target = Asset;
+            FString ReadError;
+            if (!Asset)
+            {
+                ReadError = TEXT("Could not load asset");
+            }
+            else if (const UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+            {
+                // Blueprints read as get_blueprint_defaults does: the generated class CDO
+                Target = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+                if (!Target)
+                {
+                    ReadError = TEXT("Blueprint has no GeneratedClass yet (may need compile)");
+                }
+                if (Blueprint->ParentClass)
+                {
+                    AssetObj->SetStringField(TEXT("parent_class"), Blueprint->ParentClass->GetPathName());
+                }
+            }
+
+            TSharedPtr<FJsonObject> PropsObj;
+            if (Target && ReadAssetProperties(Target, PropertyPath, PropsObj, ReadError))
+            {
+                AssetObj->SetObjectField(TEXT("properties"), PropsObj);
+            }
+            if (Asset)
+            {
+                AssetObj->SetStringField(TEXT("asset_name"), Asset->GetName());
+                AssetObj->SetStringField(TEXT("asset_class"), Asset->GetClass()->GetPathName());
+            }
+            if (!ReadError.IsEmpty())
+            {
+                AssetObj->SetStringField(TEXT("error"), ReadError);
+                ++FailedCount;
+            }
+            AssetsArr.Add(MakeShared<FJsonValueObject>(AssetObj));
+        }
+
+        if (Remaining == 0 || FPlatformTime::Seconds() >= Deadline)
+        {
+            break;
+        }
+        ProcessAsyncLoading(true, false, BulkReadLoadSliceSeconds);
+    }
+
+    // Out of budget: the requests stay queued in the loader, so asking for these again is cheap.
+    // They still count as this read's loads once they land, so they fall under the read-load budget.
+    TArray<TSharedPtr<FJsonValue>> PendingArr;
+    for (int32 Index = 0; Index < Targets.Num(); ++Index)
+    {
+        if (!Done[Index])
+        {
+            PendingArr.Add(MakeShared<FJsonValueString>(Targets[Index].ToString()));
+            if (Handles[Index].IsValid() && !WasResident[Index])
+            {
+                TWeakPtr<FStreamableHandle> WeakHandle = Handles[Index];
+                Handles[Index]->BindCompleteDelegate(FStreamableDelegate::CreateLambda([WeakHandle]()
+                {
+                    if (TSharedPtr<FStreamableHandle> Handle = WeakHandle.Pin())
+                    {
+                        FUnrealMCPReadLoads::Get().TrackLateRead(Handle->GetLoadedAsset());
+                    }
+                }));
+            }
+        }
+    }
+
+    Result->SetArrayField(TEXT("assets"), AssetsArr);
+    Result->SetNumberField(TEXT("count"), AssetsArr.Num());
+    Result->SetNumberField(TEXT("requested"), Targets.Num());
+    Result->SetNumberField(TEXT("already_loaded_count"), AlreadyLoadedCount);
+    Result->SetNumberField(TEXT("failed_count"), FailedCount);
+    Result->SetArrayField(TEXT("pending"), PendingArr);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    if (!PropertyPath.IsEmpty())
+    {
+        Result->SetStringField(TEXT("property_path"), PropertyPath);
+    }
+    return Result;
+}
+
 TArray<FMCPCommandMeta> FUnrealMCPEditorCommands::GetCommandMetadata()
 {
 	return {
-		{TEXT("get_actors_in_level"), TEXT("editor"), TEXT("List all actors in the current level"), {}},
+		{TEXT("get_actors_in_level"), TEXT("editor"), TEXT("List actors in the editor world, filtered, projected and paged"), {
+			{TEXT("class"), TEXT("string"), false, TEXT("Only actors of this class or a subclass")},
+			{TEXT("tag"), TEXT("string"), false, TEXT("Only actors with this tag")},
+			{TEXT("folder"), TEXT("string"), false, TEXT("Only actors in this outliner folder or below it")},
+			{TEXT("level"), TEXT("string"), false, TEXT("Only actors in this level (package path, short name, or 'persistent')")},
+			{TEXT("label"), TEXT("string"), false, TEXT("Wildcard on the actor label, e.g. 'Wall_*'")},
+			{TEXT("fields"), TEXT("array"), false, TEXT("Fields to return: name, label, class, path, location, rotation, scale, bounds, folder, level, tags")},
+			{TEXT("layout"), TEXT("string"), false, TEXT("'rows' (default) or 'columnar' (parallel per-field columns)")},
+			{TEXT("encoding"), TEXT("string"), false, TEXT("Columnar numbers: 'base64' packed float32 (default) or 'array'")},
+			{TEXT("limit"), TEXT("number"), false, TEXT("Page size (default: 1000, max: 10000)")},
+			{TEXT("cursor"), TEXT("string"), false, TEXT("next_cursor from the previous page")},
+			{TEXT("snapshot"), TEXT("string"), false, TEXT("snapshot from the first page; response reports snapshot_changed")}
+		}},
+		{TEXT("get_level_changes"), TEXT("editor"), TEXT("Actor changes since a world revision (incremental sync after get_actors_in_level)"), {
+			{TEXT("since_revision"), TEXT("number"), true, TEXT("'revision' from get_actors_in_level or 'next_revision' from the previous call")},
+			{TEXT("epoch"), TEXT("string"), false, TEXT("'epoch' from the same response; a different editor session forces a resync")},
+			{TEXT("limit"), TEXT("number"), false, TEXT("Max log entries consumed (default: 1000)")},
+			{TEXT("fields"), TEXT("array"), false, TEXT("Fields of the current actor state included per change (see get_actors_in_level)")},
+			{TEXT("coalesce"), TEXT("bool"), false, TEXT("One net change per actor (default: true)")}
+		}},
+		{TEXT("find_world_partition_actors"), TEXT("editor"), TEXT("Query World Partition actor descriptors (loaded or not) without loading cells"), {
+			{TEXT("class"), TEXT("string"), false, TEXT("Only actors of this class or a subclass (blueprint classes match exactly)")},
+			{TEXT("name"), TEXT("string"), false, TEXT("Wildcard (* ?) on actor name or label")},
+			{TEXT("min"), TEXT("array"), false, TEXT("[x, y, z] box minimum (with 'max'); editor bounds must intersect")},
+			{TEXT("max"), TEXT("array"), false, TEXT("[x, y, z] box maximum (with 'min')")},
+			{TEXT("center"), TEXT("array"), false, TEXT("[x, y, z] box center (with 'extent')")},
+			{TEXT("extent"), TEXT("array"), false, TEXT("[x, y, z] half-size (with 'center')")},
+			{TEXT("data_layer"), TEXT("string"), false, TEXT("Data layer instance name, short name or asset path")},
+			{TEXT("loaded"), TEXT("bool"), false, TEXT("Only loaded (true) or only unloaded (false) actors")},
+			{TEXT("limit"), TEXT("number"), false, TEXT("Page size (default: 1000, max 10000)")},
+			{TEXT("cursor"), TEXT("string"), false, TEXT("next_cursor from the previous page")}
+		}},
+		{TEXT("load_world_partition_actors"), TEXT("editor"), TEXT("Load and pin individual World Partition actors (not their cells)"), {
+			{TEXT("guids"), TEXT("array"), false, TEXT("Actor guids from find_world_partition_actors")},
+			{TEXT("names"), TEXT("array"), false, TEXT("Actor names, package paths or labels; a name matching several actors is an error that lists their GUIDs and packages")}
+		}},
+		{TEXT("release_world_partition_actors"), TEXT("editor"), TEXT("Drop pins taken by load_world_partition_actors or edit commands; actors with unsaved changes stay pinned"), {
+			{TEXT("guids"), TEXT("array"), false, TEXT("Actor guids to release (default: all)")}
+		}},
 		{TEXT("find_actors_by_name"), TEXT("editor"), TEXT("Find actors matching a name pattern"), {
 			{TEXT("pattern"), TEXT("string"), true, TEXT("Pattern to match against actor names")}
 		}},
+		{TEXT("find_actors_in_box"), TEXT("editor"), TEXT("Actors whose bounds intersect an axis-aligned box (octree-backed)"), {
+			{TEXT("min"), TEXT("array"), false, TEXT("[x, y, z] box minimum (with 'max')")},
+			{TEXT("max"), TEXT("array"), false, TEXT("[x, y, z] box maximum (with 'min')")},
+			{TEXT("center"), TEXT("array"), false, TEXT("[x, y, z] box center (with 'extent')")},
+			{TEXT("extent"), TEXT("array"), false, TEXT("[x, y, z] half-size (with 'center')")},
+			{TEXT("class"), TEXT("string"), false, TEXT("Only actors of this class or a subclass")},
+			{TEXT("tag"), TEXT("string"), false, TEXT("Only actors with this tag")},
+			{TEXT("fields"), TEXT("array"), false, TEXT("Fields to return: name, label, class, path, location, rotation, scale, bounds, folder, level, tags")},
+			{TEXT("layout"), TEXT("string"), false, TEXT("'rows' (default) or 'columnar' (see get_actors_in_level)")},
+			{TEXT("limit"), TEXT("number"), false, TEXT("Max actors returned (default: 1000)")},
+			{TEXT("refresh"), TEXT("bool"), false, TEXT("Rebuild the spatial index first")}
+		}},
+		{TEXT("find_actors_in_sphere"), TEXT("editor"), TEXT("Actors whose bounds intersect a sphere (octree-backed)"), {
+			{TEXT("center"), TEXT("array"), true, TEXT("[x, y, z]")},
+			{TEXT("radius"), TEXT("number"), true, TEXT("Sphere radius")},
+			{TEXT("class"), TEXT("string"), false, TEXT("Only actors of this class or a subclass")},
+			{TEXT("tag"), TEXT("string"), false, TEXT("Only actors with this tag")},
+			{TEXT("fields"), TEXT("array"), false, TEXT("Fields to return (see find_actors_in_box)")},
+			{TEXT("layout"), TEXT("string"), false, TEXT("'rows' (default) or 'columnar'")},
+			{TEXT("limit"), TEXT("number"), false, TEXT("Max actors returned (default: 1000)")},
+			{TEXT("refresh"), TEXT("bool"), false, TEXT("Rebuild the spatial index first")}
+		}},
+		{TEXT("find_actors_in_frustum"), TEXT("editor"), TEXT("Actors whose bounds intersect a view frustum (octree-backed)"), {
+			{TEXT("use_viewport"), TEXT("bool"), false, TEXT("Use the active editor viewport's camera")},
+			{TEXT("origin"), TEXT("array"), false, TEXT("[x, y, z] camera location (required without use_viewport)")},
+			{TEXT("rotation"), TEXT("array"), false, TEXT("[pitch, yaw, roll] camera rotation (required without use_viewport)")},
+			{TEXT("fov"), TEXT("number"), false, TEXT("Horizontal field of view in degrees (default: 90 or the viewport's)")},
+			{TEXT("aspect_ratio"), TEXT("number"), false, TEXT("Width / height (default: 16:9 or the viewport's)")},
+			{TEXT("near"), TEXT("number"), false, TEXT("Near distance (default: 10)")},
+			{TEXT("far"), TEXT("number"), false, TEXT("Far distance (default: 100000)")},
+			{TEXT("class"), TEXT("string"), false, TEXT("Only actors of this class or a subclass")},
+			{TEXT("tag"), TEXT("string"), false, TEXT("Only actors with this tag")},
+			{TEXT("fields"), TEXT("array"), false, TEXT("Fields to return (see find_actors_in_box)")},
+			{TEXT("layout"), TEXT("string"), false, TEXT("'rows' (default) or 'columnar'")},
+			{TEXT("limit"), TEXT("number"), false, TEXT("Max actors returned (default: 1000)")},
+			{TEXT("refresh"), TEXT("bool"), false, TEXT("Rebuild the spatial index first")}
+		}},
+		{TEXT("find_nearest_actors"), TEXT("editor"), TEXT("N actors nearest to a point, by distance to their bounds"), {
+			{TEXT("point"), TEXT("array"), true, TEXT("[x, y, z]")},
+			{TEXT("count"), TEXT("number"), false, TEXT("Number of actors (default: 10)")},
+			{TEXT("max_distance"), TEXT("number"), false, TEXT("Ignore actors farther than this (default: unbounded)")},
+			{TEXT("class"), TEXT("string"), false, TEXT("Only actors of this class or a subclass")},
+			{TEXT("tag"), TEXT("string"), false, TEXT("Only actors with this tag")},
+			{TEXT("fields"), TEXT("array"), false, TEXT("Fields to return (see find_actors_in_box); distance is always included")},
+			{TEXT("layout"), TEXT("string"), false, TEXT("'rows' (default) or 'columnar'")},
+			{TEXT("refresh"), TEXT("bool"), false, TEXT("Rebuild the spatial index first")}
+		}},
 		{TEXT("spawn_actor"), TEXT("editor"), TEXT("Spawn an actor in the level"), {
 			{TEXT("type"), TEXT("string"), true, TEXT("Actor class or built-in shortcut (StaticMeshActor, PointLight, etc.) or full class path")},
 			{TEXT("name"), TEXT("string"), true, TEXT("Unique actor instance name")},
@@ -1309,21 +3235,52 @@ TArray<FMCPCommandMeta> FUnrealMCPEditorCommands::GetCommandMetadata()
 			{TEXT("rotation"), TEXT("object"), false, TEXT("{pitch, yaw, roll}")},
 			{TEXT("scale"), TEXT("object"), false, TEXT("{x, y, z}")}
 		}},
+		{TEXT("spawn_actors"), TEXT("editor"), TEXT("Spawn many actors in one transaction, optionally merging static meshes into (H)ISM actors"), {
+			{TEXT("actors"), TEXT("array"), true, TEXT("[{class|blueprint, name, location, rotation, scale, static_mesh, folder}] (max 10000)")},
+			{TEXT("class"), TEXT("string"), false, TEXT("Default class for entries without class/blueprint (default: StaticMeshActor)")},
+			{TEXT("blueprint"), TEXT("string"), false, TEXT("Default Blueprint for entries without class/blueprint")},
+			{TEXT("static_mesh"), TEXT("string"), false, TEXT("Default static mesh for StaticMeshActor entries")},
+			{TEXT("folder"), TEXT("string"), false, TEXT("Default outliner folder")},
+			{TEXT("instancing"), TEXT("string"), false, TEXT("'none' (default), 'ism' or 'hism': merge unnamed StaticMeshActor entries per mesh")},
+			{TEXT("instance_actor_prefix"), TEXT("string"), false, TEXT("Name prefix for instanced actors (default: ISM)")}
+		}},
 		{TEXT("delete_actor"), TEXT("editor"), TEXT("Delete an actor from the level"), {
-			{TEXT("name"), TEXT("string"), true, TEXT("Actor name")}
+			{TEXT("name"), TEXT("string"), true, TEXT("Actor object name")},
+			{TEXT("match_label"), TEXT("bool"), false, TEXT("Also accept an editor label when no actor has this object name; fails if several actors share it (default: false)")}
 		}},
 		{TEXT("set_actor_transform"), TEXT("editor"), TEXT("Set an actor's transform"), {
-			{TEXT("name"), TEXT("string"), true, TEXT("Actor name")},
+			{TEXT("name"), TEXT("string"), true, TEXT("Actor object name")},
+			{TEXT("match_label"), TEXT("bool"), false, TEXT("Also accept an editor label when no actor has this object name; fails if several actors share it (default: false)")},
 			{TEXT("location"), TEXT("object"), false, TEXT("{x, y, z}")},
 			{TEXT("rotation"), TEXT("object"), false, TEXT("{pitch, yaw, roll}")},
 			{TEXT("scale"), TEXT("object"), false, TEXT("{x, y, z}")}
 		}},
+		{TEXT("set_actor_transforms"), TEXT("editor"), TEXT("Move many actors in one undo transaction (absolute or relative, with snapping)"), {
+			{TEXT("names"), TEXT("array"), false, TEXT("Actor object names (or use filter / in_box / in_sphere)")},
+			{TEXT("match_label"), TEXT("bool"), false, TEXT("Also accept an editor label when no actor has this object name; fails if several actors share it (default: false)")},
+			{TEXT("filter"), TEXT("object"), false, TEXT("{class, tag, folder, level, label} as in get_actors_in_level")},
+			{TEXT("in_box"), TEXT("object"), false, TEXT("{min, max}: actors whose bounds intersect the box")},
+			{TEXT("in_sphere"), TEXT("object"), false, TEXT("{center, radius}: actors whose bounds intersect the sphere")},
+			{TEXT("mode"), TEXT("string"), false, TEXT("'relative' (default) or 'absolute'")},
+			{TEXT("location"), TEXT("array"), false, TEXT("Absolute: [x, y, z]")},
+			{TEXT("rotation"), TEXT("array"), false, TEXT("Absolute: [pitch, yaw, roll]")},
+			{TEXT("scale"), TEXT("array"), false, TEXT("Absolute: [x, y, z]")},
+			{TEXT("matrix"), TEXT("array"), false, TEXT("Relative: 16 numbers, row-major 4x4 applied in world space (about pivot)")},
+			{TEXT("rotate"), TEXT("array"), false, TEXT("Relative: [pitch, yaw, roll] delta, about pivot or each actor's own location")},
+			{TEXT("offset"), TEXT("array"), false, TEXT("Relative: [x, y, z] added to location")},
+			{TEXT("scale_by"), TEXT("array"), false, TEXT("Relative: [x, y, z] multiplied into scale")},
+			{TEXT("pivot"), TEXT("array"), false, TEXT("Relative: [x, y, z] pivot for matrix / rotate")},
+			{TEXT("snap"), TEXT("number"), false, TEXT("Location grid size, or [x, y, z] per axis; applied last")},
+			{TEXT("snap_rotation"), TEXT("number"), false, TEXT("Rotation grid in degrees; applied last")}
+		}},
 		{TEXT("get_actor_properties"), TEXT("editor"), TEXT("Get detailed properties of an actor"), {
-			{TEXT("name"), TEXT("string"), true, TEXT("Actor name")}
+			{TEXT("name"), TEXT("string"), true, TEXT("Actor object name, or its label when no actor has that name")},
+			{TEXT("property_path"), TEXT("string"), false, TEXT("Read only this property path (e.g. RootComponent.RelativeLocation, Subobject:Mesh.BodyInstance)")}
 		}},
 		{TEXT("set_actor_property"), TEXT("editor"), TEXT("Set a single property on an actor"), {
-			{TEXT("name"), TEXT("string"), true, TEXT("Actor name")},
-			{TEXT("property_name"), TEXT("string"), true, TEXT("Property name")},
+			{TEXT("name"), TEXT("string"), true, TEXT("Actor object name")},
+			{TEXT("match_label"), TEXT("bool"), false, TEXT("Also accept an editor label when no actor has this object name; fails if several actors share it (default: false)")},
+			{TEXT("property_name"), TEXT("string"), true, TEXT("Property name or path (e.g. Subobject:Mesh.BodyInstance.MassScale)")},
 			{TEXT("property_value"), TEXT("any"), true, TEXT("Value to set")}
 		}},
 		{TEXT("spawn_blueprint_actor"), TEXT("editor"), TEXT("Spawn an instance of a Blueprint class"), {
@@ -1334,7 +3291,7 @@ TArray<FMCPCommandMeta> FUnrealMCPEditorCommands::GetCommandMetadata()
 			{TEXT("scale"), TEXT("object"), false, TEXT("{x, y, z}")}
 		}},
 		{TEXT("focus_viewport"), TEXT("editor"), TEXT("Move the editor viewport to a target"), {
-			{TEXT("target"), TEXT("string"), false, TEXT("Actor name to focus on")},
+			{TEXT("target"), TEXT("string"), false, TEXT("Actor object name (or label) to focus on")},
 			{TEXT("location"), TEXT("object"), false, TEXT("{x, y, z} to focus on")},
 			{TEXT("distance"), TEXT("number"), false, TEXT("View distance (default: 1000)")},
 			{TEXT("orientation"), TEXT("object"), false, TEXT("{pitch, yaw, roll}")}
@@ -1359,17 +3316,20 @@ TArray<FMCPCommandMeta> FUnrealMCPEditorCommands::GetCommandMetadata()
 		{TEXT("call_subsystem_function"), TEXT("editor"), TEXT("Call a BlueprintCallable function on a WorldSubsystem"), {
 			{TEXT("subsystem_class"), TEXT("string"), true, TEXT("Full class path")},
 			{TEXT("function_name"), TEXT("string"), true, TEXT("Function to call")},
-			{TEXT("parameters"), TEXT("object"), false, TEXT("Function parameters as key-value pairs")}
+			{TEXT("parameters"), TEXT("object"), false, TEXT("Function parameters as key-value pairs")},
+			{TEXT("parameter_sets"), TEXT("array"), false, TEXT("Batch form: one parameters object per call, all invoked in one game-thread hop; returns results[]")},
+			{TEXT("stop_on_error"), TEXT("bool"), false, TEXT("Batch form: stop at the first failed call (default: false)")}
 		}},
 		{TEXT("add_to_actor_array_property"), TEXT("editor"), TEXT("Add actor references to an array property"), {
-			{TEXT("actor_name"), TEXT("string"), true, TEXT("Actor containing the array")},
+			{TEXT("actor_name"), TEXT("string"), true, TEXT("Object name of the actor containing the array")},
+			{TEXT("match_label"), TEXT("bool"), false, TEXT("Also accept an editor label when no actor has this object name (applies to elements too); fails if several actors share it (default: false)")},
 			{TEXT("property_name"), TEXT("string"), true, TEXT("Array property name")},
 			{TEXT("element_name"), TEXT("string"), false, TEXT("Single actor name to add")},
 			{TEXT("element_names"), TEXT("array"), false, TEXT("Array of actor names to add")}
 		}},
 		{TEXT("get_data_asset"), TEXT("editor"), TEXT("Read a DataAsset (or any UObject asset with allow_any_object=true) as JSON properties"), {
 			{TEXT("path"), TEXT("string"), true, TEXT("Content-browser or object path (/Game/.../Asset or /Game/.../Asset.Asset)")},
-			{TEXT("property_path"), TEXT("string"), false, TEXT("Optional top-level property name to narrow the dump")},
+			{TEXT("property_path"), TEXT("string"), false, TEXT("Optional property path to read instead of the full dump (e.g. Entries[0].Tag, Map[Key], Subobject:Name.Prop)")},
 			{TEXT("allow_any_object"), TEXT("bool"), false, TEXT("Read non-DataAsset UObject assets too (default: false)")}
 		}},
 		{TEXT("find_assets"), TEXT("editor"), TEXT("List assets under a path, optionally filtered by class or name pattern (uses AssetRegistry, no asset loading)"), {
@@ -1377,6 +3337,32 @@ TArray<FMCPCommandMeta> FUnrealMCPEditorCommands::GetCommandMetadata()
 			{TEXT("class_name"), TEXT("string"), false, TEXT("Filter by asset class (short name or full path; recursive by subclass)")},
 			{TEXT("recursive"), TEXT("bool"), false, TEXT("Recurse into subfolders (default: true)")},
 			{TEXT("name_pattern"), TEXT("string"), false, TEXT("Wildcard glob on asset name (case-insensitive)")}
+		}},
+		{TEXT("query_assets"), TEXT("editor"), TEXT("Sorted, paged asset registry query with multiple classes and tag/value predicates; results cached until the registry changes (no asset loading)"), {
+			{TEXT("paths"), TEXT("array"), false, TEXT("Package paths (default: [\"/Game\"]); 'path' accepts a single one")},
+			{TEXT("recursive"), TEXT("bool"), false, TEXT("Recurse into subfolders (default: true)")},
+			{TEXT("classes"), TEXT("array"), false, TEXT("Asset classes, short names or full paths (blueprint class paths allowed); 'class' accepts a single one")},
+			{TEXT("recursive_classes"), TEXT("bool"), false, TEXT("Include subclasses (default: true)")},
+			{TEXT("name"), TEXT("string"), false, TEXT("Wildcard glob on asset name (case-insensitive)")},
+			{TEXT("tags"), TEXT("array"), false, TEXT("[{key, op, value}] with op eq (default), ne, contains, glob, exists, missing, lt, le, gt, ge; all must match")},
+			{TEXT("return_tags"), TEXT("array"), false, TEXT("Tag keys to include per asset (\"*\" for all)")},
+			{TEXT("sort"), TEXT("string"), false, TEXT("name (default), path or class")},
+			{TEXT("descending"), TEXT("bool"), false, TEXT("Reverse the sort order (default: false)")},
+			{TEXT("on_disk_only"), TEXT("bool"), false, TEXT("Skip in-memory-only assets (default: false)")},
+			{TEXT("limit"), TEXT("int"), false, TEXT("Page size (default: 500, max: 10000)")},
+			{TEXT("cursor"), TEXT("string"), false, TEXT("next_cursor from the previous page")},
+			{TEXT("no_cache"), TEXT("bool"), false, TEXT("Bypass the result cache (default: false)")}
+		}},
+		{TEXT("get_assets_bulk"), TEXT("editor"), TEXT("Read many assets' properties in one call; packages load asynchronously and each asset is serialized as it arrives (blueprints read their CDO)"), {
+			{TEXT("assets"), TEXT("array"), false, TEXT("Asset paths to read (max: 1000); otherwise the query_assets filter params select them")},
+			{TEXT("paths"), TEXT("array"), false, TEXT("Filter: package paths (default: [\"/Game\"]); 'path' accepts a single one")},
+			{TEXT("classes"), TEXT("array"), false, TEXT("Filter: asset classes; 'class' accepts a single one")},
+			{TEXT("name"), TEXT("string"), false, TEXT("Filter: wildcard glob on asset name")},
+			{TEXT("tags"), TEXT("array"), false, TEXT("Filter: tag predicates as in query_assets (recursive, sort, descending, on_disk_only apply too)")},
+			{TEXT("limit"), TEXT("int"), false, TEXT("Filter page size (default: 100, max: 1000)")},
+			{TEXT("cursor"), TEXT("string"), false, TEXT("next_cursor from the previous page")},
+			{TEXT("property_path"), TEXT("string"), false, TEXT("Read only this property path from each asset")},
+			{TEXT("time_budget_seconds"), TEXT("number"), false, TEXT("Stop waiting for loads after this long; the rest are returned in 'pending' (default: 20, max: 50)")}
 		}}
 	};
 }
@@ -0,0 +1,219 @@
+#include "Commands/UnrealMCPFunctionPlans.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPPropertyPlans.h"
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "JsonObjectConverter.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+bool FMCPFunctionPlan::Invoke(UObject* Target, const TSharedPtr<FJsonObject>& Arguments, const TSharedRef<FJsonObject>& OutResult, FString& OutErrorMessage) const
+{
+    UFunction* Func = Function.Get();
+    if (!Func || !Target)
+    {
+        OutErrorMessage = TEXT("Function or target no longer valid");
+        return false;
+    }
+
+    uint8* Buffer = static_cast<uint8*>(FMemory_Alloca_Aligned(FMath::Max(ParmsSize, 1), MinAlignment));
+    FMemory::Memzero(Buffer, ParmsSize);
+    for (const FParam& Param : Params)
+    {
+        if (Param.bNeedsInit)
+        {
+            Param.Property->InitializeValue_InContainer(Buffer);
+        }
+    }
+
+    bool bSuccess = true;
+    if (Arguments.IsValid())
+    {
+        for (int32 Index : Inputs)
+        {
+            const FParam& Param = Params[Index];
+            const TSharedPtr<FJsonValue>* Value = Arguments->Values.Find(Param.Name);
+            if (Value && Value->IsValid() && !Param.Plan->ApplyInContainer(Buffer, *Value, OutErrorMessage))
+            {
+                OutErrorMessage = FString::Printf(TEXT("Parameter '%s': %s"), *Param.Name, *OutErrorMessage);
+                bSuccess = false;
+                break;
+            }
+        }
+    }
+
+    if (bSuccess)
+    {
+        Target->ProcessEvent(Func, Buffer);
+
+        for (int32 Index : Outputs)
+        {
+            const FParam& Param = Params[Index];
+            const void* ValuePtr = Param.Property->ContainerPtrToValuePtr<void>(Buffer);
+            if (Param.bObjectResult)
+            {
+                if (UObject* ObjectValue = CastFieldChecked<FObjectPropertyBase>(Param.Property)->GetObjectPropertyValue(ValuePtr))
+                {
+                    OutResult->SetStringField(Param.Name, ObjectValue->GetName());
+                    if (AActor* Actor = Cast<AActor>(ObjectValue))
+                    {
+                        OutResult->SetObjectField(Param.Name + TEXT("_details"), FUnrealMCPCommonUtils::ActorToJsonObject(Actor));
+                    }
+                }
+            }
+            else if (TSharedPtr<FJsonValue> JsonValue = FJsonObjectConverter::UPropertyToJsonValue(Param.Property, ValuePtr))
+            {
+                OutResult->SetField(Param.Name, JsonValue);
+            }
+        }
+    }
+
+    for (const FParam& Param : Params)
+    {
+        if (Param.bNeedsDestroy)
+        {
+            Param.Property->DestroyValue_InContainer(Buffer);
+        }
+    }
+    return bSuccess;
+}
+
+FUnrealMCPFunctionPlans& FUnrealMCPFunctionPlans::Get()
+{
+    static FUnrealMCPFunctionPlans FunctionPlans;
+    return FunctionPlans;
+}
+
+FUnrealMCPFunctionPlans::FUnrealMCPFunctionPlans()
+    : bInitialized(false)
+{
+}
+
+void FUnrealMCPFunctionPlans::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealMCPFunctionPlans::HandleModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason /*Reason*/) { Invalidate(); });
+    if (GEditor)
+    {
+        BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FUnrealMCPFunctionPlans::HandleBlueprintPreCompile);
+    }
+
+    bInitialized = true;
+}
+
+void FUnrealMCPFunctionPlans::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+    }
+
+    bInitialized = false;
+    Invalidate();
+}
+
+TSharedPtr<const FMCPFunctionPlan> FUnrealMCPFunctionPlans::FindPlan(UClass* Class, FName FunctionName)
+{
+    if (!Class || FunctionName.IsNone())
+    {
+        return nullptr;
+    }
+
+    const TPair<const UClass*, FName> Key(Class, FunctionName);
+    if (const TSharedPtr<const FMCPFunctionPlan>* Existing = Plans.Find(Key))
+    {
+        // A collected class whose address was reused fails the weak check and is rebuilt
+        if ((*Existing)->Class.Get() == Class && (*Existing)->Function.IsValid())
+        {
+            return *Existing;
+        }
+        Plans.Remove(Key);
+    }
+
+    UFunction* Function = Class->FindFunctionByName(FunctionName);
+    if (!Function)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FMCPFunctionPlan> Plan = MakeShared<FMCPFunctionPlan>();
+    BuildPlan(Class, Function, *Plan);
+    Plans.Add(Key, Plan);
+    return Plan;
+}
+
+int32 FUnrealMCPFunctionPlans::Num() const
+{
+    return Plans.Num();
+}
+
+void FUnrealMCPFunctionPlans::Invalidate()
+{
+    Plans.Reset();
+}
+
+void FUnrealMCPFunctionPlans::BuildPlan(UClass* Class, UFunction* Function, FMCPFunctionPlan& OutPlan)
+{
+    OutPlan.Class = Class;
+    OutPlan.Function = Function;
+    OutPlan.ParmsSize = Function->ParmsSize;
+    OutPlan.MinAlignment = FMath::Max(Function->GetMinAlignment(), 1);
+
+    FUnrealMCPPropertyPlans& PropertyPlans = FUnrealMCPPropertyPlans::Get();
+    for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+    {
+        FProperty* Property = *It;
+        const int32 Index = OutPlan.Params.AddDefaulted();
+        FMCPFunctionPlan::FParam& Param = OutPlan.Params[Index];
+        Param.Property = Property;
+        Param.Name = Property->GetName();
+        Param.bNeedsInit = !Property->HasAnyPropertyFlags(CPF_ZeroConstructor);
+        Param.bNeedsDestroy = !Property->HasAnyPropertyFlags(CPF_NoDestructor);
+        Param.bObjectResult = Property->IsA<FObjectProperty>();
+
+        if (!Property->HasAnyPropertyFlags(CPF_ReturnParm))
+        {
+            Param.Plan = PropertyPlans.FindPlan(Function, Property->GetFName());
+            OutPlan.Inputs.Add(Index);
+        }
+        if (Property->HasAnyPropertyFlags(CPF_ReturnParm | CPF_OutParm))
+        {
+            OutPlan.Outputs.Add(Index);
+        }
+    }
+}
+
+void FUnrealMCPFunctionPlans::HandleModulesChanged(FName /*ModuleName*/, EModuleChangeReason Reason)
+{
+    if (Reason == EModuleChangeReason::ModuleLoaded)
+    {
+        Invalidate();
+    }
+}
+
+void FUnrealMCPFunctionPlans::HandleBlueprintPreCompile(UBlueprint* /*Blueprint*/)
+{
+    // Functions of blueprint classes (and native classes' blueprint children) are regenerated by the compile
+    for (auto It = Plans.CreateIterator(); It; ++It)
+    {
+        const UFunction* Function = It.Value()->Function.Get();
+        if (!Function || !Function->GetOutermost()->HasAnyPackageFlags(PKG_CompiledIn))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
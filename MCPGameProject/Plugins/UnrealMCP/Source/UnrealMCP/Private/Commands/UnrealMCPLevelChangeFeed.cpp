@@ -0,0 +1,210 @@
+#include "Commands/UnrealMCPLevelChangeFeed.h"
+#include "Algo/BinarySearch.h"
+#include "Components/ActorComponent.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Guid.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+const int32 DefaultChangeLogCapacity = 10000;
+const int32 MinChangeLogCapacity = 64;
+}
+
+FUnrealMCPLevelChangeFeed& FUnrealMCPLevelChangeFeed::Get()
+{
+    static FUnrealMCPLevelChangeFeed Feed;
+    return Feed;
+}
+
+FUnrealMCPLevelChangeFeed::FUnrealMCPLevelChangeFeed()
+    : Capacity(DefaultChangeLogCapacity)
+    , Revision(0)
+    , ResyncRevision(0)
+    , Epoch(FGuid::NewGuid().ToString(EGuidFormats::Short))
+    , bInitialized(false)
+{
+}
+
+void FUnrealMCPLevelChangeFeed::Initialize()
+{
+    if (bInitialized || !GEngine)
+    {
+        return;
+    }
+
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FUnrealMCPLevelChangeFeed::HandleActorAdded);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FUnrealMCPLevelChangeFeed::HandleActorDeleted);
+    ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FUnrealMCPLevelChangeFeed::HandleActorMoved);
+    ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FUnrealMCPLevelChangeFeed::RequireResync);
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FUnrealMCPLevelChangeFeed::HandleActorLabelChanged);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FUnrealMCPLevelChangeFeed::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FUnrealMCPLevelChangeFeed::RequireResync);
+    MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32 /*MapChangeFlags*/) { RequireResync(); });
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FUnrealMCPLevelChangeFeed::HandleLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FUnrealMCPLevelChangeFeed::HandleLevelChanged);
+
+    bInitialized = true;
+}
+
+void FUnrealMCPLevelChangeFeed::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+        GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+    }
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    FEditorDelegates::MapChange.Remove(MapChangeHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+    bInitialized = false;
+    RequireResync();
+}
+
+void FUnrealMCPLevelChangeFeed::SetCapacity(int32 InCapacity)
+{
+    Capacity = FMath::Max(MinChangeLogCapacity, InCapacity);
+}
+
+void FUnrealMCPLevelChangeFeed::RecordChange(AActor* Actor, EMCPLevelChangeType Type)
+{
+    if (!IsTrackedWorld(Actor))
+    {
+        return;
+    }
+
+    const FObjectKey ActorKey(Actor);
+    ++Revision;
+
+    // Collapse repeats into the newest entry; it stays last, so the log stays sorted by revision
+    if (Log.Num() > 0 && Log.Last().ActorKey == ActorKey && Log.Last().Type == Type)
+    {
+        Log.Last().Revision = Revision;
+        Log.Last().Name = Actor->GetName();
+        ChangeRecordedEvent.Broadcast(Log.Last());
+        return;
+    }
+
+    FMCPLevelChange& Change = Log.AddDefaulted_GetRef();
+    Change.Revision = Revision;
+    Change.Type = Type;
+    Change.ActorKey = ActorKey;
+    Change.Actor = Actor;
+    Change.Name = Actor->GetName();
+    Change.Path = Actor->GetPathName();
+
+    if (Log.Num() > Capacity)
+    {
+        // Drop a quarter at a time so trimming is amortized O(1) per change
+        const int32 DropCount = FMath::Max(1, Capacity / 4);
+        ResyncRevision = FMath::Max(ResyncRevision, Log[DropCount - 1].Revision);
+        Log.RemoveAt(0, DropCount, EAllowShrinking::No);
+    }
+    ChangeRecordedEvent.Broadcast(Log.Last());
+}
+
+bool FUnrealMCPLevelChangeFeed::GetChangesSince(uint64 SinceRevision, int32 MaxEntries, TArray<FMCPLevelChange>& OutChanges, bool& bOutHasMore) const
+{
+    bOutHasMore = false;
+    // A revision from the future belongs to an earlier editor session
+    if (SinceRevision < ResyncRevision || SinceRevision > Revision)
+    {
+        return false;
+    }
+
+    const int32 First = Algo::UpperBoundBy(Log, SinceRevision, &FMCPLevelChange::Revision);
+    const int32 Count = FMath::Min(Log.Num() - First, FMath::Max(1, MaxEntries));
+    OutChanges.Reserve(OutChanges.Num() + Count);
+    for (int32 Index = First; Index < First + Count; ++Index)
+    {
+        OutChanges.Add(Log[Index]);
+    }
+    bOutHasMore = First + Count < Log.Num();
+    return true;
+}
+
+const TCHAR* FUnrealMCPLevelChangeFeed::ChangeTypeToString(EMCPLevelChangeType Type)
+{
+    switch (Type)
+    {
+    case EMCPLevelChangeType::Added:
+        return TEXT("added");
+    case EMCPLevelChangeType::Removed:
+        return TEXT("removed");
+    case EMCPLevelChangeType::Moved:
+        return TEXT("moved");
+    case EMCPLevelChangeType::Modified:
+    default:
+        return TEXT("modified");
+    }
+}
+
+bool FUnrealMCPLevelChangeFeed::IsTrackedWorld(const AActor* Actor) const
+{
+    // Editor world only: PIE, preview scenes and editor tool worlds would flood the log
+    const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    return World && World->WorldType == EWorldType::Editor;
+}
+
+void FUnrealMCPLevelChangeFeed::RequireResync()
+{
+    ++Revision;
+    ResyncRevision = Revision;
+    Log.Reset();
+    ResyncRequiredEvent.Broadcast();
+}
+
+void FUnrealMCPLevelChangeFeed::HandleActorAdded(AActor* Actor)
+{
+    RecordChange(Actor, EMCPLevelChangeType::Added);
+}
+
+void FUnrealMCPLevelChangeFeed::HandleActorDeleted(AActor* Actor)
+{
+    RecordChange(Actor, EMCPLevelChangeType::Removed);
+}
+
+void FUnrealMCPLevelChangeFeed::HandleActorMoved(AActor* Actor)
+{
+    RecordChange(Actor, EMCPLevelChangeType::Moved);
+}
+
+void FUnrealMCPLevelChangeFeed::HandleActorLabelChanged(AActor* Actor)
+{
+    RecordChange(Actor, EMCPLevelChangeType::Modified);
+}
+
+void FUnrealMCPLevelChangeFeed::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& /*Event*/)
+{
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        RecordChange(Actor, EMCPLevelChangeType::Modified);
+    }
+    else if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+    {
+        RecordChange(Component->GetOwner(), EMCPLevelChangeType::Modified);
+    }
+}
+
+void FUnrealMCPLevelChangeFeed::HandleLevelChanged(ULevel* /*Level*/, UWorld* World)
+{
+    if (World && World->WorldType == EWorldType::Editor)
+    {
+        RequireResync();
+    }
+}
@@ -0,0 +1,784 @@
+#include "Commands/UnrealMCPPropertyPlans.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "JsonObjectConverter.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+// Object {X, Y, Z}-style fields or an array of at least Num numbers
+bool ReadComponents(const TSharedPtr<FJsonValue>& Value, const TCHAR* const* FieldNames, int32 Num, double* OutComponents)
+{
+    if (Value->Type == EJson::Object)
+    {
+        const TSharedPtr<FJsonObject>& JsonObj = Value->AsObject();
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            if (!JsonObj->TryGetNumberField(FieldNames[Index], OutComponents[Index]))
+            {
+                OutComponents[Index] = 0.0;
+            }
+        }
+        return true;
+    }
+    if (Value->Type == EJson::Array)
+    {
+        const TArray<TSharedPtr<FJsonValue>>& JsonArray = Value->AsArray();
+        if (JsonArray.Num() < Num)
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            OutComponents[Index] = JsonArray[Index]->AsNumber();
+        }
+        return true;
+    }
+    return false;
+}
+
+// Types declared in C++ never change layout outside a hot reload or module load
+bool IsCompiledIn(const UStruct* Struct)
+{
+    return Struct->GetOutermost()->HasAnyPackageFlags(PKG_CompiledIn);
+}
+
+struct FPathSegment
+{
+    FString Name;
+    // Bracketed array indices / map keys following the name, in order
+    TArray<FString, TInlineAllocator<1>> Keys;
+    bool bSubobject = false;
+};
+
+// "Comp.Points[3].X" -> {Comp}, {Points, [3]}, {X}; dots inside brackets belong to the key
+bool ParsePath(const FString& Path, TArray<FPathSegment>& OutSegments, FString& OutErrorMessage)
+{
+    static const FString SubobjectPrefix = TEXT("Subobject:");
+
+    TArray<FString> Parts;
+    int32 Depth = 0;
+    int32 Start = 0;
+    for (int32 Index = 0; Index <= Path.Len(); ++Index)
+    {
+        const TCHAR Char = Index < Path.Len() ? Path[Index] : TEXT('.');
+        if (Char == TEXT('['))
+        {
+            ++Depth;
+        }
+        else if (Char == TEXT(']'))
+        {
+            --Depth;
+        }
+        else if (Char == TEXT('.') && Depth == 0)
+        {
+            Parts.Add(Path.Mid(Start, Index - Start).TrimStartAndEnd());
+            Start = Index + 1;
+        }
+    }
+    if (Depth != 0)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Unbalanced brackets in property path: %s"), *Path);
+        return false;
+    }
+
+    for (const FString& Part : Parts)
+    {
+        FPathSegment& Segment = OutSegments.AddDefaulted_GetRef();
+        FString Rest = Part;
+        if (Rest.StartsWith(SubobjectPrefix))
+        {
+            Segment.bSubobject = true;
+            Rest.RightChopInline(SubobjectPrefix.Len());
+        }
+
+        int32 Bracket = INDEX_NONE;
+        Rest.FindChar(TEXT('['), Bracket);
+        Segment.Name = (Bracket == INDEX_NONE ? Rest : Rest.Left(Bracket)).TrimStartAndEnd();
+        while (Bracket != INDEX_NONE)
+        {
+            int32 Close = INDEX_NONE;
+            if (!Rest.FindChar(TEXT(']'), Close) || Close < Bracket)
+            {
+                break;
+            }
+            FString Key = Rest.Mid(Bracket + 1, Close - Bracket - 1).TrimStartAndEnd();
+            if (Key.Len() >= 2 && (Key[0] == TEXT('"') || Key[0] == TEXT('\'')) && Key[Key.Len() - 1] == Key[0])
+            {
+                Key = Key.Mid(1, Key.Len() - 2);
+            }
+            Segment.Keys.Add(Key);
+            Rest.RightChopInline(Close + 1);
+            Bracket = Rest.StartsWith(TEXT("[")) ? 0 : INDEX_NONE;
+            if (Bracket == INDEX_NONE && !Rest.IsEmpty())
+            {
+                OutErrorMessage = FString::Printf(TEXT("Unexpected '%s' after ']' in property path: %s"), *Rest, *Path);
+                return false;
+            }
+        }
+
+        if (Segment.Name.IsEmpty())
+        {
+            OutErrorMessage = FString::Printf(TEXT("Empty segment in property path: %s"), *Path);
+            return false;
+        }
+        if (Segment.bSubobject && Segment.Keys.Num() > 0)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Subobject:%s cannot be indexed"), *Segment.Name);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Blueprint-added components live on the generated class's construction script, not on the CDO
+UObject* FindComponentTemplate(UObject* Object, FName VariableName)
+{
+    if (!Object->HasAnyFlags(RF_ClassDefaultObject))
+    {
+        return nullptr;
+    }
+
+    UBlueprintGeneratedClass* OwnerClass = Cast<UBlueprintGeneratedClass>(Object->GetClass());
+    for (UBlueprintGeneratedClass* Class = OwnerClass; Class; Class = Cast<UBlueprintGeneratedClass>(Class->GetSuperClass()))
+    {
+        USCS_Node* Node = Class->SimpleConstructionScript ? Class->SimpleConstructionScript->FindSCSNode(VariableName) : nullptr;
+        if (!Node)
+        {
+            continue;
+        }
+        // A child blueprint that overrides an inherited component keeps its own template
+        if (Class != OwnerClass && OwnerClass->InheritableComponentHandler)
+        {
+            if (UActorComponent* Override = OwnerClass->InheritableComponentHandler->GetOverridenComponentTemplate(FComponentKey(Node)))
+            {
+                return Override;
+            }
+        }
+        return Node->ComponentTemplate;
+    }
+    return nullptr;
+}
+
+UObject* FindSubobject(UObject* Object, const FString& Name)
+{
+    const FName SubobjectName(*Name);
+    if (UObject* Found = Object->GetDefaultSubobjectByName(SubobjectName))
+    {
+        return Found;
+    }
+    if (UObject* Found = StaticFindObjectFast(UObject::StaticClass(), Object, SubobjectName))
+    {
+        return Found;
+    }
+    return FindComponentTemplate(Object, SubobjectName);
+}
+}
+
+bool FMCPPropertyPlan::ApplyInContainer(void* Container, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage) const
+{
+    return Apply(Property->ContainerPtrToValuePtr<void>(Container), Value, OutErrorMessage);
+}
+
+bool FMCPPropertyPlan::Apply(void* ValuePtr, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage) const
+{
+    if (!Value.IsValid())
+    {
+        OutErrorMessage = FString::Printf(TEXT("Missing value for property %s"), *Property->GetName());
+        return false;
+    }
+
+    switch (Setter)
+    {
+    case EMCPPropertySetter::Bool:
+        static_cast<FBoolProperty*>(Property)->SetPropertyValue(ValuePtr, Value->AsBool());
+        return true;
+
+    case EMCPPropertySetter::Integer:
+    case EMCPPropertySetter::Float:
+    {
+        // Numeric strings ("42") are accepted as well
+        double Number = 0.0;
+        if (!Value->TryGetNumber(Number))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Numeric property %s requires a number value"), *Property->GetName());
+            return false;
+        }
+        if (Setter == EMCPPropertySetter::Integer)
+        {
+            NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(Number));
+        }
+        else
+        {
+            NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Number);
+        }
+        return true;
+    }
+
+    case EMCPPropertySetter::String:
+        static_cast<FStrProperty*>(Property)->SetPropertyValue(ValuePtr, Value->AsString());
+        return true;
+
+    case EMCPPropertySetter::Name:
+        static_cast<FNameProperty*>(Property)->SetPropertyValue(ValuePtr, FName(*Value->AsString()));
+        return true;
+
+    case EMCPPropertySetter::Text:
+        static_cast<FTextProperty*>(Property)->SetPropertyValue(ValuePtr, FText::FromString(Value->AsString()));
+        return true;
+
+    case EMCPPropertySetter::Enum:
+    {
+        if (Value->Type == EJson::Number)
+        {
+            NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(Value->AsNumber()));
+            return true;
+        }
+        if (Value->Type != EJson::String)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Enum property %s requires either a string name or integer value"), *Property->GetName());
+            return false;
+        }
+
+        FString EnumValueName = Value->AsString();
+        if (EnumValueName.IsNumeric())
+        {
+            NumericProperty->SetIntPropertyValue(ValuePtr, FCString::Atoi64(*EnumValueName));
+            return true;
+        }
+
+        // Qualified names ("EAutoReceiveInput::Player0") match on the enumerator, then on the full name
+        if (EnumValueName.Contains(TEXT("::")))
+        {
+            EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
+        }
+        const int64* EnumValue = EnumValues.Find(EnumValueName.ToLower());
+        if (!EnumValue)
+        {
+            EnumValue = EnumValues.Find(Value->AsString().ToLower());
+        }
+        if (EnumValue)
+        {
+            NumericProperty->SetIntPropertyValue(ValuePtr, *EnumValue);
+            return true;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
+        for (int32 i = 0; i < Enum->NumEnums(); i++)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %lld)"), *Enum->GetNameStringByIndex(i), Enum->GetValueByIndex(i));
+        }
+        OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
+        return false;
+    }
+
+    case EMCPPropertySetter::LinearColor:
+    {
+        static const TCHAR* const Fields[] = { TEXT("R"), TEXT("G"), TEXT("B"), TEXT("A") };
+        double Components[4] = { 0.0, 0.0, 0.0, 1.0 };
+        const bool bHasAlpha = Value->Type == EJson::Object
+            ? Value->AsObject()->HasField(TEXT("A"))
+            : Value->Type == EJson::Array && Value->AsArray().Num() >= 4;
+        if (!ReadComponents(Value, Fields, bHasAlpha ? 4 : 3, Components))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Color property %s requires an {R, G, B, A} object or an array of 3-4 numbers"), *Property->GetName());
+            return false;
+        }
+        *static_cast<FLinearColor*>(ValuePtr) = FLinearColor(
+            static_cast<float>(Components[0]), static_cast<float>(Components[1]),
+            static_cast<float>(Components[2]), static_cast<float>(Components[3]));
+        return true;
+    }
+
+    case EMCPPropertySetter::Vector:
+    {
+        static const TCHAR* const Fields[] = { TEXT("X"), TEXT("Y"), TEXT("Z") };
+        double Components[3];
+        if (Value->Type == EJson::Number)
+        {
+            // A single number sets all three components
+            Components[0] = Components[1] = Components[2] = Value->AsNumber();
+        }
+        else if (!ReadComponents(Value, Fields, 3, Components))
+        {
+            OutErrorMessage = TEXT("Vector property requires either a single number or array of 3 numbers");
+            return false;
+        }
+        *static_cast<FVector*>(ValuePtr) = FVector(Components[0], Components[1], Components[2]);
+        return true;
+    }
+
+    case EMCPPropertySetter::Rotator:
+    {
+        static const TCHAR* const Fields[] = { TEXT("Pitch"), TEXT("Yaw"), TEXT("Roll") };
+        double Components[3];
+        if (!ReadComponents(Value, Fields, 3, Components))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Rotator property %s requires a {Pitch, Yaw, Roll} object or an array of 3 numbers"), *Property->GetName());
+            return false;
+        }
+        *static_cast<FRotator*>(ValuePtr) = FRotator(Components[0], Components[1], Components[2]);
+        return true;
+    }
+
+    default:
+        break;
+    }
+
+    // Same JSON shapes the property reads return
+    if (!FJsonObjectConverter::JsonValueToUProperty(Value, Property, ValuePtr, 0, 0))
+    {
+        OutErrorMessage = FString::Printf(TEXT("Could not convert value for property %s (%s)"),
+            *Property->GetName(), *Property->GetCPPType());
+        return false;
+    }
+    return true;
+}
+
+FUnrealMCPPropertyPlans& FUnrealMCPPropertyPlans::Get()
+{
+    static FUnrealMCPPropertyPlans Instance;
+    return Instance;
+}
+
+FUnrealMCPPropertyPlans::FUnrealMCPPropertyPlans()
+    : bInitialized(false)
+{
+}
+
+void FUnrealMCPPropertyPlans::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealMCPPropertyPlans::HandleModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason /*Reason*/) { Invalidate(); });
+    if (GEditor)
+    {
+        BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FUnrealMCPPropertyPlans::HandleBlueprintPreCompile);
+    }
+
+    bInitialized = true;
+}
+
+void FUnrealMCPPropertyPlans::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+    }
+
+    bInitialized = false;
+    Invalidate();
+}
+
+TSharedPtr<const FMCPPropertyPlan> FUnrealMCPPropertyPlans::FindPlan(const UStruct* Struct, FName PropertyName)
+{
+    if (!Struct || PropertyName.IsNone())
+    {
+        return nullptr;
+    }
+
+    const TPair<const UStruct*, FName> Key(Struct, PropertyName);
+    if (const TSharedPtr<const FMCPPropertyPlan>* Existing = Plans.Find(Key))
+    {
+        // A collected class whose address was reused fails the weak check and is rebuilt
+        if ((*Existing)->Owner.Get() == Struct)
+        {
+            return *Existing;
+        }
+        Plans.Remove(Key);
+    }
+
+    FProperty* Property = Struct->FindPropertyByName(PropertyName);
+    if (!Property)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FMCPPropertyPlan> Plan = MakeShared<FMCPPropertyPlan>();
+    BuildPlan(Struct, Property, *Plan);
+    Plans.Add(Key, Plan);
+    return Plan;
+}
+
+TSharedPtr<const FMCPPropertyPlan> FUnrealMCPPropertyPlans::FindPlan(FProperty* Property)
+{
+    if (!Property)
+    {
+        return nullptr;
+    }
+
+    if (const TSharedPtr<const FMCPPropertyPlan>* Existing = ElementPlans.Find(Property))
+    {
+        if ((*Existing)->Owner.IsValid())
+        {
+            return *Existing;
+        }
+        ElementPlans.Remove(Property);
+    }
+
+    TSharedPtr<FMCPPropertyPlan> Plan = MakeShared<FMCPPropertyPlan>();
+    BuildPlan(Property->GetOwnerStruct(), Property, *Plan);
+    ElementPlans.Add(Property, Plan);
+    return Plan;
+}
+
+bool FUnrealMCPPropertyPlans::ResolvePath(UObject* Root, const FString& Path, bool bForWrite, FMCPPropertyPathTarget& OutTarget, FString& OutErrorMessage)
+{
+    if (!Root)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    TArray<FPathSegment> Segments;
+    if (!ParsePath(Path, Segments, OutErrorMessage))
+    {
+        return false;
+    }
+
+    UObject* Object = Root;
+    const UStruct* Struct = Root->GetClass();
+    void* Container = Root;
+    TSharedPtr<const FMCPPropertyPlan> Plan;
+    FProperty* Property = nullptr;
+    void* ValuePtr = nullptr;
+
+    // Moves the walk into another object; writes stay inside Root's package
+    auto EnterObject = [&](UObject* Next, const FString& SegmentName) -> bool
+    {
+        if (bForWrite && Next->GetOutermost() != Root->GetOutermost())
+        {
+            OutErrorMessage = FString::Printf(TEXT("'%s' refers to %s in another package; edit that asset directly"),
+                *SegmentName, *Next->GetPathName());
+            return false;
+        }
+        Object = Next;
+        Struct = Next->GetClass();
+        Container = Next;
+        return true;
+    };
+
+    for (const FPathSegment& Segment : Segments)
+    {
+        // Step into the value the previous segment ended on
+        if (Property)
+        {
+            if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+            {
+                Struct = StructProp->Struct;
+                Container = ValuePtr;
+            }
+            else if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Property))
+            {
+                UObject* Next = ObjectProp->GetObjectPropertyValue(ValuePtr);
+                if (!Next && Container == Object)
+                {
+                    Next = FindComponentTemplate(Object, Property->GetFName());
+                }
+                if (!Next)
+                {
+                    OutErrorMessage = FString::Printf(TEXT("'%s' is None"), *Property->GetName());
+                    return false;
+                }
+                if (!EnterObject(Next, Property->GetName()))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                OutErrorMessage = FString::Printf(TEXT("'%s' (%s) has no member '%s'"),
+                    *Property->GetName(), *Property->GetCPPType(), *Segment.Name);
+                return false;
+            }
+            Property = nullptr;
+            Plan.Reset();
+        }
+
+        if (Segment.bSubobject)
+        {
+            if (Container != Object)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Subobject:%s must follow an object, not a struct"), *Segment.Name);
+                return false;
+            }
+            UObject* Subobject = FindSubobject(Object, Segment.Name);
+            if (!Subobject)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Subobject not found on '%s': %s"), *Object->GetName(), *Segment.Name);
+                return false;
+            }
+            if (!EnterObject(Subobject, Segment.Name))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        Plan = FindPlan(Struct, FName(*Segment.Name));
+        if (!Plan.IsValid())
+        {
+            OutErrorMessage = FString::Printf(TEXT("Property not found on '%s': %s"), *Struct->GetName(), *Segment.Name);
+            return false;
+        }
+        Property = Plan->Property;
+        ValuePtr = Property->ContainerPtrToValuePtr<void>(Container);
+
+        for (const FString& Key : Segment.Keys)
+        {
+            if (Property->ArrayDim > 1)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Indexing fixed-size array '%s' is not supported"), *Property->GetName());
+                return false;
+            }
+
+            if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+            {
+                FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+                const int32 Index = Key.IsNumeric() ? FCString::Atoi(*Key) : INDEX_NONE;
+                if (!Helper.IsValidIndex(Index))
+                {
+                    OutErrorMessage = FString::Printf(TEXT("Index [%s] out of range for '%s' (%d elements)"),
+                        *Key, *Property->GetName(), Helper.Num());
+                    return false;
+                }
+                ValuePtr = Helper.GetRawPtr(Index);
+                Property = ArrayProp->Inner;
+            }
+            else if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+            {
+                // Keys are written as the key property's text form: "Health", "3", "(X=1,Y=2)"
+                FProperty* KeyProp = MapProp->KeyProp;
+                void* KeyBuffer = FMemory::Malloc(KeyProp->GetSize(), KeyProp->GetMinAlignment());
+                KeyProp->InitializeValue(KeyBuffer);
+                const bool bParsed = KeyProp->ImportText_Direct(*Key, KeyBuffer, nullptr, PPF_None) != nullptr;
+                FScriptMapHelper Helper(MapProp, ValuePtr);
+                uint8* MapValue = bParsed ? Helper.FindValueFromHash(KeyBuffer) : nullptr;
+                KeyProp->DestroyValue(KeyBuffer);
+                FMemory::Free(KeyBuffer);
+
+                if (!MapValue)
+                {
+                    OutErrorMessage = bParsed
+                        ? FString::Printf(TEXT("Key [%s] not found in '%s'"), *Key, *Property->GetName())
+                        : FString::Printf(TEXT("Could not parse [%s] as a %s key of '%s'"), *Key, *KeyProp->GetCPPType(), *Property->GetName());
+                    return false;
+                }
+                ValuePtr = MapValue;
+                Property = MapProp->ValueProp;
+            }
+            else
+            {
+                OutErrorMessage = FString::Printf(TEXT("'%s' is not an array or map and cannot be indexed"), *Property->GetName());
+                return false;
+            }
+        }
+        if (Segment.Keys.Num() > 0)
+        {
+            Plan = FindPlan(Property);
+        }
+    }
+
+    OutTarget.Plan = Plan;
+    OutTarget.ValuePtr = Plan.IsValid() ? ValuePtr : nullptr;
+    OutTarget.Object = Object;
+    return true;
+}
+
+TSharedPtr<FJsonValue> FUnrealMCPPropertyPlans::ReadPath(UObject* Root, const FString& Path, int64 SkipFlags, FString& OutErrorMessage)
+{
+    FMCPPropertyPathTarget Target;
+    if (!ResolvePath(Root, Path, false, Target, OutErrorMessage))
+    {
+        return nullptr;
+    }
+
+    if (!Target.Plan.IsValid())
+    {
+        TSharedRef<FJsonObject> ObjectJson = MakeShared<FJsonObject>();
+        FJsonObjectConverter::UStructToJsonObject(Target.Object->GetClass(), Target.Object, ObjectJson, 0, SkipFlags);
+        return MakeShared<FJsonValueObject>(ObjectJson);
+    }
+
+    TSharedPtr<FJsonValue> Value = FJsonObjectConverter::UPropertyToJsonValue(Target.Plan->Property, Target.ValuePtr, 0, SkipFlags);
+    if (!Value.IsValid())
+    {
+        OutErrorMessage = FString::Printf(TEXT("Could not serialize '%s'"), *Path);
+    }
+    return Value;
+}
+
+bool FUnrealMCPPropertyPlans::IsPropertyPath(const FString& Name)
+{
+    int32 Index;
+    return Name.FindChar(TEXT('.'), Index) || Name.FindChar(TEXT('['), Index) || Name.FindChar(TEXT(':'), Index);
+}
+
+bool FUnrealMCPPropertyPlans::SetProperty(UObject* Object, const FString& PropertyName, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
+    if (!Object)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    if (IsPropertyPath(PropertyName))
+    {
+        FMCPPropertyPathTarget Target;
+        if (!ResolvePath(Object, PropertyName, true, Target, OutErrorMessage))
+        {
+            return false;
+        }
+        if (!Target.Plan.IsValid())
+        {
+            OutErrorMessage = FString::Printf(TEXT("Property path ends on an object, not a property: %s"), *PropertyName);
+            return false;
+        }
+        return Target.Plan->Apply(Target.ValuePtr, Value, OutErrorMessage);
+    }
+
+    TSharedPtr<const FMCPPropertyPlan> Plan = FindPlan(Object->GetClass(), FName(*PropertyName));
+    if (!Plan.IsValid())
+    {
+        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
+        return false;
+    }
+
+    return Plan->ApplyInContainer(Object, Value, OutErrorMessage);
+}
+
+int32 FUnrealMCPPropertyPlans::Num() const
+{
+    return Plans.Num() + ElementPlans.Num();
+}
+
+void FUnrealMCPPropertyPlans::Invalidate()
+{
+    Plans.Reset();
+    ElementPlans.Reset();
+}
+
+void FUnrealMCPPropertyPlans::BuildPlan(const UStruct* Owner, FProperty* Property, FMCPPropertyPlan& OutPlan)
+{
+    OutPlan.Owner = Owner;
+    OutPlan.Property = Property;
+
+    UEnum* Enum = nullptr;
+    if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+    {
+        Enum = EnumProp->GetEnum();
+        OutPlan.NumericProperty = EnumProp->GetUnderlyingProperty();
+    }
+    else if (const FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+    {
+        // TEnumAsByte<> properties carry their enum; plain bytes are ordinary integers
+        Enum = ByteProp->GetIntPropertyEnum();
+    }
+
+    if (Enum && OutPlan.NumericProperty == nullptr)
+    {
+        OutPlan.NumericProperty = CastField<FNumericProperty>(Property);
+    }
+
+    if (Enum && OutPlan.NumericProperty)
+    {
+        OutPlan.Setter = EMCPPropertySetter::Enum;
+        OutPlan.Enum = Enum;
+        for (int32 i = 0; i < Enum->NumEnums(); i++)
+        {
+            const int64 EnumValue = Enum->GetValueByIndex(i);
+            OutPlan.EnumValues.Add(Enum->GetNameStringByIndex(i).ToLower(), EnumValue);
+            OutPlan.EnumValues.Add(Enum->GetNameByIndex(i).ToString().ToLower(), EnumValue);
+        }
+    }
+    else if (CastField<FBoolProperty>(Property))
+    {
+        OutPlan.Setter = EMCPPropertySetter::Bool;
+    }
+    else if (FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+    {
+        OutPlan.NumericProperty = NumericProp;
+        OutPlan.Setter = NumericProp->IsFloatingPoint() ? EMCPPropertySetter::Float : EMCPPropertySetter::Integer;
+    }
+    else if (CastField<FStrProperty>(Property))
+    {
+        OutPlan.Setter = EMCPPropertySetter::String;
+    }
+    else if (CastField<FNameProperty>(Property))
+    {
+        OutPlan.Setter = EMCPPropertySetter::Name;
+    }
+    else if (CastField<FTextProperty>(Property))
+    {
+        OutPlan.Setter = EMCPPropertySetter::Text;
+    }
+    else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+    {
+        if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
+        {
+            OutPlan.Setter = EMCPPropertySetter::LinearColor;
+        }
+        else if (StructProp->Struct == TBaseStructure<FVector>::Get())
+        {
+            OutPlan.Setter = EMCPPropertySetter::Vector;
+        }
+        else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
+        {
+            OutPlan.Setter = EMCPPropertySetter::Rotator;
+        }
+    }
+}
+
+void FUnrealMCPPropertyPlans::InvalidateBlueprintClasses()
+{
+    for (auto It = Plans.CreateIterator(); It; ++It)
+    {
+        const UStruct* Owner = It.Value()->Owner.Get();
+        if (!Owner || !IsCompiledIn(Owner))
+        {
+            It.RemoveCurrent();
+        }
+    }
+    for (auto It = ElementPlans.CreateIterator(); It; ++It)
+    {
+        const UStruct* Owner = It.Value()->Owner.Get();
+        if (!Owner || !IsCompiledIn(Owner))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FUnrealMCPPropertyPlans::HandleModulesChanged(FName /*ModuleName*/, EModuleChangeReason Reason)
+{
+    if (Reason == EModuleChangeReason::ModuleLoaded)
+    {
+        Invalidate();
+    }
+}
+
+void FUnrealMCPPropertyPlans::HandleBlueprintPreCompile(UBlueprint* /*Blueprint*/)
+{
+    // The compiler regenerates the class's properties in place and child blueprint classes inherit
+    // them, so every plan outside compiled-in types may now point at freed properties
+    InvalidateBlueprintClasses();
+}
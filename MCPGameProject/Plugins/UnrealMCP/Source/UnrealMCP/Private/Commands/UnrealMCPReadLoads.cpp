@@ -0,0 +1,342 @@
+#include "Commands/UnrealMCPReadLoads.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+namespace
+{
+const int32 DefaultMaxPackages = 256;
+const int64 DefaultMaxBytes = 512ll * 1024 * 1024;
+const int32 StatsTopPackages = 10;
+}
+
+FUnrealMCPReadLoads& FUnrealMCPReadLoads::Get()
+{
+    static FUnrealMCPReadLoads ReadLoads;
+    return ReadLoads;
+}
+
+FUnrealMCPReadLoads::FUnrealMCPReadLoads()
+    : TrackedBytes(0)
+    , ReleasedBytes(0)
+    , ReleasedCount(0)
+    , DroppedCount(0)
+    , GCRequests(0)
+    , ScopeDepth(0)
+    , MaxPackages(DefaultMaxPackages)
+    , MaxBytes(DefaultMaxBytes)
+    , bEnabled(true)
+    , bInitialized(false)
+{
+}
+
+void FUnrealMCPReadLoads::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    // -MCPReadLoadMaxPackages=<n> / -MCPReadLoadBudgetMB=<mb> override the defaults (0 releases after every read)
+    FParse::Value(FCommandLine::Get(), TEXT("MCPReadLoadMaxPackages="), MaxPackages);
+    int64 BudgetMB = 0;
+    if (FParse::Value(FCommandLine::Get(), TEXT("MCPReadLoadBudgetMB="), BudgetMB))
+    {
+        MaxBytes = FMath::Max<int64>(BudgetMB, 0) * 1024 * 1024;
+    }
+    MaxPackages = FMath::Max(MaxPackages, 0);
+    bInitialized = true;
+}
+
+void FUnrealMCPReadLoads::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // Whatever is still tracked stays resident like any other editor-loaded package
+    Tracked.Reset();
+    ScopeLoads.Reset();
+    Released.Reset();
+    TrackedBytes = 0;
+    ScopeDepth = 0;
+    bInitialized = false;
+}
+
+void FUnrealMCPReadLoads::BeginReadScope()
+{
+    ++ScopeDepth;
+}
+
+void FUnrealMCPReadLoads::EndReadScope()
+{
+    if (ScopeDepth == 0 || --ScopeDepth > 0)
+    {
+        return;
+    }
+
+    // Only new loads can push the set over budget
+    if (bEnabled && ScopeLoads.Num() > 0)
+    {
+        TrackScopeLoads();
+        Enforce(false);
+    }
+    ScopeLoads.Reset();
+}
+
+bool FUnrealMCPReadLoads::IsResident(const FString& Path)
+{
+    const FString PackageName = FPackageName::ObjectPathToPackageName(Path);
+    return !PackageName.IsEmpty() && FindPackage(nullptr, *PackageName) != nullptr;
+}
+
+void FUnrealMCPReadLoads::TrackRead(const UObject* Object, bool bWasResident)
+{
+    if (!Object)
+    {
+        return;
+    }
+
+    // A package that was already resident belongs to whoever loaded it first
+    if (!bWasResident && ScopeDepth > 0 && bEnabled)
+    {
+        ScopeLoads.AddUnique(Object->GetPackage());
+    }
+    Touch(Object);
+}
+
+void FUnrealMCPReadLoads::TrackLateRead(const UObject* Object)
+{
+    if (!Object || !bEnabled || !bInitialized)
+    {
+        return;
+    }
+
+    ScopeLoads.AddUnique(Object->GetPackage());
+    if (ScopeDepth == 0)
+    {
+        TrackScopeLoads();
+        Enforce(false);
+        ScopeLoads.Reset();
+    }
+}
+
+void FUnrealMCPReadLoads::Touch(const UObject* Object)
+{
+    if (!Object || Tracked.Num() == 0)
+    {
+        return;
+    }
+
+    if (FTrackedPackage* Entry = Tracked.Find(Object->GetPackage()->GetFName()))
+    {
+        Entry->LastReadSeconds = FPlatformTime::Seconds();
+    }
+}
+
+void FUnrealMCPReadLoads::SetPolicy(int32 InMaxPackages, int64 InMaxBytes, bool bInEnabled)
+{
+    if (InMaxPackages >= 0)
+    {
+        MaxPackages = InMaxPackages;
+    }
+    if (InMaxBytes >= 0)
+    {
+        MaxBytes = InMaxBytes;
+    }
+
+    bEnabled = bInEnabled;
+    if (!bEnabled)
+    {
+        // Forgotten, not released: they stay resident like any other editor-loaded package
+        Tracked.Reset();
+        TrackedBytes = 0;
+        return;
+    }
+    Enforce(false);
+}
+
+void FUnrealMCPReadLoads::ReleaseAll()
+{
+    Enforce(true);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPReadLoads::GetStats() const
+{
+    TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+    Stats->SetBoolField(TEXT("enabled"), bEnabled);
+    Stats->SetNumberField(TEXT("max_packages"), MaxPackages);
+    Stats->SetNumberField(TEXT("max_mb"), static_cast<double>(MaxBytes) / (1024.0 * 1024.0));
+
+    int32 ResidentCount = 0;
+    int64 ResidentBytes = 0;
+    TArray<TPair<int64, FName>> BySize;
+    for (const TPair<FName, FTrackedPackage>& Pair : Tracked)
+    {
+        if (Pair.Value.Package.IsValid())
+        {
+            ++ResidentCount;
+            ResidentBytes += Pair.Value.Bytes;
+            BySize.Emplace(Pair.Value.Bytes, Pair.Key);
+        }
+    }
+    Stats->SetNumberField(TEXT("resident_count"), ResidentCount);
+    Stats->SetNumberField(TEXT("resident_bytes"), static_cast<double>(ResidentBytes));
+
+    int32 ReleasedResident = 0;
+    for (const TWeakObjectPtr<UPackage>& Package : Released)
+    {
+        ReleasedResident += Package.IsValid() ? 1 : 0;
+    }
+    Stats->SetNumberField(TEXT("released_count"), ReleasedCount);
+    Stats->SetNumberField(TEXT("released_bytes"), static_cast<double>(ReleasedBytes));
+    Stats->SetNumberField(TEXT("released_awaiting_gc"), ReleasedResident);
+    Stats->SetNumberField(TEXT("dropped_count"), DroppedCount);
+    Stats->SetNumberField(TEXT("gc_requests"), GCRequests);
+
+    BySize.Sort([](const TPair<int64, FName>& A, const TPair<int64, FName>& B) { return A.Key > B.Key; });
+    const double NowSeconds = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonValue>> Largest;
+    for (int32 Index = 0; Index < FMath::Min(BySize.Num(), StatsTopPackages); ++Index)
+    {
+        const FTrackedPackage& Entry = Tracked.FindChecked(BySize[Index].Value);
+        TSharedPtr<FJsonObject> PackageObj = MakeShared<FJsonObject>();
+        PackageObj->SetStringField(TEXT("package"), BySize[Index].Value.ToString());
+        PackageObj->SetNumberField(TEXT("bytes"), static_cast<double>(Entry.Bytes));
+        PackageObj->SetNumberField(TEXT("idle_seconds"), NowSeconds - Entry.LastReadSeconds);
+        Largest.Add(MakeShared<FJsonValueObject>(PackageObj));
+    }
+    Stats->SetArrayField(TEXT("largest"), Largest);
+    return Stats;
+}
+
+void FUnrealMCPReadLoads::TrackScopeLoads()
+{
+    const double NowSeconds = FPlatformTime::Seconds();
+    for (const TWeakObjectPtr<UPackage>& Weak : ScopeLoads)
+    {
+        UPackage* Package = Weak.Get();
+        if (!IsTrackable(Package) || Tracked.Contains(Package->GetFName()))
+        {
+            continue;
+        }
+
+        FTrackedPackage& Entry = Tracked.Add(Package->GetFName());
+        Entry.Package = Package;
+        Entry.Bytes = MeasurePackage(Package);
+        Entry.LastReadSeconds = NowSeconds;
+        TrackedBytes += Entry.Bytes;
+    }
+}
+
+void FUnrealMCPReadLoads::Enforce(bool bReleaseAll)
+{
+    Released.RemoveAllSwap([](const TWeakObjectPtr<UPackage>& Package) { return !Package.IsValid(); });
+
+    // Collected by someone else's GC, or adopted by the user (edited, opened): no longer ours to release
+    for (auto It = Tracked.CreateIterator(); It; ++It)
+    {
+        UPackage* Package = It->Value.Package.Get();
+        if (!Package || !IsStillOurs(Package))
+        {
+            DroppedCount += Package ? 1 : 0;
+            TrackedBytes -= It->Value.Bytes;
+            It.RemoveCurrent();
+        }
+    }
+
+    auto OverBudget = [this]() { return Tracked.Num() > MaxPackages || TrackedBytes > MaxBytes; };
+    if (Tracked.Num() == 0 || (!bReleaseAll && !OverBudget()))
+    {
+        return;
+    }
+
+    TArray<FName> Order;
+    Tracked.GenerateKeyArray(Order);
+    Order.Sort([this](const FName& A, const FName& B) { return Tracked[A].LastReadSeconds < Tracked[B].LastReadSeconds; });
+
+    int32 NumReleased = 0;
+    for (const FName& Name : Order)
+    {
+        if (!bReleaseAll && !OverBudget())
+        {
+            break;
+        }
+
+        FTrackedPackage Entry = Tracked.FindAndRemoveChecked(Name);
+        TrackedBytes -= Entry.Bytes;
+        if (UPackage* Package = Entry.Package.Get())
+        {
+            ReleasePackage(Package);
+            Released.Add(Package);
+            ReleasedBytes += Entry.Bytes;
+            ++ReleasedCount;
+            ++NumReleased;
+        }
+    }
+
+    // Collected at the end of the next engine tick with an incremental purge, never inside a command
+    if (NumReleased > 0 && GEngine)
+    {
+        GEngine->ForceGarbageCollection(false);
+        ++GCRequests;
+    }
+}
+
+bool FUnrealMCPReadLoads::IsTrackable(const UPackage* Package)
+{
+    if (!IsValid(Package) || Package->HasAnyPackageFlags(PKG_CompiledIn) || Package->ContainsMap() || Package->IsDirty())
+    {
+        return false;
+    }
+
+    const FString Name = Package->GetName();
+    return !Name.StartsWith(TEXT("/Script/")) && !Name.StartsWith(TEXT("/Temp/")) && !Name.StartsWith(TEXT("/Engine/Transient"));
+}
+
+bool FUnrealMCPReadLoads::IsStillOurs(const UPackage* Package)
+{
+    if (Package->IsDirty() || Package->IsRooted())
+    {
+        return false;
+    }
+
+    UAssetEditorSubsystem* AssetEditors = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+    bool bStandalone = false;
+    bool bEdited = false;
+    ForEachObjectWithPackage(Package, [&](UObject* Object)
+    {
+        bStandalone |= Object->HasAnyFlags(RF_Standalone);
+        bEdited |= AssetEditors && Object->IsAsset() && AssetEditors->FindEditorForAsset(Object, false) != nullptr;
+        return !bEdited;
+    }, false);
+    return bStandalone && !bEdited;
+}
+
+int64 FUnrealMCPReadLoads::MeasurePackage(const UPackage* Package)
+{
+    int64 Bytes = 0;
+    ForEachObjectWithPackage(Package, [&Bytes](UObject* Object)
+    {
+        Bytes += Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+        return true;
+    });
+    return Bytes;
+}
+
+void FUnrealMCPReadLoads::ReleasePackage(UPackage* Package)
+{
+    ForEachObjectWithPackage(Package, [](UObject* Object)
+    {
+        Object->ClearFlags(RF_Standalone);
+        return true;
+    });
+}
@@ -0,0 +1,339 @@
+#include "Commands/UnrealMCPSpatialIndex.h"
+#include "Components/ActorComponent.h"
+#include "ConvexVolume.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Math/GenericOctree.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+// Once this share of the octree is queued for update, rebuilding from scratch is cheaper
+const double FullRebuildPendingRatio = 0.25;
+const double NearestInitialRadius = 1000.0;
+
+struct FMCPActorOctreeElement
+{
+    FObjectKey ActorKey;
+    TWeakObjectPtr<AActor> Actor;
+    FBoxCenterAndExtent Bounds;
+};
+
+struct FMCPActorOctreeSemantics
+{
+    enum { MaxElementsPerLeaf = 16 };
+    enum { MinInclusiveElementsPerNode = 7 };
+    enum { MaxNodeDepth = 12 };
+
+    typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+    typedef TOctree2<FMCPActorOctreeElement, FMCPActorOctreeSemantics> FOctree;
+
+    FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FMCPActorOctreeElement& Element)
+    {
+        return Element.Bounds;
+    }
+
+    FORCEINLINE static bool AreElementsEqual(const FMCPActorOctreeElement& A, const FMCPActorOctreeElement& B)
+    {
+        return A.ActorKey == B.ActorKey;
+    }
+
+    static void SetElementId(FOctree& OctreeOwner, const FMCPActorOctreeElement& Element, FOctreeElementId2 Id);
+};
+
+FBox ComputeActorBounds(const AActor* Actor)
+{
+    const FBox Box = Actor->GetComponentsBoundingBox(true);
+    if (Box.IsValid)
+    {
+        return Box;
+    }
+    // Actors without primitives (notes, empty actors, volumes without geometry) index as a point
+    const FVector Location = Actor->GetActorLocation();
+    return FBox(Location, Location);
+}
+}
+
+/** TOctree2 plus the actor -> element id map its semantics keep current. */
+class FMCPActorOctree : public FMCPActorOctreeSemantics::FOctree
+{
+public:
+    FMCPActorOctree()
+        : FMCPActorOctreeSemantics::FOctree(FVector::ZeroVector, HALF_WORLD_MAX)
+    {
+    }
+
+    TMap<FObjectKey, FOctreeElementId2> ElementIds;
+};
+
+void FMCPActorOctreeSemantics::SetElementId(FOctree& OctreeOwner, const FMCPActorOctreeElement& Element, FOctreeElementId2 Id)
+{
+    static_cast<FMCPActorOctree&>(OctreeOwner).ElementIds.Add(Element.ActorKey, Id);
+}
+
+FUnrealMCPSpatialIndex& FUnrealMCPSpatialIndex::Get()
+{
+    static FUnrealMCPSpatialIndex Index;
+    return Index;
+}
+
+FUnrealMCPSpatialIndex::FUnrealMCPSpatialIndex()
+    : bInitialized(false)
+{
+}
+
+FUnrealMCPSpatialIndex::~FUnrealMCPSpatialIndex()
+{
+}
+
+void FUnrealMCPSpatialIndex::Initialize()
+{
+    if (bInitialized || !GEngine)
+    {
+        return;
+    }
+
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FUnrealMCPSpatialIndex::HandleActorChanged);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FUnrealMCPSpatialIndex::HandleActorChanged);
+    ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FUnrealMCPSpatialIndex::HandleActorChanged);
+    ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FUnrealMCPSpatialIndex::Invalidate);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FUnrealMCPSpatialIndex::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FUnrealMCPSpatialIndex::Invalidate);
+    MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32 /*MapChangeFlags*/) { Invalidate(); });
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FUnrealMCPSpatialIndex::HandleLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FUnrealMCPSpatialIndex::HandleLevelChanged);
+
+    bInitialized = true;
+}
+
+void FUnrealMCPSpatialIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+        GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+    }
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    FEditorDelegates::MapChange.Remove(MapChangeHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+    bInitialized = false;
+    Invalidate();
+}
+
+void FUnrealMCPSpatialIndex::MarkActorDirty(AActor* Actor)
+{
+    if (Octree && Actor && Actor->GetWorld() == IndexedWorld.Get())
+    {
+        PendingActors.Add(FObjectKey(Actor));
+    }
+}
+
+void FUnrealMCPSpatialIndex::Invalidate()
+{
+    Octree.Reset();
+    PendingActors.Reset();
+}
+
+void FUnrealMCPSpatialIndex::EnsureUpToDate(UWorld* World)
+{
+    // Without the delegates nothing reports changes, so every query starts from scratch
+    const bool bTooManyPending = Octree && PendingActors.Num() > Octree->ElementIds.Num() * FullRebuildPendingRatio;
+    if (!bInitialized || !Octree || IndexedWorld.Get() != World || bTooManyPending)
+    {
+        Octree = MakeUnique<FMCPActorOctree>();
+        PendingActors.Reset();
+        IndexedWorld = World;
+        if (!World)
+        {
+            return;
+        }
+
+        const double StartSeconds = FPlatformTime::Seconds();
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            AddActor(*It);
+        }
+        UE_LOG(LogTemp, Verbose, TEXT("UnrealMCPSpatialIndex: Built octree of %d actors in %.2f ms"),
+            Octree->ElementIds.Num(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+        return;
+    }
+
+    for (const FObjectKey& ActorKey : PendingActors)
+    {
+        RemoveActor(ActorKey);
+        AActor* Actor = Cast<AActor>(ActorKey.ResolveObjectPtr());
+        if (IsValid(Actor) && Actor->GetWorld() == World)
+        {
+            AddActor(Actor);
+        }
+    }
+    PendingActors.Reset();
+}
+
+void FUnrealMCPSpatialIndex::AddActor(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    FMCPActorOctreeElement Element;
+    Element.ActorKey = FObjectKey(Actor);
+    Element.Actor = Actor;
+    Element.Bounds = FBoxCenterAndExtent(ComputeActorBounds(Actor));
+    Octree->AddElement(Element);
+}
+
+void FUnrealMCPSpatialIndex::RemoveActor(const FObjectKey& ActorKey)
+{
+    FOctreeElementId2 ElementId;
+    if (Octree->ElementIds.RemoveAndCopyValue(ActorKey, ElementId) && Octree->IsValidElementId(ElementId))
+    {
+        // Elements moved to fill the hole get their new id through SetElementId
+        Octree->RemoveElement(ElementId);
+    }
+}
+
+void FUnrealMCPSpatialIndex::QueryBox(UWorld* World, const FBox& Box, FVisitFunc Visit)
+{
+    EnsureUpToDate(World);
+    if (!World)
+    {
+        return;
+    }
+
+    Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Box), [&Visit](const FMCPActorOctreeElement& Element)
+    {
+        if (AActor* Actor = Element.Actor.Get())
+        {
+            Visit(Actor, Element.Bounds.GetBox());
+        }
+    });
+}
+
+void FUnrealMCPSpatialIndex::QuerySphere(UWorld* World, const FVector& Center, double Radius, FVisitFunc Visit)
+{
+    const double RadiusSquared = Radius * Radius;
+    QueryBox(World, FBox(Center - FVector(Radius), Center + FVector(Radius)), [&](AActor* Actor, const FBox& Bounds)
+    {
+        if (FMath::SphereAABBIntersection(Center, RadiusSquared, Bounds))
+        {
+            Visit(Actor, Bounds);
+        }
+    });
+}
+
+void FUnrealMCPSpatialIndex::QueryConvex(UWorld* World, const FConvexVolume& Volume, const FBox& BroadPhase, FVisitFunc Visit)
+{
+    QueryBox(World, BroadPhase, [&](AActor* Actor, const FBox& Bounds)
+    {
+        if (Volume.IntersectBox(Bounds.GetCenter(), Bounds.GetExtent()))
+        {
+            Visit(Actor, Bounds);
+        }
+    });
+}
+
+void FUnrealMCPSpatialIndex::QueryNearest(UWorld* World, const FVector& Point, int32 Count, double MaxDistance,
+    TFunctionRef<bool(AActor*)> Filter, TArray<TPair<AActor*, double>>& OutActors)
+{
+    OutActors.Reset();
+    EnsureUpToDate(World);
+    if (!World || Count <= 0)
+    {
+        return;
+    }
+
+    // Grow a box around Point until it holds Count candidates whose distance is within the box's
+    // half-size: anything farther than that cannot beat them, and anything closer must intersect the box.
+    const double SearchLimit = MaxDistance > 0.0 ? MaxDistance : HALF_WORLD_MAX * 2.0;
+    double Radius = FMath::Min(NearestInitialRadius, SearchLimit);
+    TArray<TPair<AActor*, double>> Candidates;
+    while (true)
+    {
+        Candidates.Reset();
+        const FBox SearchBox(Point - FVector(Radius), Point + FVector(Radius));
+        Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(SearchBox), [&](const FMCPActorOctreeElement& Element)
+        {
+            AActor* Actor = Element.Actor.Get();
+            if (!Actor || !Filter(Actor))
+            {
+                return;
+            }
+            const double Distance = FMath::Sqrt(Element.Bounds.GetBox().ComputeSquaredDistanceToPoint(Point));
+            if (Distance <= Radius)
+            {
+                Candidates.Emplace(Actor, Distance);
+            }
+        });
+
+        if (Candidates.Num() >= Count || Radius >= SearchLimit)
+        {
+            break;
+        }
+        Radius = FMath::Min(Radius * 2.0, SearchLimit);
+    }
+
+    Candidates.Sort([](const TPair<AActor*, double>& A, const TPair<AActor*, double>& B)
+    {
+        return A.Value < B.Value;
+    });
+    for (const TPair<AActor*, double>& Candidate : Candidates)
+    {
+        if (OutActors.Num() >= Count || (MaxDistance > 0.0 && Candidate.Value > MaxDistance))
+        {
+            break;
+        }
+        OutActors.Add(Candidate);
+    }
+}
+
+int32 FUnrealMCPSpatialIndex::Num(UWorld* World)
+{
+    EnsureUpToDate(World);
+    return Octree ? Octree->ElementIds.Num() : 0;
+}
+
+void FUnrealMCPSpatialIndex::HandleActorChanged(AActor* Actor)
+{
+    MarkActorDirty(Actor);
+}
+
+void FUnrealMCPSpatialIndex::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& /*Event*/)
+{
+    if (!Octree)
+    {
+        return;
+    }
+
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        MarkActorDirty(Actor);
+    }
+    else if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+    {
+        MarkActorDirty(Component->GetOwner());
+    }
+}
+
+void FUnrealMCPSpatialIndex::HandleLevelChanged(ULevel* /*Level*/, UWorld* World)
+{
+    if (World == IndexedWorld.Get())
+    {
+        Invalidate();
+    }
+}
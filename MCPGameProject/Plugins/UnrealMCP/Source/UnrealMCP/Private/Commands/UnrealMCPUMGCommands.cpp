@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPUMGCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPPropertyPlans.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -767,6 +768,14 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCommand(const FString& Comm
 	{
 		return HandleSetWidgetCommonPropertiesBatch(Params);
 	}
+	else if (CommandName == TEXT("get_widget_property"))
+	{
+		return HandleGetWidgetProperty(Params);
+	}
+	else if (CommandName == TEXT("set_widget_property"))
+	{
+		return HandleSetWidgetProperty(Params);
+	}
 	else if (CommandName == TEXT("set_text_block_properties"))
 	{
 		return HandleSetTextBlockProperties(Params);
@@ -1593,6 +1602,132 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetWidgetCommonPropertiesBa
 	return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleGetWidgetProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+		{TEXT("blueprint_name"), TEXT("widget_name"), TEXT("property_path")}))
+	{
+		return Err;
+	}
+
+	FString BlueprintName;
+	FString WidgetName;
+	FString PropertyPath;
+	if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) ||
+		!Params->TryGetStringField(TEXT("widget_name"), WidgetName) ||
+		!Params->TryGetStringField(TEXT("property_path"), PropertyPath))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name', 'widget_name' or 'property_path' parameter"));
+	}
+
+	UWidgetBlueprint* WidgetBlueprint = ResolveWidgetBlueprint(BlueprintName);
+	if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(
+			FString::Printf(TEXT("Widget Blueprint not found or invalid: %s"), *BlueprintName));
+	}
+
+	UWidget* Widget = WidgetBlueprint->WidgetTree->FindWidget(*WidgetName);
+	if (!Widget)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(
+			FString::Printf(TEXT("Widget not found: %s"), *WidgetName));
+	}
+
+	FString PathError;
+	TSharedPtr<FJsonValue> Value = FUnrealMCPPropertyPlans::Get().ReadPath(Widget, PropertyPath, CPF_Transient, PathError);
+	if (!Value.IsValid())
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(PathError);
+	}
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
+	ResultObj->SetStringField(TEXT("widget_name"), Widget->GetName());
+	ResultObj->SetStringField(TEXT("widget_class"), Widget->GetClass()->GetName());
+	ResultObj->SetStringField(TEXT("property_path"), PropertyPath);
+	ResultObj->SetField(TEXT("value"), Value);
+	return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetWidgetProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+		{TEXT("blueprint_name"), TEXT("widget_name"), TEXT("property_path"), TEXT("property_value")}))
+	{
+		return Err;
+	}
+
+	FString BlueprintName;
+	FString WidgetName;
+	FString PropertyPath;
+	if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) ||
+		!Params->TryGetStringField(TEXT("widget_name"), WidgetName) ||
+		!Params->TryGetStringField(TEXT("property_path"), PropertyPath))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name', 'widget_name' or 'property_path' parameter"));
+	}
+
+	TSharedPtr<FJsonValue> PropertyValue = Params->Values.FindRef(TEXT("property_value"));
+	if (!PropertyValue.IsValid())
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_value' parameter"));
+	}
+
+	UWidgetBlueprint* WidgetBlueprint = ResolveWidgetBlueprint(BlueprintName);
+	if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(
+			FString::Printf(TEXT("Widget Blueprint not found or invalid: %s"), *BlueprintName));
+	}
+
+	UWidget* Widget = WidgetBlueprint->WidgetTree->FindWidget(*WidgetName);
+	if (!Widget)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(
+			FString::Printf(TEXT("Widget not found: %s"), *WidgetName));
+	}
+
+	// Paths may continue into the widget's slot ("Slot.LayoutData.Offsets"); both live in the widget tree
+	FUnrealMCPPropertyPlans& PropertyPlans = FUnrealMCPPropertyPlans::Get();
+	FMCPPropertyPathTarget Target;
+	FString PathError;
+	if (!PropertyPlans.ResolvePath(Widget, PropertyPath, true, Target, PathError))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(PathError);
+	}
+	if (!Target.Plan.IsValid())
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(
+			FString::Printf(TEXT("Property path ends on an object, not a property: %s"), *PropertyPath));
+	}
+
+	Target.Object->Modify();
+	if (!Target.Plan->Apply(Target.ValuePtr, PropertyValue, PathError))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(PathError);
+	}
+	Target.Object->PostEditChange();
+
+	// Read back before the compile, which may rebuild the tree's objects
+	TSharedPtr<FJsonValue> Readback = FJsonObjectConverter::UPropertyToJsonValue(Target.Plan->Property, Target.ValuePtr, 0, 0);
+	const FString ResolvedWidgetName = Widget->GetName();
+
+	MarkCompileAndSaveWidgetBlueprint(WidgetBlueprint);
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
+	ResultObj->SetStringField(TEXT("widget_name"), ResolvedWidgetName);
+	ResultObj->SetStringField(TEXT("property_path"), PropertyPath);
+	if (Readback.IsValid())
+	{
+		ResultObj->SetField(TEXT("value"), Readback);
+	}
+	return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockProperties(const TSharedPtr<FJsonObject>& Params)
 {
 	FString BlueprintName;
@@ -2454,6 +2589,17 @@ TArray<FMCPCommandMeta> FUnrealMCPUMGCommands::GetCommandMetadata()
 			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Widget Blueprint name/path")},
 			{TEXT("items"), TEXT("array"), true, TEXT("Array of {widget_name, visibility?, is_enabled?}")}
 		}},
+		{TEXT("get_widget_property"), TEXT("umg"), TEXT("Read one property path from a widget"), {
+			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Widget Blueprint name/path")},
+			{TEXT("widget_name"), TEXT("string"), true, TEXT("Widget name")},
+			{TEXT("property_path"), TEXT("string"), true, TEXT("Property path (e.g. ColorAndOpacity, Slot.LayoutData.Offsets)")}
+		}},
+		{TEXT("set_widget_property"), TEXT("umg"), TEXT("Set one property path on a widget, then compile and save"), {
+			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Widget Blueprint name/path")},
+			{TEXT("widget_name"), TEXT("string"), true, TEXT("Widget name")},
+			{TEXT("property_path"), TEXT("string"), true, TEXT("Property path (e.g. RenderOpacity, Slot.Padding.Left)")},
+			{TEXT("property_value"), TEXT("any"), true, TEXT("Value in the shape get_widget_property returns")}
+		}},
 		{TEXT("set_text_block_properties"), TEXT("umg"), TEXT("Set text and color on a TextBlock"), {
 			{TEXT("blueprint_name"), TEXT("string"), true, TEXT("Widget Blueprint name/path")},
 			{TEXT("widget_name"), TEXT("string"), true, TEXT("TextBlock widget name")},
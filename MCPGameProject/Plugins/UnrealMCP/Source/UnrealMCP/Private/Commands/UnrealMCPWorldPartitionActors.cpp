@@ -0,0 +1,325 @@
+#include "Commands/UnrealMCPWorldPartitionActors.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/DataLayer/DataLayerInstance.h"
+#include "WorldPartition/DataLayer/DataLayerManager.h"
+
+namespace
+{
+TArray<TSharedPtr<FJsonValue>> VectorToJsonArray(const FVector& Vector)
+{
+    return {
+        MakeShared<FJsonValueNumber>(Vector.X),
+        MakeShared<FJsonValueNumber>(Vector.Y),
+        MakeShared<FJsonValueNumber>(Vector.Z),
+    };
+}
+}
+
+bool FMCPActorDescFilter::Matches(const FWorldPartitionActorDescInstance& Desc) const
+{
+    if (Class)
+    {
+        if (Class->HasAnyClassFlags(CLASS_Native))
+        {
+            const UClass* NativeClass = Desc.GetActorNativeClass();
+            if (!NativeClass || !NativeClass->IsChildOf(Class))
+            {
+                return false;
+            }
+        }
+        // Blueprint subclasses are only known by path until loaded; match the exact class
+        else if (Desc.GetBaseClass() != Class->GetClassPathName())
+        {
+            return false;
+        }
+    }
+
+    if (!NamePattern.IsEmpty() &&
+        !Desc.GetActorName().ToString().MatchesWildcard(NamePattern, ESearchCase::IgnoreCase) &&
+        !Desc.GetActorLabel().ToString().MatchesWildcard(NamePattern, ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+
+    if (Bounds.IsSet() && !Desc.GetEditorBounds().Intersect(Bounds.GetValue()))
+    {
+        return false;
+    }
+
+    if (DataLayerInstances.IsSet())
+    {
+        const TSet<FName>& Wanted = DataLayerInstances.GetValue();
+        if (!Desc.GetDataLayerInstanceNames().ToArray().ContainsByPredicate(
+            [&Wanted](const FName& InstanceName) { return Wanted.Contains(InstanceName); }))
+        {
+            return false;
+        }
+    }
+
+    if (bLoaded.IsSet() && Desc.IsLoaded() != bLoaded.GetValue())
+    {
+        return false;
+    }
+
+    return true;
+}
+
+FUnrealMCPWorldPartitionActors& FUnrealMCPWorldPartitionActors::Get()
+{
+    static FUnrealMCPWorldPartitionActors Instance;
+    return Instance;
+}
+
+FUnrealMCPWorldPartitionActors::FUnrealMCPWorldPartitionActors()
+    : bInitialized(false)
+{
+}
+
+FUnrealMCPWorldPartitionActors::~FUnrealMCPWorldPartitionActors()
+{
+    // References must not outlive the engine; Shutdown has normally run already
+    Pinned.Reset();
+}
+
+void FUnrealMCPWorldPartitionActors::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FUnrealMCPWorldPartitionActors::HandleWorldCleanup);
+    bInitialized = true;
+}
+
+void FUnrealMCPWorldPartitionActors::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    Pinned.Reset();
+    PinnedWorld.Reset();
+    bInitialized = false;
+}
+
+UWorldPartition* FUnrealMCPWorldPartitionActors::GetWorldPartition(UWorld* World)
+{
+    return World ? World->GetWorldPartition() : nullptr;
+}
+
+void FUnrealMCPWorldPartitionActors::ForEachActorDesc(UWorld* World, const FMCPActorDescFilter& Filter, TFunctionRef<bool(const FWorldPartitionActorDescInstance&)> Visit)
+{
+    UWorldPartition* WorldPartition = GetWorldPartition(World);
+    if (!WorldPartition)
+    {
+        return;
+    }
+
+    // Native class filters narrow the walk inside the partition's per-class descriptor lists
+    const TSubclassOf<AActor> WalkClass = (Filter.Class && Filter.Class->HasAnyClassFlags(CLASS_Native))
+        ? TSubclassOf<AActor>(Filter.Class)
+        : TSubclassOf<AActor>(AActor::StaticClass());
+
+    FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, WalkClass, [&Filter, &Visit](const FWorldPartitionActorDescInstance* Desc)
+    {
+        if (Desc && Filter.Matches(*Desc))
+        {
+            return Visit(*Desc);
+        }
+        return true;
+    });
+}
+
+bool FUnrealMCPWorldPartitionActors::ResolveDataLayer(UWorld* World, const FString& Name, TSet<FName>& OutInstanceNames)
+{
+    OutInstanceNames.Reset();
+    UDataLayerManager* DataLayerManager = UDataLayerManager::GetDataLayerManager(World);
+    if (!DataLayerManager)
+    {
+        return false;
+    }
+
+    DataLayerManager->ForEachDataLayerInstance([&Name, &OutInstanceNames](UDataLayerInstance* Instance)
+    {
+        if (Instance->GetDataLayerFName().ToString().Equals(Name, ESearchCase::IgnoreCase) ||
+            Instance->GetDataLayerShortName().Equals(Name, ESearchCase::IgnoreCase) ||
+            Instance->GetDataLayerFullName().Equals(Name, ESearchCase::IgnoreCase))
+        {
+            OutInstanceNames.Add(Instance->GetDataLayerFName());
+        }
+        return true;
+    });
+    return OutInstanceNames.Num() > 0;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPWorldPartitionActors::ActorDescToJson(const FWorldPartitionActorDescInstance& Desc)
+{
+    TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+    Obj->SetStringField(TEXT("guid"), Desc.GetGuid().ToString(EGuidFormats::DigitsWithHyphens));
+    Obj->SetStringField(TEXT("name"), Desc.GetActorName().ToString());
+    Obj->SetStringField(TEXT("label"), Desc.GetActorLabel().ToString());
+    Obj->SetStringField(TEXT("class"), Desc.GetBaseClass().IsValid()
+        ? Desc.GetBaseClass().GetAssetName().ToString()
+        : (Desc.GetActorNativeClass() ? Desc.GetActorNativeClass()->GetName() : FString()));
+    Obj->SetStringField(TEXT("package"), Desc.GetActorPackage().ToString());
+
+    const FBox Bounds = Desc.GetEditorBounds();
+    if (Bounds.IsValid)
+    {
+        TSharedPtr<FJsonObject> BoundsObj = MakeShared<FJsonObject>();
+        BoundsObj->SetArrayField(TEXT("min"), VectorToJsonArray(Bounds.Min));
+        BoundsObj->SetArrayField(TEXT("max"), VectorToJsonArray(Bounds.Max));
+        Obj->SetObjectField(TEXT("bounds"), BoundsObj);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> DataLayers;
+    for (const FName& InstanceName : Desc.GetDataLayerInstanceNames().ToArray())
+    {
+        DataLayers.Add(MakeShared<FJsonValueString>(InstanceName.ToString()));
+    }
+    Obj->SetArrayField(TEXT("data_layers"), DataLayers);
+
+    Obj->SetBoolField(TEXT("loaded"), Desc.IsLoaded());
+    Obj->SetBoolField(TEXT("spatially_loaded"), Desc.GetIsSpatiallyLoaded());
+    if (!Desc.GetRuntimeGrid().IsNone())
+    {
+        Obj->SetStringField(TEXT("runtime_grid"), Desc.GetRuntimeGrid().ToString());
+    }
+    return Obj;
+}
+
+AActor* FUnrealMCPWorldPartitionActors::LoadActor(UWorld* World, const FGuid& ActorGuid)
+{
+    UWorldPartition* WorldPartition = GetWorldPartition(World);
+    if (!WorldPartition || !ActorGuid.IsValid())
+    {
+        return nullptr;
+    }
+
+    if (PinnedWorld.Get() != World)
+    {
+        Pinned.Reset();
+        PinnedWorld = World;
+    }
+
+    if (const FWorldPartitionReference* Existing = Pinned.Find(ActorGuid))
+    {
+        if (Existing->IsLoaded())
+        {
+            return Existing->GetActor();
+        }
+    }
+
+    // The reference loads the actor's package (only this actor, not its cell) and keeps it loaded
+    FWorldPartitionReference Reference(WorldPartition, ActorGuid);
+    if (!Reference.IsValid() || !Reference.IsLoaded())
+    {
+        return nullptr;
+    }
+
+    AActor* Actor = Reference.GetActor();
+    Pinned.Add(ActorGuid, MoveTemp(Reference));
+    return Actor;
+}
+
+AActor* FUnrealMCPWorldPartitionActors::ResolveForEdit(UWorld* World, const FString& NameOrGuid, FString& OutError)
+{
+    if (!GetWorldPartition(World) || NameOrGuid.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    FGuid Guid;
+    if (!FGuid::Parse(NameOrGuid, Guid))
+    {
+        // Names of external actors live in separate packages, so a clash is possible; refuse to pick one
+        const FName ActorName(*NameOrGuid);
+        TArray<const FWorldPartitionActorDescInstance*> Matches;
+        ForEachActorDesc(World, FMCPActorDescFilter(), [&](const FWorldPartitionActorDescInstance& Desc)
+        {
+            if (Desc.GetActorName() == ActorName || Desc.GetActorPackage() == ActorName)
+            {
+                Matches.Add(&Desc);
+            }
+            return true;
+        });
+        if (Matches.Num() > 1)
+        {
+            OutError = AmbiguousMatchError(NameOrGuid, Matches);
+            return nullptr;
+        }
+        if (Matches.Num() == 1)
+        {
+            Guid = Matches[0]->GetGuid();
+        }
+    }
+    if (!Guid.IsValid())
+    {
+        return nullptr;
+    }
+
+    AActor* Actor = LoadActor(World, Guid);
+    if (Actor)
+    {
+        UE_LOG(LogTemp, Display, TEXT("UnrealMCP: Loaded World Partition actor %s for edit"), *Actor->GetName());
+    }
+    return Actor;
+}
+
+FString FUnrealMCPWorldPartitionActors::AmbiguousMatchError(const FString& Name, const TArray<const FWorldPartitionActorDescInstance*>& Candidates)
+{
+    TArray<FString> Described;
+    Described.Reserve(Candidates.Num());
+    for (const FWorldPartitionActorDescInstance* Desc : Candidates)
+    {
+        Described.Add(FString::Printf(TEXT("%s (%s)"),
+            *Desc->GetGuid().ToString(EGuidFormats::DigitsWithHyphens), *Desc->GetActorPackage().ToString()));
+    }
+    return FString::Printf(TEXT("Several unloaded actors match '%s': %s; pass the actor GUID or package path"),
+        *Name, *FString::Join(Described, TEXT(", ")));
+}
+
+void FUnrealMCPWorldPartitionActors::Release(const TArray<FGuid>& Guids, TArray<FGuid>& OutReleased, TArray<FGuid>& OutKeptDirty)
+{
+    TArray<FGuid> Candidates = Guids;
+    if (Candidates.Num() == 0)
+    {
+        Pinned.GetKeys(Candidates);
+    }
+
+    for (const FGuid& Guid : Candidates)
+    {
+        const FWorldPartitionReference* Reference = Pinned.Find(Guid);
+        if (!Reference)
+        {
+            continue;
+        }
+
+        const AActor* Actor = Reference->IsLoaded() ? Reference->GetActor() : nullptr;
+        if (Actor && Actor->GetPackage() && Actor->GetPackage()->IsDirty())
+        {
+            OutKeptDirty.Add(Guid);
+            continue;
+        }
+
+        Pinned.Remove(Guid);
+        OutReleased.Add(Guid);
+    }
+}
+
+void FUnrealMCPWorldPartitionActors::HandleWorldCleanup(UWorld* World, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
+{
+    if (World && World == PinnedWorld.Get())
+    {
+        Pinned.Reset();
+        PinnedWorld.Reset();
+    }
+}
@@ -14,11 +14,14 @@
 // Buffer size for receiving data per recv chunk (full messages may span multiple chunks).
 const int32 SocketReadBufferSize = 8192;
 const int32 MaxLoggedMessageChars = 1024;
+// A client that accepts no bytes for this long is treated as gone and its session is dropped.
+const double SendStallTimeoutSeconds = 10.0;
 
 FMCPServerRunnable::FMCPServerRunnable(UUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
     : Bridge(InBridge)
     , ListenerSocket(InListenerSocket)
     , bRunning(true)
+    , NextSessionId(1)
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Created server runnable"));
 }
@@ -37,147 +40,171 @@ uint32 FMCPServerRunnable::Run()
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread starting..."));
     
+    // All clients are polled from this thread, so a subscriber idling between requests never keeps
+    // another connection waiting. A command still blocks the loop while the game thread runs it.
     while (bRunning)
     {
-        // UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Waiting for client connection..."));
-        
-        bool bPending = false;
-        if (ListenerSocket->HasPendingConnection(bPending) && bPending)
-        {
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection pending, accepting..."));
-            
-            ClientSocket = MakeShareable(ListenerSocket->Accept(TEXT("MCPClient")));
-            if (ClientSocket.IsValid())
-            {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection accepted"));
-                
-                // Set socket options to improve connection stability
-                ClientSocket->SetNoDelay(true);
-                int32 SocketBufferSize = 65536;  // 64KB buffer
-                ClientSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
-                ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
-                
-                uint8 Buffer[SocketReadBufferSize + 1];
-                FString MessageBuffer;
-                while (bRunning)
-                {
-                    int32 BytesRead = 0;
-                    if (ClientSocket->Recv(Buffer, SocketReadBufferSize, BytesRead))
-                    {
-                        if (BytesRead == 0)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client disconnected (zero bytes)"));
-                            break;
-                        }
-
-                        // Convert received chunk to string and accumulate. Commands may exceed one recv chunk.
-                        Buffer[BytesRead] = '\0';
-                        const FString ReceivedChunk = UTF8_TO_TCHAR(reinterpret_cast<const char*>(Buffer));
-                        MessageBuffer += ReceivedChunk;
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received chunk (%d bytes), total buffered chars=%d"), BytesRead, MessageBuffer.Len());
+        bool bActivity = AcceptPendingClients();
 
-                        // Parse JSON only when a full message has been accumulated.
-                        TSharedPtr<FJsonObject> JsonObject;
-                        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(MessageBuffer);
-
-                        if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
-                        {
-                            if (MessageBuffer.Len() > MaxLoggedMessageChars)
-                            {
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received JSON (chars=%d): %s...<truncated>"),
-                                    MessageBuffer.Len(), *MessageBuffer.Left(MaxLoggedMessageChars));
-                            }
-                            else
-                            {
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *MessageBuffer);
-                            }
-                            // Get command type
-                            FString CommandType;
-                            if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
-                            {
-                                // Execute command
-                                FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")));
-                                
-                                // Log response for debugging
-                                if (Response.Len() > MaxLoggedMessageChars)
-                                {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response JSON (chars=%d): %s...<truncated>"),
-                                        Response.Len(), *Response.Left(MaxLoggedMessageChars));
-                                }
-                                else
-                                {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
-                                }
-                                
-                                // Send response
-                                int32 BytesSent = 0;
-                                if (!ClientSocket->Send((uint8*)TCHAR_TO_UTF8(*Response), Response.Len(), BytesSent))
-                                {
-                                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response"));
-                                }
-                                else {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully, bytes: %d"), BytesSent);
-                                }
-                                MessageBuffer.Reset();
-                            }
-                            else
-                            {
-                                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
-                                MessageBuffer.Reset();
-                            }
-                        }
-                        else
-                        {
-                            // Partial payloads are expected for large commands; continue receiving.
-                            UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: JSON not complete yet (buffer chars=%d)"), MessageBuffer.Len());
-                        }
-                    }
-                    else
-                    {
-                        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
-                        // Don't break the connection for WouldBlock error, which is normal for non-blocking sockets
-                        bool bShouldBreak = true;
-                        
-                        // Check for "would block" error which isn't a real error for non-blocking sockets
-                        if (LastError == SE_EWOULDBLOCK) 
-                        {
-                            UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Socket would block, continuing..."));
-                            bShouldBreak = false;
-                            // Small sleep to prevent tight loop when no data
-                            FPlatformProcess::Sleep(0.01f);
-                        }
-                        // Check for other transient errors we might want to tolerate
-                        else if (LastError == SE_EINTR) // Interrupted system call
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Socket read interrupted, continuing..."));
-                            bShouldBreak = false;
-                        }
-                        else 
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client disconnected or error. Last error code: %d"), LastError);
-                        }
-                        
-                        if (bShouldBreak)
-                        {
-                            break;
-                        }
-                    }
-                }
-            }
-            else
+        for (int32 Index = Clients.Num() - 1; Index >= 0; --Index)
+        {
+            bool bClientActivity = false;
+            if (!ServiceClient(Clients[Index], bClientActivity))
             {
-                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
+                CloseClient(Clients[Index]);
+                Clients.RemoveAtSwap(Index);
             }
+            bActivity |= bClientActivity;
+        }
+
+        if (!bActivity)
+        {
+            // Small sleep to prevent tight loop
+            FPlatformProcess::Sleep(0.01f);
         }
-        
-        // Small sleep to prevent tight loop
-        FPlatformProcess::Sleep(0.1f);
     }
+
+    for (FMCPClientConnection& Client : Clients)
+    {
+        CloseClient(Client);
+    }
+    Clients.Reset();
     
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread stopping"));
     return 0;
 }
 
+bool FMCPServerRunnable::AcceptPendingClients()
+{
+    bool bAccepted = false;
+    bool bPending = false;
+    while (ListenerSocket->HasPendingConnection(bPending) && bPending)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection pending, accepting..."));
+        
+        TSharedPtr<FSocket> Socket = MakeShareable(ListenerSocket->Accept(TEXT("MCPClient")));
+        if (!Socket.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
+            break;
+        }
+
+        // Set socket options to improve connection stability; non-blocking so one idle client cannot stall the poll
+        Socket->SetNonBlocking(true);
+        Socket->SetNoDelay(true);
+        int32 SocketBufferSize = 65536;  // 64KB buffer
+        Socket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
+        Socket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
+
+        FMCPClientConnection& Client = Clients.AddDefaulted_GetRef();
+        Client.Socket = Socket;
+        Client.SessionId = NextSessionId++;
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection accepted (session %d, %d open)"), Client.SessionId, Clients.Num());
+        bAccepted = true;
+    }
+    return bAccepted;
+}
+
+bool FMCPServerRunnable::ServiceClient(FMCPClientConnection& Client, bool& bOutActivity)
+{
+    // Between requests: the client is not waiting on a response, so frames cannot interleave with one
+    if (Client.MessageBuffer.IsEmpty() && !SendPendingNotifications(Client))
+    {
+        return false;
+    }
+
+    uint8 Buffer[SocketReadBufferSize + 1];
+    int32 BytesRead = 0;
+    if (!Client.Socket->Recv(Buffer, SocketReadBufferSize, BytesRead))
+    {
+        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+        // Check for "would block" error which isn't a real error for non-blocking sockets
+        if (LastError == SE_EWOULDBLOCK)
+        {
+            return true;
+        }
+        // Check for other transient errors we might want to tolerate
+        if (LastError == SE_EINTR) // Interrupted system call
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Socket read interrupted, continuing..."));
+            return true;
+        }
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client disconnected or error (session %d). Last error code: %d"), Client.SessionId, LastError);
+        return false;
+    }
+    if (BytesRead == 0)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client disconnected (session %d, zero bytes)"), Client.SessionId);
+        return false;
+    }
+    bOutActivity = true;
+
+    // Convert received chunk to string and accumulate. Commands may exceed one recv chunk.
+    Buffer[BytesRead] = '\0';
+    const FString ReceivedChunk = UTF8_TO_TCHAR(reinterpret_cast<const char*>(Buffer));
+    Client.MessageBuffer += ReceivedChunk;
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received chunk (%d bytes, session %d), total buffered chars=%d"), BytesRead, Client.SessionId, Client.MessageBuffer.Len());
+
+    // Parse JSON only when a full message has been accumulated.
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Client.MessageBuffer);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        // Partial payloads are expected for large commands; continue receiving.
+        UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: JSON not complete yet (buffer chars=%d)"), Client.MessageBuffer.Len());
+        return true;
+    }
+
+    if (Client.MessageBuffer.Len() > MaxLoggedMessageChars)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received JSON (chars=%d): %s...<truncated>"),
+            Client.MessageBuffer.Len(), *Client.MessageBuffer.Left(MaxLoggedMessageChars));
+    }
+    else
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *Client.MessageBuffer);
+    }
+    Client.MessageBuffer.Reset();
+
+    // Get command type
+    FString CommandType;
+    if (!JsonObject->TryGetStringField(TEXT("type"), CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
+        return true;
+    }
+
+    // Execute command
+    FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")), Client.SessionId);
+    
+    // Log response for debugging
+    if (Response.Len() > MaxLoggedMessageChars)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response JSON (chars=%d): %s...<truncated>"),
+            Response.Len(), *Response.Left(MaxLoggedMessageChars));
+    }
+    else
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
+    }
+    
+    // Send response
+    if (!SendString(*Client.Socket, Client.SessionId, Response))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response, dropping session %d"), Client.SessionId);
+        return false;
+    }
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully, chars: %d"), Response.Len());
+    return true;
+}
+
+void FMCPServerRunnable::CloseClient(FMCPClientConnection& Client)
+{
+    // Drops the session's subscriptions; a stalled client sees the connection close
+    Bridge->EndSession(Client.SessionId);
+    Client.Socket->Close();
+}
+
 void FMCPServerRunnable::Stop()
 {
     bRunning = false;
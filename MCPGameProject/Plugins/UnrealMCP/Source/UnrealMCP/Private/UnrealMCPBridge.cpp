@@ -60,11 +60,200 @@
 #include "Commands/UnrealMCPUMGCommands.h"
 #include "Commands/UnrealMCPBehaviorTreeCommands.h"
 #include "Commands/UnrealMCPAnimationCommands.h"
+#include "Commands/UnrealMCPBenchmarkCommands.h"
+#include "Commands/UnrealMCPActorIndex.h"
+#include "Commands/UnrealMCPSpatialIndex.h"
+#include "Commands/UnrealMCPLevelChangeFeed.h"
+#include "Commands/UnrealMCPWorldPartitionActors.h"
+#include "Commands/UnrealMCPAssetQuery.h"
+#include "Commands/UnrealMCPBlueprintIndex.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPPropertyPlans.h"
+#include "Commands/UnrealMCPFunctionPlans.h"
+#include "Commands/UnrealMCPReadLoads.h"
+#include "UnrealMCPTrafficRecorder.h"
+#include "UnrealMCPCommandStats.h"
+#include "UnrealMCPCommandWatchdog.h"
+#include "UnrealMCPEventSubscriptions.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
 #define MCP_SERVER_PORT 55557
 
+// Everything a handler allocates shows up under this tag in LLM reports (-llm).
+LLM_DEFINE_TAG(UnrealMCP);
+
+namespace
+{
+// Filled on the game thread before the promise is fulfilled; read on the server thread after.
+struct FMCPCommandExecutionInfo
+{
+    double ExecStartSeconds = 0.0;
+    double ExecEndSeconds = 0.0;
+    bool bSuccess = false;
+    bool bAllocTracked = false;
+    FMCPAllocSnapshot AllocStart;
+    FMCPAllocSnapshot AllocEnd;
+
+    void Begin(bool bTrackAllocations)
+    {
+        bAllocTracked = bTrackAllocations;
+        if (bAllocTracked)
+        {
+            AllocStart = FUnrealMCPCommandStats::CaptureAllocSnapshot();
+        }
+        ExecStartSeconds = FPlatformTime::Seconds();
+    }
+
+    void Finish(bool bInSuccess)
+    {
+        ExecEndSeconds = FPlatformTime::Seconds();
+        if (bAllocTracked)
+        {
+            AllocEnd = FUnrealMCPCommandStats::CaptureAllocSnapshot();
+        }
+        bSuccess = bInSuccess;
+    }
+};
+
+bool IsTrafficRecordingControlCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("start_traffic_recording") ||
+           CommandType == TEXT("stop_traffic_recording") ||
+           CommandType == TEXT("get_traffic_recording_status");
+}
+
+bool IsCommandStatsCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_mcp_stats") ||
+           CommandType == TEXT("reset_mcp_stats");
+}
+
+// Read-only commands that load the asset they read; FUnrealMCPReadLoads tracks the packages they request
+bool IsAssetReadCommand(const FString& CommandType)
+{
+    if (CommandType == TEXT("get_data_asset") ||
+        CommandType == TEXT("get_assets_bulk") ||
+        CommandType == TEXT("get_behavior_tree_info") ||
+        CommandType == TEXT("get_montage_info") ||
+        CommandType == TEXT("get_blueprint_info") ||
+        CommandType == TEXT("get_blueprint_defaults") ||
+        CommandType == TEXT("get_blueprint_graph_info") ||
+        CommandType == TEXT("find_blueprint_nodes") ||
+        CommandType == TEXT("get_widget_tree") ||
+        CommandType == TEXT("get_widget_property"))
+    {
+        return true;
+    }
+
+    const TSharedPtr<IUnrealMCPCommandHandler> ExtensionHandler = FUnrealMCPCommandRegistry::Get().FindHandlerForCommand(CommandType);
+    return ExtensionHandler.IsValid() && ExtensionHandler->IsAssetReadCommand(CommandType);
+}
+
+// Optional non-negative number field of set_read_load_policy; OutValue stays -1 ("unchanged") when absent
+bool TryGetReadLoadLimit(const TSharedPtr<FJsonObject>& Params, const TCHAR* Field, double& OutValue, FString& OutError)
+{
+    OutValue = -1.0;
+    const TSharedPtr<FJsonValue> Value = Params.IsValid() ? Params->TryGetField(Field) : nullptr;
+    if (!Value.IsValid())
+    {
+        return true;
+    }
+    if (Value->Type != EJson::Number || !FMath::IsFinite(Value->AsNumber()) || Value->AsNumber() < 0.0)
+    {
+        OutError = FString::Printf(TEXT("'%s' must be a non-negative number"), Field);
+        return false;
+    }
+    OutValue = Value->AsNumber();
+    return true;
+}
+
+// Optional bool field; OutValue is left as is when absent
+bool TryGetReadLoadFlag(const TSharedPtr<FJsonObject>& Params, const TCHAR* Field, bool& OutValue, FString& OutError)
+{
+    const TSharedPtr<FJsonValue> Value = Params.IsValid() ? Params->TryGetField(Field) : nullptr;
+    if (!Value.IsValid())
+    {
+        return true;
+    }
+    if (Value->Type != EJson::Boolean)
+    {
+        OutError = FString::Printf(TEXT("'%s' must be a bool"), Field);
+        return false;
+    }
+    OutValue = Value->AsBool();
+    return true;
+}
+
+// Bytes on the wire: the UTF-8 encoding, not the TCHAR count, so non-ASCII payloads are measured right
+int32 Utf8Length(const FString& Response)
+{
+    return FTCHARToUTF8(*Response).Length();
+}
+
+// Answered on the server thread so they keep working while the game thread is stuck
+bool IsWatchdogCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("get_mcp_watchdog_status") ||
+           CommandType == TEXT("set_mcp_watchdog");
+}
+
+// Answered on the server thread: they act on the calling session, not the editor
+bool IsSubscriptionCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("subscribe") ||
+           CommandType == TEXT("unsubscribe") ||
+           CommandType == TEXT("get_subscriptions");
+}
+
+// Topic names from Params' "topics" array (or "all"); Default when the field is absent
+bool ParseSubscriptionTopics(const TSharedPtr<FJsonObject>& Params, EMCPEventTopic Default, EMCPEventTopic& OutTopics, FString& OutError)
+{
+    const TArray<TSharedPtr<FJsonValue>>* TopicValues = nullptr;
+    if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("topics"), TopicValues))
+    {
+        FString SingleTopic;
+        if (Params.IsValid() && Params->TryGetStringField(TEXT("topics"), SingleTopic))
+        {
+            if (!FUnrealMCPEventSubscriptions::ParseTopic(SingleTopic, OutTopics))
+            {
+                OutError = FString::Printf(TEXT("Unknown topic '%s' (expected actors, assets, blueprints, dialogue or all)"), *SingleTopic);
+                return false;
+            }
+            return true;
+        }
+        OutTopics = Default;
+        return true;
+    }
+
+    OutTopics = EMCPEventTopic::None;
+    for (const TSharedPtr<FJsonValue>& Value : *TopicValues)
+    {
+        EMCPEventTopic Topic = EMCPEventTopic::None;
+        if (!Value.IsValid() || !FUnrealMCPEventSubscriptions::ParseTopic(Value->AsString(), Topic))
+        {
+            OutError = FString::Printf(TEXT("Unknown topic '%s' (expected actors, assets, blueprints, dialogue or all)"),
+                Value.IsValid() ? *Value->AsString() : TEXT(""));
+            return false;
+        }
+        OutTopics |= Topic;
+    }
+    return true;
+}
+
+FString SerializeResponse(const TSharedPtr<FJsonObject>& ResponseJson)
+{
+    FString ResultString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
+    FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+    return ResultString;
+}
+}
+
 UUnrealMCPBridge::UUnrealMCPBridge()
 {
     EditorCommands = MakeShared<FUnrealMCPEditorCommands>();
@@ -74,6 +263,11 @@ UUnrealMCPBridge::UUnrealMCPBridge()
     UMGCommands = MakeShared<FUnrealMCPUMGCommands>();
     BehaviorTreeCommands = MakeShared<FUnrealMCPBehaviorTreeCommands>();
     AnimationCommands = MakeShared<FUnrealMCPAnimationCommands>();
+    BenchmarkCommands = MakeShared<FUnrealMCPBenchmarkCommands>();
+    TrafficRecorder = MakeShared<FUnrealMCPTrafficRecorder>();
+    CommandStats = MakeShared<FUnrealMCPCommandStats>();
+    CommandWatchdog = MakeShared<FUnrealMCPCommandWatchdog>();
+    EventSubscriptions = MakeShared<FUnrealMCPEventSubscriptions>();
 }
 
 UUnrealMCPBridge::~UUnrealMCPBridge()
@@ -85,6 +279,11 @@ UUnrealMCPBridge::~UUnrealMCPBridge()
     UMGCommands.Reset();
     BehaviorTreeCommands.Reset();
     AnimationCommands.Reset();
+    BenchmarkCommands.Reset();
+    TrafficRecorder.Reset();
+    CommandStats.Reset();
+    CommandWatchdog.Reset();
+    EventSubscriptions.Reset();
 }
 
 // Initialize subsystem
@@ -99,6 +298,51 @@ void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    // -MCPRecordTraffic=<path> records from the first request (empty value picks a default path)
+    FString TrafficLogPath;
+    if (FParse::Value(FCommandLine::Get(), TEXT("MCPRecordTraffic="), TrafficLogPath) ||
+        FParse::Param(FCommandLine::Get(), TEXT("MCPRecordTraffic")))
+    {
+        FString RecordError;
+        if (!TrafficRecorder->Start(TrafficLogPath, false, RecordError))
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: %s"), *RecordError);
+        }
+    }
+
+    // -MCPAllocStats enables per-command memory accounting from the first request
+    if (FParse::Param(FCommandLine::Get(), TEXT("MCPAllocStats")))
+    {
+        CommandStats->SetAllocationTracking(true);
+    }
+
+    // -MCPCommandTimeout=<seconds> turns the watchdog on (off by default)
+    double CommandTimeoutSeconds = 0.0;
+    if (FParse::Value(FCommandLine::Get(), TEXT("MCPCommandTimeout="), CommandTimeoutSeconds))
+    {
+        CommandWatchdog->SetTimeoutSeconds(CommandTimeoutSeconds);
+    }
+
+    // -MCPChangeLogSize=<entries> bounds the get_level_changes log
+    int32 ChangeLogSize = 0;
+    if (FParse::Value(FCommandLine::Get(), TEXT("MCPChangeLogSize="), ChangeLogSize))
+    {
+        FUnrealMCPLevelChangeFeed::Get().SetCapacity(ChangeLogSize);
+    }
+
+    // Name/label -> actor lookups for the actor commands, kept current through level-actor delegates
+    FUnrealMCPActorIndex::Get().Initialize();
+    FUnrealMCPSpatialIndex::Get().Initialize();
+    FUnrealMCPLevelChangeFeed::Get().Initialize();
+    FUnrealMCPWorldPartitionActors::Get().Initialize();
+    FUnrealMCPAssetQuery::Get().Initialize();
+    FUnrealMCPBlueprintIndex::Get().Initialize();
+    FUnrealMCPClassIndex::Get().Initialize();
+    FUnrealMCPPropertyPlans::Get().Initialize();
+    FUnrealMCPFunctionPlans::Get().Initialize();
+    FUnrealMCPReadLoads::Get().Initialize();
+    EventSubscriptions->Initialize();
+
     // Start the server automatically
     StartServer();
 }
@@ -108,6 +352,18 @@ void UUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
     StopServer();
+    TrafficRecorder->Stop();
+    EventSubscriptions->Shutdown();
+    FUnrealMCPActorIndex::Get().Shutdown();
+    FUnrealMCPSpatialIndex::Get().Shutdown();
+    FUnrealMCPLevelChangeFeed::Get().Shutdown();
+    FUnrealMCPWorldPartitionActors::Get().Shutdown();
+    FUnrealMCPAssetQuery::Get().Shutdown();
+    FUnrealMCPBlueprintIndex::Get().Shutdown();
+    FUnrealMCPClassIndex::Get().Shutdown();
+    FUnrealMCPPropertyPlans::Get().Shutdown();
+    FUnrealMCPFunctionPlans::Get().Shutdown();
+    FUnrealMCPReadLoads::Get().Shutdown();
 }
 
 // Start the MCP server
@@ -208,17 +464,141 @@ void UUnrealMCPBridge::StopServer()
 }
 
 // Execute a command received from a client
-FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 SessionId)
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
     
+    const double RequestStartSeconds = FPlatformTime::Seconds();
+
+    if (IsWatchdogCommand(CommandType))
+    {
+        FString WatchdogError;
+        if (CommandType == TEXT("set_mcp_watchdog"))
+        {
+            double TimeoutSeconds = 0.0;
+            if (TSharedPtr<FJsonObject> UnknownParams = FUnrealMCPCommonUtils::CheckUnknownParams(Params, {TEXT("timeout_seconds")}))
+            {
+                WatchdogError = UnknownParams->GetStringField(TEXT("error"));
+            }
+            else if (!Params.IsValid() || !Params->TryGetNumberField(TEXT("timeout_seconds"), TimeoutSeconds))
+            {
+                WatchdogError = TEXT("Missing 'timeout_seconds' parameter (number of seconds, 0 disables)");
+            }
+            else if (!FMath::IsFinite(TimeoutSeconds) || TimeoutSeconds < 0.0)
+            {
+                WatchdogError = TEXT("'timeout_seconds' must be a non-negative number (0 disables)");
+            }
+            else
+            {
+                CommandWatchdog->SetTimeoutSeconds(TimeoutSeconds);
+            }
+        }
+
+        TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+        if (!WatchdogError.IsEmpty())
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), WatchdogError);
+        }
+        else
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), CommandWatchdog->GetStatus());
+        }
+        return SerializeResponse(ResponseJson);
+    }
+
+    if (IsSubscriptionCommand(CommandType))
+    {
+        TSharedPtr<FJsonObject> ResultJson;
+        EMCPEventTopic Topics = EMCPEventTopic::None;
+        FString TopicError;
+        if (SessionId <= 0)
+        {
+            ResultJson = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Subscriptions need a client connection (no session id)"));
+        }
+        else if (CommandType == TEXT("get_subscriptions"))
+        {
+            ResultJson = EventSubscriptions->Describe(SessionId);
+        }
+        else if (TSharedPtr<FJsonObject> UnknownParams = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+            CommandType == TEXT("subscribe")
+                ? TSet<FString>{TEXT("topics"), TEXT("path_prefixes"), TEXT("min_interval_ms")}
+                : TSet<FString>{TEXT("topics")}))
+        {
+            ResultJson = UnknownParams;
+        }
+        else if (!ParseSubscriptionTopics(Params, CommandType == TEXT("subscribe") ? EMCPEventTopic::None : EMCPEventTopic::All, Topics, TopicError))
+        {
+            ResultJson = FUnrealMCPCommonUtils::CreateErrorResponse(TopicError);
+        }
+        else if (CommandType == TEXT("unsubscribe"))
+        {
+            ResultJson = EventSubscriptions->Unsubscribe(SessionId, Topics);
+        }
+        else if (Topics == EMCPEventTopic::None)
+        {
+            ResultJson = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'topics' parameter"));
+        }
+        else
+        {
+            TArray<FString> PathPrefixes;
+            const TArray<TSharedPtr<FJsonValue>>* PrefixValues = nullptr;
+            const bool bHasPrefixes = Params->TryGetArrayField(TEXT("path_prefixes"), PrefixValues);
+            if (bHasPrefixes)
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *PrefixValues)
+                {
+                    if (Value.IsValid() && !Value->AsString().IsEmpty())
+                    {
+                        PathPrefixes.Add(Value->AsString());
+                    }
+                }
+            }
+
+            double MinIntervalMs = -1.0;
+            Params->TryGetNumberField(TEXT("min_interval_ms"), MinIntervalMs);
+            ResultJson = EventSubscriptions->Subscribe(SessionId, Topics, bHasPrefixes ? &PathPrefixes : nullptr,
+                MinIntervalMs >= 0.0 ? MinIntervalMs / 1000.0 : -1.0);
+        }
+
+        TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+        if (ResultJson->HasField(TEXT("success")) && !ResultJson->GetBoolField(TEXT("success")))
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), ResultJson->GetStringField(TEXT("error")));
+        }
+        else
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+        return SerializeResponse(ResponseJson);
+    }
+
+    // A timed-out handler still owns the game thread; anything queued now would only hang behind it
+    if (TSharedPtr<FJsonObject> BusyJson = CommandWatchdog->MakeBusyResponse(CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UnrealMCPBridge: Rejecting %s, game thread busy"), *CommandType);
+        FString Response = SerializeResponse(BusyJson);
+        CommandStats->RecordCommand(CommandType, 0.0, 0.0, false, Utf8Length(Response), nullptr, nullptr);
+        return Response;
+    }
+
+    const uint64 WatchdogTicket = CommandWatchdog->BeginCommand(CommandType, Params, SessionId);
+    TSharedRef<FMCPCommandExecutionInfo, ESPMode::ThreadSafe> ExecInfo = MakeShared<FMCPCommandExecutionInfo, ESPMode::ThreadSafe>();
+
     // Create a promise to wait for the result
     TPromise<FString> Promise;
     TFuture<FString> Future = Promise.GetFuture();
     
     // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, ExecInfo, WatchdogTicket, Promise = MoveTemp(Promise)]() mutable
     {
+        LLM_SCOPE_BYTAG(UnrealMCP);
+        // Closes after the response is handed back, so releasing over-budget packages never delays it
+        FMCPReadLoadScope ReadLoadScope(IsAssetReadCommand(CommandType));
+        ExecInfo->Begin(CommandStats->IsAllocationTracking());
         TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
         
         try
@@ -230,6 +610,104 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 ResultJson = MakeShareable(new FJsonObject);
                 ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
             }
+            else if (CommandType == TEXT("start_traffic_recording"))
+            {
+                FString Path;
+                bool bIncludeResponses = false;
+                if (Params.IsValid())
+                {
+                    Params->TryGetStringField(TEXT("path"), Path);
+                    Params->TryGetBoolField(TEXT("include_responses"), bIncludeResponses);
+                }
+
+                FString RecordError;
+                if (TrafficRecorder->Start(Path, bIncludeResponses, RecordError))
+                {
+                    ResultJson = TrafficRecorder->GetStatus();
+                }
+                else
+                {
+                    ResultJson = FUnrealMCPCommonUtils::CreateErrorResponse(RecordError);
+                }
+            }
+            else if (CommandType == TEXT("stop_traffic_recording"))
+            {
+                ResultJson = TrafficRecorder->GetStatus();
+                TrafficRecorder->Stop();
+                ResultJson->SetBoolField(TEXT("recording"), false);
+            }
+            else if (CommandType == TEXT("get_traffic_recording_status"))
+            {
+                ResultJson = TrafficRecorder->GetStatus();
+            }
+            else if (CommandType == TEXT("get_mcp_stats"))
+            {
+                FString CommandFilter;
+                FString SortBy = TEXT("exec_ms");
+                bool bReset = false;
+                if (Params.IsValid())
+                {
+                    Params->TryGetStringField(TEXT("command"), CommandFilter);
+                    Params->TryGetStringField(TEXT("sort_by"), SortBy);
+                    Params->TryGetBoolField(TEXT("reset"), bReset);
+                }
+
+                ResultJson = CommandStats->ToJson(CommandFilter, SortBy);
+                if (bReset)
+                {
+                    CommandStats->Reset();
+                }
+            }
+            else if (CommandType == TEXT("reset_mcp_stats"))
+            {
+                bool bAllocTracking = CommandStats->IsAllocationTracking();
+                if (Params.IsValid())
+                {
+                    Params->TryGetBoolField(TEXT("alloc_tracking"), bAllocTracking);
+                }
+
+                CommandStats->SetAllocationTracking(bAllocTracking);
+                CommandStats->Reset();
+                ResultJson = MakeShared<FJsonObject>();
+                ResultJson->SetBoolField(TEXT("alloc_tracking"), bAllocTracking);
+            }
+            else if (CommandType == TEXT("get_read_load_stats"))
+            {
+                ResultJson = FUnrealMCPReadLoads::Get().GetStats();
+            }
+            else if (CommandType == TEXT("set_read_load_policy"))
+            {
+                FUnrealMCPReadLoads& ReadLoads = FUnrealMCPReadLoads::Get();
+                double MaxPackages = -1.0;
+                double MaxMB = -1.0;
+                bool bEnabled = ReadLoads.IsEnabled();
+                bool bReleaseAll = false;
+                FString PolicyError;
+                if (TSharedPtr<FJsonObject> UnknownParams = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+                    {TEXT("max_packages"), TEXT("max_mb"), TEXT("enabled"), TEXT("release_all")}))
+                {
+                    ResultJson = UnknownParams;
+                }
+                else if (!TryGetReadLoadLimit(Params, TEXT("max_packages"), MaxPackages, PolicyError) ||
+                         !TryGetReadLoadLimit(Params, TEXT("max_mb"), MaxMB, PolicyError) ||
+                         !TryGetReadLoadFlag(Params, TEXT("enabled"), bEnabled, PolicyError) ||
+                         !TryGetReadLoadFlag(Params, TEXT("release_all"), bReleaseAll, PolicyError))
+                {
+                    ResultJson = FUnrealMCPCommonUtils::CreateErrorResponse(PolicyError);
+                }
+                else
+                {
+                    ReadLoads.SetPolicy(
+                        MaxPackages >= 0.0 ? static_cast<int32>(FMath::Min(MaxPackages, static_cast<double>(MAX_int32))) : -1,
+                        MaxMB >= 0.0 ? static_cast<int64>(MaxMB * 1024.0 * 1024.0) : -1,
+                        bEnabled);
+                    if (bReleaseAll)
+                    {
+                        ReadLoads.ReleaseAll();
+                    }
+                    ResultJson = ReadLoads.GetStats();
+                }
+            }
             else if (CommandType == TEXT("help"))
             {
                 ResultJson = MakeShareable(new FJsonObject);
@@ -241,6 +719,40 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 AllMeta.Add({TEXT("help"), TEXT("system"), TEXT("List available commands or get details for a specific command"), {
                     {TEXT("command"), TEXT("string"), false, TEXT("Command name to get details for")}
                 }});
+                AllMeta.Add({TEXT("start_traffic_recording"), TEXT("system"), TEXT("Start appending every request (timing + session) to a JSONL traffic log for replay"), {
+                    {TEXT("path"), TEXT("string"), false, TEXT("Log file path (default: Saved/UnrealMCP/Traffic/traffic_<timestamp>.jsonl)")},
+                    {TEXT("include_responses"), TEXT("bool"), false, TEXT("Also store full response bodies (default: false)")}
+                }});
+                AllMeta.Add({TEXT("stop_traffic_recording"), TEXT("system"), TEXT("Stop the active traffic recording"), {}});
+                AllMeta.Add({TEXT("get_traffic_recording_status"), TEXT("system"), TEXT("Report whether traffic recording is active, its path and record count"), {}});
+                AllMeta.Add({TEXT("get_mcp_stats"), TEXT("system"), TEXT("Per-command call count, exec/queue time, response size and (when tracking) memory deltas"), {
+                    {TEXT("command"), TEXT("string"), false, TEXT("Only report this command")},
+                    {TEXT("sort_by"), TEXT("string"), false, TEXT("exec_ms (default), calls, memory_bytes or response_bytes")},
+                    {TEXT("reset"), TEXT("bool"), false, TEXT("Clear the counters after reading (default: false)")}
+                }});
+                AllMeta.Add({TEXT("reset_mcp_stats"), TEXT("system"), TEXT("Clear per-command stats and optionally toggle allocation tracking"), {
+                    {TEXT("alloc_tracking"), TEXT("bool"), false, TEXT("Enable/disable per-command memory accounting (default: unchanged)")}
+                }});
+                AllMeta.Add({TEXT("get_read_load_stats"), TEXT("system"), TEXT("Packages loaded by read-only commands that are still tracked for release: count, bytes, budget and release counters"), {}});
+                AllMeta.Add({TEXT("set_read_load_policy"), TEXT("system"), TEXT("Change the LRU / memory budget for packages loaded by read-only commands"), {
+                    {TEXT("max_packages"), TEXT("number"), false, TEXT("Tracked packages kept before the least recently read are released (non-negative; default: 256)")},
+                    {TEXT("max_mb"), TEXT("number"), false, TEXT("Tracked bytes kept, in MB (non-negative; default: 512)")},
+                    {TEXT("enabled"), TEXT("bool"), false, TEXT("Track and release read loads at all (default: true; false forgets the tracked set)")},
+                    {TEXT("release_all"), TEXT("bool"), false, TEXT("Release every tracked package now (default: false)")}
+                }});
+                AllMeta.Add({TEXT("get_mcp_watchdog_status"), TEXT("system"), TEXT("Command timeout, whether a timed-out command still holds the game thread, and the last timeout's callstack/params"), {}});
+                AllMeta.Add({TEXT("set_mcp_watchdog"), TEXT("system"), TEXT("Change the command watchdog timeout"), {
+                    {TEXT("timeout_seconds"), TEXT("number"), true, TEXT("Seconds a command may hold the game thread before the client gets a command_timeout error (non-negative; 0 disables, the default)")}
+                }});
+                AllMeta.Add({TEXT("subscribe"), TEXT("system"), TEXT("Push coalesced, rate-limited editor events on this connection as notification frames"), {
+                    {TEXT("topics"), TEXT("array"), true, TEXT("Any of actors, assets, blueprints, dialogue, or all; added to the current subscription")},
+                    {TEXT("path_prefixes"), TEXT("array"), false, TEXT("Only events whose object path starts with one of these (replaces the previous filter; [] clears it)")},
+                    {TEXT("min_interval_ms"), TEXT("number"), false, TEXT("Minimum time between two frames of the same topic (default: 250)")}
+                }});
+                AllMeta.Add({TEXT("unsubscribe"), TEXT("system"), TEXT("Stop pushing the given topics on this connection and drop their queued events"), {
+                    {TEXT("topics"), TEXT("array"), false, TEXT("Topics to remove (default: all)")}
+                }});
+                AllMeta.Add({TEXT("get_subscriptions"), TEXT("system"), TEXT("This connection's topics, path filter, interval and queued event counts"), {}});
                 AllMeta.Append(FUnrealMCPEditorCommands::GetCommandMetadata());
                 AllMeta.Append(FUnrealMCPBlueprintCommands::GetCommandMetadata());
                 AllMeta.Append(FUnrealMCPBlueprintNodeCommands::GetCommandMetadata());
@@ -248,6 +760,7 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 AllMeta.Append(FUnrealMCPUMGCommands::GetCommandMetadata());
                 AllMeta.Append(FUnrealMCPBehaviorTreeCommands::GetCommandMetadata());
                 AllMeta.Append(FUnrealMCPAnimationCommands::GetCommandMetadata());
+                AllMeta.Append(FUnrealMCPBenchmarkCommands::GetCommandMetadata());
                 AllMeta.Append(FUnrealMCPCommandRegistry::Get().GetAllExtensionMetadata());
 
                 FString RequestedCommand;
@@ -315,13 +828,23 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
             // Editor Commands (including actor manipulation)
             else if (CommandType == TEXT("get_actors_in_level") ||
                      CommandType == TEXT("find_actors_by_name") ||
+                     CommandType == TEXT("get_level_changes") ||
+                     CommandType == TEXT("find_actors_in_box") ||
+                     CommandType == TEXT("find_actors_in_sphere") ||
+                     CommandType == TEXT("find_actors_in_frustum") ||
+                     CommandType == TEXT("find_nearest_actors") ||
+                     CommandType == TEXT("find_world_partition_actors") ||
+                     CommandType == TEXT("load_world_partition_actors") ||
+                     CommandType == TEXT("release_world_partition_actors") ||
                      CommandType == TEXT("spawn_actor") ||
                      CommandType == TEXT("create_actor") ||
                      CommandType == TEXT("delete_actor") ||
                      CommandType == TEXT("set_actor_transform") ||
+                     CommandType == TEXT("set_actor_transforms") ||
                      CommandType == TEXT("get_actor_properties") ||
                      CommandType == TEXT("set_actor_property") ||
                      CommandType == TEXT("spawn_blueprint_actor") ||
+                     CommandType == TEXT("spawn_actors") ||
                      CommandType == TEXT("focus_viewport") ||
                      CommandType == TEXT("take_screenshot") ||
                      CommandType == TEXT("save_dirty_assets") ||
@@ -330,7 +853,9 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                      CommandType == TEXT("call_subsystem_function") ||
                      CommandType == TEXT("add_to_actor_array_property") ||
                      CommandType == TEXT("get_data_asset") ||
-                     CommandType == TEXT("find_assets"))
+                     CommandType == TEXT("find_assets") ||
+                     CommandType == TEXT("query_assets") ||
+                     CommandType == TEXT("get_assets_bulk"))
             {
                 ResultJson = EditorCommands->HandleCommand(CommandType, Params);
             }
@@ -344,7 +869,10 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                      CommandType == TEXT("set_static_mesh_properties") ||
                      CommandType == TEXT("set_pawn_properties") ||
                      CommandType == TEXT("get_blueprint_info") ||
-                     CommandType == TEXT("get_blueprint_defaults"))
+                     CommandType == TEXT("get_blueprint_defaults") ||
+                     CommandType == TEXT("resolve_blueprint") ||
+                     CommandType == TEXT("set_blueprint_properties") ||
+                     CommandType == TEXT("compile_blueprints"))
             {
                 ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
             }
@@ -399,6 +927,8 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                      CommandType == TEXT("delete_widget_blueprints_by_prefix") ||
                      CommandType == TEXT("set_widget_common_properties") ||
                      CommandType == TEXT("set_widget_common_properties_batch") ||
+                     CommandType == TEXT("get_widget_property") ||
+                     CommandType == TEXT("set_widget_property") ||
                      CommandType == TEXT("set_text_block_properties") ||
                      CommandType == TEXT("set_text_block_properties_batch") ||
                      CommandType == TEXT("add_text_block_to_widget") ||
@@ -419,6 +949,13 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
             {
                 ResultJson = AnimationCommands->HandleCommand(CommandType, Params);
             }
+            // Benchmark fixture generators
+            else if (CommandType == TEXT("generate_benchmark_actors") ||
+                     CommandType == TEXT("generate_benchmark_blueprint") ||
+                     CommandType == TEXT("generate_benchmark_widget_tree"))
+            {
+                ResultJson = BenchmarkCommands->HandleCommand(CommandType, Params);
+            }
             else if (TSharedPtr<IUnrealMCPCommandHandler> ExtensionHandler =
                 FUnrealMCPCommandRegistry::Get().FindHandlerForCommand(CommandType))
             {
@@ -432,6 +969,8 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 FString ResultString;
                 TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
                 FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+                ExecInfo->Finish(false);
+                CommandWatchdog->EndCommand(WatchdogTicket);
                 Promise.SetValue(ResultString);
                 return;
             }
@@ -471,8 +1010,62 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
         FString ResultString;
         TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
         FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+        ExecInfo->Finish(ResponseJson->GetStringField(TEXT("status")) == TEXT("success"));
+        CommandWatchdog->EndCommand(WatchdogTicket);
         Promise.SetValue(ResultString);
     });
     
-    return Future.Get();
+    const double TimeoutSeconds = CommandWatchdog->GetTimeoutSeconds();
+    if (TimeoutSeconds > 0.0 && !Future.WaitFor(FTimespan::FromSeconds(TimeoutSeconds)))
+    {
+        // Null when the handler returned between the wait expiring and the report; fall through to its result
+        if (TSharedPtr<FJsonObject> TimeoutJson = CommandWatchdog->ReportTimeout(WatchdogTicket))
+        {
+            // ExecInfo is still owned by the running handler, so time the whole wait instead
+            FString Response = SerializeResponse(TimeoutJson);
+            const int32 ResponseBytes = Utf8Length(Response);
+            const double ElapsedMs = (FPlatformTime::Seconds() - RequestStartSeconds) * 1000.0;
+            if (!IsTrafficRecordingControlCommand(CommandType))
+            {
+                TrafficRecorder->RecordRequest(SessionId, CommandType, Params, RequestStartSeconds, 0.0, ElapsedMs, false, Response, ResponseBytes);
+            }
+            CommandStats->RecordCommand(CommandType, 0.0, ElapsedMs, false, ResponseBytes, nullptr, nullptr);
+            return Response;
+        }
+    }
+
+    FString Response = Future.Get();
+    const int32 ResponseBytes = Utf8Length(Response);
+
+    const double QueueMs = (ExecInfo->ExecStartSeconds - RequestStartSeconds) * 1000.0;
+    const double ExecMs = (ExecInfo->ExecEndSeconds - ExecInfo->ExecStartSeconds) * 1000.0;
+
+    if (!IsTrafficRecordingControlCommand(CommandType))
+    {
+        TrafficRecorder->RecordRequest(SessionId, CommandType, Params, RequestStartSeconds, QueueMs, ExecMs, ExecInfo->bSuccess, Response, ResponseBytes);
+    }
+
+    if (!IsCommandStatsCommand(CommandType))
+    {
+        CommandStats->RecordCommand(
+            CommandType,
+            QueueMs,
+            ExecMs,
+            ExecInfo->bSuccess,
+            ResponseBytes,
+            ExecInfo->bAllocTracked ? &ExecInfo->AllocStart : nullptr,
+            ExecInfo->bAllocTracked ? &ExecInfo->AllocEnd : nullptr);
+    }
+
+    return Response;
+}
+
+void UUnrealMCPBridge::CollectNotifications(int32 SessionId, TArray<FString>& OutFrames)
+{
+    EventSubscriptions->CollectDueNotifications(SessionId, OutFrames);
+}
+
+void UUnrealMCPBridge::EndSession(int32 SessionId)
+{
+    EventSubscriptions->EndSession(SessionId);
 }
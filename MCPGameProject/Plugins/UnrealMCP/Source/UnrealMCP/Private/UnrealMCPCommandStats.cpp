@@ -0,0 +1,167 @@
+#include "UnrealMCPCommandStats.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+FUnrealMCPCommandStats::FUnrealMCPCommandStats()
+    : WindowStartSeconds(FPlatformTime::Seconds())
+    , bAllocationTracking(false)
+{
+}
+
+void FUnrealMCPCommandStats::SetAllocationTracking(bool bEnable)
+{
+    FScopeLock Lock(&Mutex);
+    bAllocationTracking = bEnable;
+}
+
+bool FUnrealMCPCommandStats::IsAllocationTracking() const
+{
+    FScopeLock Lock(&Mutex);
+    return bAllocationTracking;
+}
+
+FMCPAllocSnapshot FUnrealMCPCommandStats::CaptureAllocSnapshot()
+{
+    FMCPAllocSnapshot Snapshot;
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    // Handlers run under LLM_SCOPE_BYTAG(UnrealMCP); the tag total is what they keep allocated
+    if (FLowLevelMemTracker::IsEnabled())
+    {
+        Snapshot.bHasLLM = true;
+        Snapshot.LLMBytes = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, FName(TEXT("UnrealMCP")), ELLMTagSet::None);
+    }
+#endif
+
+    const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+    Snapshot.UsedPhysical = MemoryStats.UsedPhysical;
+    Snapshot.PeakUsedPhysical = MemoryStats.PeakUsedPhysical;
+    return Snapshot;
+}
+
+void FUnrealMCPCommandStats::RecordCommand(
+    const FString& CommandType,
+    double QueueMs,
+    double ExecMs,
+    bool bSuccess,
+    int32 ResponseBytes,
+    const FMCPAllocSnapshot* AllocStart,
+    const FMCPAllocSnapshot* AllocEnd)
+{
+    FScopeLock Lock(&Mutex);
+
+    FCommandEntry& Entry = Entries.FindOrAdd(CommandType);
+    ++Entry.Calls;
+    if (!bSuccess)
+    {
+        ++Entry.Errors;
+    }
+    Entry.TotalExecMs += ExecMs;
+    Entry.MaxExecMs = FMath::Max(Entry.MaxExecMs, ExecMs);
+    Entry.TotalQueueMs += QueueMs;
+    Entry.TotalResponseBytes += ResponseBytes;
+    Entry.MaxResponseBytes = FMath::Max(Entry.MaxResponseBytes, ResponseBytes);
+
+    if (AllocStart && AllocEnd)
+    {
+        const int64 WorkingSetDelta = static_cast<int64>(AllocEnd->UsedPhysical) - static_cast<int64>(AllocStart->UsedPhysical);
+        ++Entry.AllocTrackedCalls;
+        Entry.TotalWorkingSetDeltaBytes += WorkingSetDelta;
+        Entry.MaxWorkingSetDeltaBytes = FMath::Max(Entry.MaxWorkingSetDeltaBytes, WorkingSetDelta);
+        if (AllocStart->bHasLLM && AllocEnd->bHasLLM)
+        {
+            const int64 LLMDelta = AllocEnd->LLMBytes - AllocStart->LLMBytes;
+            ++Entry.LLMTrackedCalls;
+            Entry.TotalLLMBytes += LLMDelta;
+            Entry.MaxLLMBytes = FMath::Max(Entry.MaxLLMBytes, LLMDelta);
+        }
+        Entry.MaxPeakWorkingSetDeltaBytes = FMath::Max(Entry.MaxPeakWorkingSetDeltaBytes,
+            AllocEnd->PeakUsedPhysical - AllocStart->PeakUsedPhysical);
+    }
+}
+
+void FUnrealMCPCommandStats::Reset()
+{
+    FScopeLock Lock(&Mutex);
+    Entries.Reset();
+    WindowStartSeconds = FPlatformTime::Seconds();
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommandStats::ToJson(const FString& CommandFilter, const FString& SortBy) const
+{
+    FScopeLock Lock(&Mutex);
+
+    TArray<TPair<FString, const FCommandEntry*>> Rows;
+    int64 TotalCalls = 0;
+    for (const TPair<FString, FCommandEntry>& Pair : Entries)
+    {
+        TotalCalls += Pair.Value.Calls;
+        if (CommandFilter.IsEmpty() || Pair.Key == CommandFilter)
+        {
+            Rows.Emplace(Pair.Key, &Pair.Value);
+        }
+    }
+
+    auto SortKey = [&SortBy](const FCommandEntry& Entry) -> double
+    {
+        if (SortBy == TEXT("calls"))
+        {
+            return static_cast<double>(Entry.Calls);
+        }
+        if (SortBy == TEXT("memory_bytes"))
+        {
+            return static_cast<double>(Entry.LLMTrackedCalls > 0 ? Entry.TotalLLMBytes : Entry.TotalWorkingSetDeltaBytes);
+        }
+        if (SortBy == TEXT("response_bytes"))
+        {
+            return static_cast<double>(Entry.TotalResponseBytes);
+        }
+        return Entry.TotalExecMs;
+    };
+    Rows.Sort([&SortKey](const TPair<FString, const FCommandEntry*>& A, const TPair<FString, const FCommandEntry*>& B)
+    {
+        return SortKey(*A.Value) > SortKey(*B.Value);
+    });
+
+    TArray<TSharedPtr<FJsonValue>> CommandArray;
+    for (const TPair<FString, const FCommandEntry*>& Row : Rows)
+    {
+        const FCommandEntry& Entry = *Row.Value;
+        const double Calls = static_cast<double>(FMath::Max<int64>(Entry.Calls, 1));
+
+        TSharedPtr<FJsonObject> CommandObj = MakeShared<FJsonObject>();
+        CommandObj->SetStringField(TEXT("command"), Row.Key);
+        CommandObj->SetNumberField(TEXT("calls"), static_cast<double>(Entry.Calls));
+        CommandObj->SetNumberField(TEXT("errors"), static_cast<double>(Entry.Errors));
+        CommandObj->SetNumberField(TEXT("total_exec_ms"), Entry.TotalExecMs);
+        CommandObj->SetNumberField(TEXT("avg_exec_ms"), Entry.TotalExecMs / Calls);
+        CommandObj->SetNumberField(TEXT("max_exec_ms"), Entry.MaxExecMs);
+        CommandObj->SetNumberField(TEXT("avg_queue_ms"), Entry.TotalQueueMs / Calls);
+        CommandObj->SetNumberField(TEXT("avg_response_bytes"), static_cast<double>(Entry.TotalResponseBytes) / Calls);
+        CommandObj->SetNumberField(TEXT("max_response_bytes"), Entry.MaxResponseBytes);
+
+        if (Entry.AllocTrackedCalls > 0)
+        {
+            const double TrackedCalls = static_cast<double>(Entry.AllocTrackedCalls);
+            CommandObj->SetNumberField(TEXT("alloc_tracked_calls"), TrackedCalls);
+            CommandObj->SetNumberField(TEXT("avg_working_set_delta_bytes"), static_cast<double>(Entry.TotalWorkingSetDeltaBytes) / TrackedCalls);
+            CommandObj->SetNumberField(TEXT("max_working_set_delta_bytes"), static_cast<double>(Entry.MaxWorkingSetDeltaBytes));
+            CommandObj->SetNumberField(TEXT("max_peak_working_set_delta_bytes"), static_cast<double>(Entry.MaxPeakWorkingSetDeltaBytes));
+        }
+        if (Entry.LLMTrackedCalls > 0)
+        {
+            CommandObj->SetNumberField(TEXT("avg_llm_bytes"), static_cast<double>(Entry.TotalLLMBytes) / static_cast<double>(Entry.LLMTrackedCalls));
+            CommandObj->SetNumberField(TEXT("max_llm_bytes"), static_cast<double>(Entry.MaxLLMBytes));
+        }
+
+        CommandArray.Add(MakeShared<FJsonValueObject>(CommandObj));
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("alloc_tracking"), bAllocationTracking);
+    Result->SetNumberField(TEXT("window_seconds"), FPlatformTime::Seconds() - WindowStartSeconds);
+    Result->SetNumberField(TEXT("total_calls"), static_cast<double>(TotalCalls));
+    Result->SetArrayField(TEXT("commands"), CommandArray);
+    return Result;
+}
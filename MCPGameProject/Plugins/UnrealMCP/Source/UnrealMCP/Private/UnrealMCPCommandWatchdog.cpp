@@ -0,0 +1,231 @@
+#include "UnrealMCPCommandWatchdog.h"
+#include "HAL/PlatformStackWalk.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+// Opt-in: bulk commands (compile_blueprints, set_blueprint_properties, save_dirty_assets, ...) legitimately run for minutes
+const double DefaultCommandTimeoutSeconds = 0.0;
+const uint32 MaxCallstackDepth = 64;
+const int32 MaxLoggedParamsChars = 2048;
+
+FString SerializeParams(const TSharedPtr<FJsonObject>& Params)
+{
+    if (!Params.IsValid())
+    {
+        return TEXT("{}");
+    }
+
+    FString Output;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+    FJsonSerializer::Serialize(Params.ToSharedRef(), Writer);
+    return Output;
+}
+}
+
+FUnrealMCPCommandWatchdog::FUnrealMCPCommandWatchdog()
+    : TimeoutSeconds(DefaultCommandTimeoutSeconds)
+    , NextTicket(1)
+    , TimeoutCount(0)
+{
+}
+
+void FUnrealMCPCommandWatchdog::SetTimeoutSeconds(double InTimeoutSeconds)
+{
+    FScopeLock Lock(&Mutex);
+    TimeoutSeconds = FMath::Max(0.0, InTimeoutSeconds);
+}
+
+double FUnrealMCPCommandWatchdog::GetTimeoutSeconds() const
+{
+    FScopeLock Lock(&Mutex);
+    return TimeoutSeconds;
+}
+
+uint64 FUnrealMCPCommandWatchdog::BeginCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 SessionId)
+{
+    FScopeLock Lock(&Mutex);
+
+    FInFlightCommand Command;
+    Command.Ticket = NextTicket++;
+    Command.CommandType = CommandType;
+    Command.Params = Params;
+    Command.SessionId = SessionId;
+    Command.StartSeconds = FPlatformTime::Seconds();
+    InFlight = MoveTemp(Command);
+    return InFlight->Ticket;
+}
+
+void FUnrealMCPCommandWatchdog::EndCommand(uint64 Ticket)
+{
+    FScopeLock Lock(&Mutex);
+    if (!InFlight.IsSet() || InFlight->Ticket != Ticket)
+    {
+        return;
+    }
+
+    if (InFlight->bTimedOut)
+    {
+        const double ElapsedMs = (FPlatformTime::Seconds() - InFlight->StartSeconds) * 1000.0;
+        UE_LOG(LogTemp, Warning, TEXT("UnrealMCPCommandWatchdog: Timed-out command '%s' finally returned after %.0f ms; accepting commands again"),
+            *InFlight->CommandType, ElapsedMs);
+        if (LastTimeout.IsSet())
+        {
+            LastTimeout->RecoveredAfterMs = ElapsedMs;
+        }
+    }
+    InFlight.Reset();
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommandWatchdog::ReportTimeout(uint64 Ticket)
+{
+    FInFlightCommand Command;
+    double Timeout = 0.0;
+    {
+        FScopeLock Lock(&Mutex);
+        if (!InFlight.IsSet() || InFlight->Ticket != Ticket)
+        {
+            return nullptr;
+        }
+        InFlight->bTimedOut = true;
+        Command = InFlight.GetValue();
+        Timeout = TimeoutSeconds;
+    }
+
+    // Symbolication can take a while on first use; do it outside the lock so the handler can still finish.
+    const TArray<FString> Callstack = CaptureGameThreadCallstack();
+    const FString ParamsJson = SerializeParams(Command.Params);
+    const double ElapsedMs = (FPlatformTime::Seconds() - Command.StartSeconds) * 1000.0;
+
+    UE_LOG(LogTemp, Error, TEXT("UnrealMCPCommandWatchdog: Command '%s' (session %d) exceeded %.0f s timeout; game thread still busy. Params: %s"),
+        *Command.CommandType, Command.SessionId, Timeout,
+        ParamsJson.Len() > MaxLoggedParamsChars ? *(ParamsJson.Left(MaxLoggedParamsChars) + TEXT("...<truncated>")) : *ParamsJson);
+    if (Callstack.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UnrealMCPCommandWatchdog: Game-thread callstack unavailable on this platform"));
+    }
+    for (const FString& Frame : Callstack)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UnrealMCPCommandWatchdog:     %s"), *Frame);
+    }
+
+    FTimeoutInfo Info;
+    Info.CommandType = Command.CommandType;
+    Info.SessionId = Command.SessionId;
+    Info.ElapsedMs = ElapsedMs;
+    Info.TimeoutSeconds = Timeout;
+    Info.ParamsJson = ParamsJson;
+    Info.Callstack = Callstack;
+    TSharedPtr<FJsonObject> Diagnostics = TimeoutInfoToJson(Info);
+
+    {
+        FScopeLock Lock(&Mutex);
+        ++TimeoutCount;
+        LastTimeout = MoveTemp(Info);
+    }
+
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("status"), TEXT("error"));
+    Response->SetStringField(TEXT("error"), FString::Printf(
+        TEXT("Command '%s' did not finish within %.0f s; the game thread is still running it and new commands are rejected until it returns"),
+        *Command.CommandType, Timeout));
+    Response->SetStringField(TEXT("error_code"), TEXT("command_timeout"));
+    Response->SetObjectField(TEXT("details"), Diagnostics);
+    return Response;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommandWatchdog::MakeBusyResponse(const FString& CommandType) const
+{
+    FScopeLock Lock(&Mutex);
+    if (!InFlight.IsSet() || !InFlight->bTimedOut)
+    {
+        return nullptr;
+    }
+
+    const double StuckForMs = (FPlatformTime::Seconds() - InFlight->StartSeconds) * 1000.0;
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("status"), TEXT("error"));
+    Response->SetStringField(TEXT("error"), FString::Printf(
+        TEXT("Cannot run '%s': the game thread is still busy with timed-out command '%s' (%.0f ms)"),
+        *CommandType, *InFlight->CommandType, StuckForMs));
+    Response->SetStringField(TEXT("error_code"), TEXT("game_thread_busy"));
+    Response->SetStringField(TEXT("stuck_command"), InFlight->CommandType);
+    Response->SetNumberField(TEXT("stuck_for_ms"), StuckForMs);
+    return Response;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommandWatchdog::GetStatus() const
+{
+    FScopeLock Lock(&Mutex);
+
+    TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+    Status->SetNumberField(TEXT("timeout_seconds"), TimeoutSeconds);
+    Status->SetNumberField(TEXT("timeouts"), TimeoutCount);
+
+    const bool bBusy = InFlight.IsSet() && InFlight->bTimedOut;
+    Status->SetBoolField(TEXT("game_thread_busy"), bBusy);
+    if (bBusy)
+    {
+        Status->SetStringField(TEXT("stuck_command"), InFlight->CommandType);
+        Status->SetNumberField(TEXT("stuck_for_ms"), (FPlatformTime::Seconds() - InFlight->StartSeconds) * 1000.0);
+    }
+    if (LastTimeout.IsSet())
+    {
+        Status->SetObjectField(TEXT("last_timeout"), TimeoutInfoToJson(LastTimeout.GetValue()));
+    }
+    return Status;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommandWatchdog::TimeoutInfoToJson(const FTimeoutInfo& Info)
+{
+    TArray<TSharedPtr<FJsonValue>> CallstackArray;
+    for (const FString& Frame : Info.Callstack)
+    {
+        CallstackArray.Add(MakeShared<FJsonValueString>(Frame));
+    }
+
+    // Params are re-read from the text captured at timeout, not shared with the running handler
+    TSharedPtr<FJsonObject> Params;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Info.ParamsJson), Params) || !Params.IsValid())
+    {
+        Params = MakeShared<FJsonObject>();
+    }
+
+    TSharedPtr<FJsonObject> Diagnostics = MakeShared<FJsonObject>();
+    Diagnostics->SetStringField(TEXT("command"), Info.CommandType);
+    Diagnostics->SetNumberField(TEXT("session"), Info.SessionId);
+    Diagnostics->SetNumberField(TEXT("elapsed_ms"), Info.ElapsedMs);
+    Diagnostics->SetNumberField(TEXT("timeout_seconds"), Info.TimeoutSeconds);
+    Diagnostics->SetObjectField(TEXT("params"), Params);
+    Diagnostics->SetArrayField(TEXT("game_thread_callstack"), CallstackArray);
+    if (Info.RecoveredAfterMs >= 0.0)
+    {
+        Diagnostics->SetNumberField(TEXT("recovered_after_ms"), Info.RecoveredAfterMs);
+    }
+    return Diagnostics;
+}
+
+TArray<FString> FUnrealMCPCommandWatchdog::CaptureGameThreadCallstack()
+{
+    TArray<FString> Frames;
+
+    uint64 BackTrace[MaxCallstackDepth] = {};
+    FPlatformStackWalk::InitStackWalking();
+    const uint32 Depth = FPlatformStackWalk::CaptureThreadStackBackTrace(GGameThreadId, BackTrace, MaxCallstackDepth);
+    for (uint32 Index = 0; Index < Depth; ++Index)
+    {
+        ANSICHAR Symbol[1024];
+        Symbol[0] = '\0';
+        FPlatformStackWalk::ProgramCounterToHumanReadableString(Index, BackTrace[Index], Symbol, UE_ARRAY_COUNT(Symbol));
+        FString Frame = ANSI_TO_TCHAR(Symbol);
+        Frame.TrimEndInline();
+        if (!Frame.IsEmpty())
+        {
+            Frames.Add(MoveTemp(Frame));
+        }
+    }
+    return Frames;
+}
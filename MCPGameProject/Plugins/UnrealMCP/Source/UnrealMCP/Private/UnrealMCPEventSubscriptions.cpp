@@ -0,0 +1,594 @@
+#include "UnrealMCPEventSubscriptions.h"
+#include "Commands/UnrealMCPLevelChangeFeed.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+const double DefaultMinIntervalSeconds = 0.25;
+const double MaxMinIntervalSeconds = 60.0;
+
+// Past this many distinct keys a topic queue is dropped and the client told to re-query
+const int32 MaxQueuedEventsPerTopic = 5000;
+const int32 MaxEventsPerFrame = 500;
+
+const EMCPEventTopic AllTopics[] = {
+    EMCPEventTopic::Actors,
+    EMCPEventTopic::Assets,
+    EMCPEventTopic::Blueprints,
+    EMCPEventTopic::Dialogue,
+};
+
+bool IsDialogueClass(const FString& ClassName)
+{
+    return ClassName.Contains(TEXT("Dialogue"));
+}
+
+const TCHAR* BlueprintStatusToString(EBlueprintStatus Status)
+{
+    switch (Status)
+    {
+    case BS_UpToDate:
+        return TEXT("up_to_date");
+    case BS_UpToDateWithWarnings:
+        return TEXT("warnings");
+    case BS_Error:
+        return TEXT("error");
+    case BS_Dirty:
+        return TEXT("dirty");
+    default:
+        return TEXT("unknown");
+    }
+}
+}
+
+FUnrealMCPEventSubscriptions::FUnrealMCPEventSubscriptions()
+    : ActiveTopics(0)
+    , bInitialized(false)
+{
+}
+
+FUnrealMCPEventSubscriptions::~FUnrealMCPEventSubscriptions()
+{
+    Shutdown();
+}
+
+void FUnrealMCPEventSubscriptions::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    FUnrealMCPLevelChangeFeed& Feed = FUnrealMCPLevelChangeFeed::Get();
+    LevelChangeHandle = Feed.OnChangeRecorded().AddRaw(this, &FUnrealMCPEventSubscriptions::HandleLevelChange);
+    LevelResyncHandle = Feed.OnResyncRequired().AddRaw(this, &FUnrealMCPEventSubscriptions::HandleLevelResync);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FUnrealMCPEventSubscriptions::HandleAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FUnrealMCPEventSubscriptions::HandleAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FUnrealMCPEventSubscriptions::HandleAssetRenamed);
+
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FUnrealMCPEventSubscriptions::HandlePackageSaved);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FUnrealMCPEventSubscriptions::HandleObjectPropertyChanged);
+
+    if (GEditor)
+    {
+        BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FUnrealMCPEventSubscriptions::HandleBlueprintPreCompile);
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FUnrealMCPEventSubscriptions::HandleBlueprintCompiled);
+    }
+
+    bInitialized = true;
+}
+
+void FUnrealMCPEventSubscriptions::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FUnrealMCPLevelChangeFeed& Feed = FUnrealMCPLevelChangeFeed::Get();
+    Feed.OnChangeRecorded().Remove(LevelChangeHandle);
+    Feed.OnResyncRequired().Remove(LevelResyncHandle);
+
+    // The registry can already be gone during editor shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    CompilingBlueprints.Reset();
+
+    {
+        FScopeLock Lock(&Mutex);
+        Sessions.Reset();
+        RefreshActiveTopics();
+    }
+
+    bInitialized = false;
+}
+
+bool FUnrealMCPEventSubscriptions::ParseTopic(const FString& Name, EMCPEventTopic& OutTopic)
+{
+    if (Name.Equals(TEXT("all"), ESearchCase::IgnoreCase))
+    {
+        OutTopic = EMCPEventTopic::All;
+        return true;
+    }
+
+    for (EMCPEventTopic Topic : AllTopics)
+    {
+        if (Name.Equals(TopicToString(Topic), ESearchCase::IgnoreCase))
+        {
+            OutTopic = Topic;
+            return true;
+        }
+    }
+    return false;
+}
+
+const TCHAR* FUnrealMCPEventSubscriptions::TopicToString(EMCPEventTopic Topic)
+{
+    switch (Topic)
+    {
+    case EMCPEventTopic::Actors:
+        return TEXT("actors");
+    case EMCPEventTopic::Assets:
+        return TEXT("assets");
+    case EMCPEventTopic::Blueprints:
+        return TEXT("blueprints");
+    case EMCPEventTopic::Dialogue:
+        return TEXT("dialogue");
+    default:
+        return TEXT("none");
+    }
+}
+
+int32 FUnrealMCPEventSubscriptions::TopicIndex(EMCPEventTopic Topic)
+{
+    return static_cast<int32>(FMath::CountTrailingZeros(static_cast<uint32>(Topic)));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEventSubscriptions::Subscribe(int32 SessionId, EMCPEventTopic Topics, const TArray<FString>* PathPrefixes, double MinIntervalSeconds)
+{
+    FScopeLock Lock(&Mutex);
+
+    FSession* Session = Sessions.Find(SessionId);
+    if (!Session)
+    {
+        Session = &Sessions.Add(SessionId);
+        Session->MinIntervalSeconds = DefaultMinIntervalSeconds;
+    }
+
+    Session->Topics |= Topics;
+    if (PathPrefixes)
+    {
+        Session->PathPrefixes = *PathPrefixes;
+    }
+    if (MinIntervalSeconds >= 0.0)
+    {
+        Session->MinIntervalSeconds = FMath::Min(MinIntervalSeconds, MaxMinIntervalSeconds);
+    }
+
+    RefreshActiveTopics();
+    return DescribeLocked(SessionId, Session);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEventSubscriptions::Unsubscribe(int32 SessionId, EMCPEventTopic Topics)
+{
+    FScopeLock Lock(&Mutex);
+
+    FSession* Session = Sessions.Find(SessionId);
+    if (Session)
+    {
+        Session->Topics &= ~Topics;
+        for (EMCPEventTopic Topic : AllTopics)
+        {
+            if (EnumHasAnyFlags(Topics, Topic))
+            {
+                Session->Queues[TopicIndex(Topic)] = FTopicQueue();
+            }
+        }
+
+        if (Session->Topics == EMCPEventTopic::None)
+        {
+            Sessions.Remove(SessionId);
+            Session = nullptr;
+        }
+        RefreshActiveTopics();
+    }
+    return DescribeLocked(SessionId, Session);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEventSubscriptions::Describe(int32 SessionId) const
+{
+    FScopeLock Lock(&Mutex);
+    return DescribeLocked(SessionId, Sessions.Find(SessionId));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEventSubscriptions::DescribeLocked(int32 SessionId, const FSession* Session) const
+{
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("session_id"), SessionId);
+
+    TArray<TSharedPtr<FJsonValue>> TopicsArray;
+    TArray<TSharedPtr<FJsonValue>> PrefixArray;
+    TSharedPtr<FJsonObject> PendingObj = MakeShared<FJsonObject>();
+    if (Session)
+    {
+        for (EMCPEventTopic Topic : AllTopics)
+        {
+            if (EnumHasAnyFlags(Session->Topics, Topic))
+            {
+                TopicsArray.Add(MakeShared<FJsonValueString>(TopicToString(Topic)));
+                PendingObj->SetNumberField(TopicToString(Topic), Session->Queues[TopicIndex(Topic)].Events.Num());
+            }
+        }
+        for (const FString& Prefix : Session->PathPrefixes)
+        {
+            PrefixArray.Add(MakeShared<FJsonValueString>(Prefix));
+        }
+        Result->SetNumberField(TEXT("min_interval_ms"), Session->MinIntervalSeconds * 1000.0);
+    }
+    Result->SetArrayField(TEXT("topics"), TopicsArray);
+    Result->SetArrayField(TEXT("path_prefixes"), PrefixArray);
+    Result->SetObjectField(TEXT("pending"), PendingObj);
+    return Result;
+}
+
+void FUnrealMCPEventSubscriptions::EndSession(int32 SessionId)
+{
+    FScopeLock Lock(&Mutex);
+    if (Sessions.Remove(SessionId) > 0)
+    {
+        RefreshActiveTopics();
+    }
+}
+
+void FUnrealMCPEventSubscriptions::CollectDueNotifications(int32 SessionId, TArray<FString>& OutFrames)
+{
+    if (ActiveTopics.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+
+    FScopeLock Lock(&Mutex);
+    FSession* Session = Sessions.Find(SessionId);
+    if (!Session)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    for (EMCPEventTopic Topic : AllTopics)
+    {
+        FTopicQueue& Queue = Session->Queues[TopicIndex(Topic)];
+        if (Queue.Events.Num() == 0 && !Queue.bOverflow)
+        {
+            Queue.Order.Reset();
+            continue;
+        }
+        if (Now - Queue.LastSentSeconds < Session->MinIntervalSeconds)
+        {
+            continue;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> EventsArray;
+        int32 Consumed = 0;
+        for (; Consumed < Queue.Order.Num() && EventsArray.Num() < MaxEventsPerFrame; ++Consumed)
+        {
+            FPendingEvent Event;
+            if (!Queue.Events.RemoveAndCopyValue(Queue.Order[Consumed], Event))
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> EventObj = MakeShared<FJsonObject>();
+            EventObj->SetStringField(TEXT("type"), Event.Type);
+            if (!Event.Name.IsEmpty())
+            {
+                EventObj->SetStringField(TEXT("name"), Event.Name);
+            }
+            if (!Event.Path.IsEmpty())
+            {
+                EventObj->SetStringField(TEXT("path"), Event.Path);
+            }
+            if (!Event.Class.IsEmpty())
+            {
+                EventObj->SetStringField(TEXT("class"), Event.Class);
+            }
+            if (!Event.OldPath.IsEmpty())
+            {
+                EventObj->SetStringField(TEXT("old_path"), Event.OldPath);
+            }
+            if (!Event.Status.IsEmpty())
+            {
+                EventObj->SetStringField(TEXT("status"), Event.Status);
+            }
+            EventsArray.Add(MakeShared<FJsonValueObject>(EventObj));
+        }
+        Queue.Order.RemoveAt(0, Consumed, EAllowShrinking::No);
+
+        TSharedPtr<FJsonObject> Frame = MakeShared<FJsonObject>();
+        Frame->SetStringField(TEXT("type"), TEXT("notification"));
+        Frame->SetStringField(TEXT("topic"), TopicToString(Topic));
+        Frame->SetNumberField(TEXT("sequence"), static_cast<double>(Queue.NextSequence++));
+        Frame->SetBoolField(TEXT("overflow"), Queue.bOverflow);
+        Frame->SetArrayField(TEXT("events"), EventsArray);
+        Frame->SetNumberField(TEXT("pending"), Queue.Events.Num());
+
+        FString FrameString;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&FrameString);
+        FJsonSerializer::Serialize(Frame.ToSharedRef(), Writer);
+        OutFrames.Add(MoveTemp(FrameString));
+
+        Queue.bOverflow = false;
+        Queue.LastSentSeconds = Now;
+    }
+}
+
+bool FUnrealMCPEventSubscriptions::IsActive(EMCPEventTopic Topic) const
+{
+    return (ActiveTopics.load(std::memory_order_relaxed) & static_cast<uint8>(Topic)) != 0;
+}
+
+void FUnrealMCPEventSubscriptions::RefreshActiveTopics()
+{
+    EMCPEventTopic Union = EMCPEventTopic::None;
+    for (const TPair<int32, FSession>& Pair : Sessions)
+    {
+        Union |= Pair.Value.Topics;
+    }
+    ActiveTopics.store(static_cast<uint8>(Union), std::memory_order_relaxed);
+}
+
+void FUnrealMCPEventSubscriptions::MergeEvent(FTopicQueue& Queue, const FString& Key, const FPendingEvent& Event)
+{
+    FPendingEvent* Existing = Queue.Events.Find(Key);
+    if (!Existing)
+    {
+        Queue.Order.Add(Key);
+        Queue.Events.Add(Key, Event);
+        return;
+    }
+
+    if (Existing->Type == TEXT("added"))
+    {
+        // Created and destroyed between two frames: the client never needs to hear about it
+        if (Event.Type == TEXT("removed"))
+        {
+            Queue.Events.Remove(Key);
+            return;
+        }
+        const FString AddedType = Existing->Type;
+        *Existing = Event;
+        Existing->Type = AddedType;
+        return;
+    }
+
+    // A move is a kind of modification; keep the broader type
+    if (Existing->Type == TEXT("modified") && Event.Type == TEXT("moved"))
+    {
+        Existing->Name = Event.Name;
+        return;
+    }
+
+    *Existing = Event;
+}
+
+void FUnrealMCPEventSubscriptions::Enqueue(EMCPEventTopic Topic, const FString& Key, const FPendingEvent& Event)
+{
+    FScopeLock Lock(&Mutex);
+    const int32 Index = TopicIndex(Topic);
+    for (TPair<int32, FSession>& Pair : Sessions)
+    {
+        FSession& Session = Pair.Value;
+        if (!EnumHasAnyFlags(Session.Topics, Topic))
+        {
+            continue;
+        }
+
+        if (Session.PathPrefixes.Num() > 0 && !Session.PathPrefixes.ContainsByPredicate(
+            [&Event](const FString& Prefix) { return Event.Path.StartsWith(Prefix); }))
+        {
+            continue;
+        }
+
+        FTopicQueue& Queue = Session.Queues[Index];
+        if (Queue.bOverflow)
+        {
+            continue;
+        }
+        if (Queue.Events.Num() >= MaxQueuedEventsPerTopic && !Queue.Events.Contains(Key))
+        {
+            Queue.Order.Reset();
+            Queue.Events.Reset();
+            Queue.bOverflow = true;
+            continue;
+        }
+        MergeEvent(Queue, Key, Event);
+    }
+}
+
+void FUnrealMCPEventSubscriptions::EnqueueAsset(const FString& Type, const FString& ObjectPath, const FString& ClassName, const FString& OldPath)
+{
+    const bool bAssets = IsActive(EMCPEventTopic::Assets);
+    const bool bDialogue = IsActive(EMCPEventTopic::Dialogue) && IsDialogueClass(ClassName);
+    if (!bAssets && !bDialogue)
+    {
+        return;
+    }
+
+    FPendingEvent Event;
+    Event.Type = Type;
+    Event.Name = FPackageName::ObjectPathToObjectName(ObjectPath);
+    Event.Path = ObjectPath;
+    Event.Class = ClassName;
+    Event.OldPath = OldPath;
+
+    if (bAssets)
+    {
+        Enqueue(EMCPEventTopic::Assets, ObjectPath, Event);
+    }
+    if (bDialogue)
+    {
+        Enqueue(EMCPEventTopic::Dialogue, ObjectPath, Event);
+    }
+}
+
+void FUnrealMCPEventSubscriptions::HandleLevelChange(const FMCPLevelChange& Change)
+{
+    if (!IsActive(EMCPEventTopic::Actors))
+    {
+        return;
+    }
+
+    FPendingEvent Event;
+    Event.Type = FUnrealMCPLevelChangeFeed::ChangeTypeToString(Change.Type);
+    Event.Name = Change.Name;
+    Event.Path = Change.Path;
+    if (const AActor* Actor = Change.Actor.Get())
+    {
+        Event.Class = Actor->GetClass()->GetName();
+    }
+    Enqueue(EMCPEventTopic::Actors, Change.Path, Event);
+}
+
+void FUnrealMCPEventSubscriptions::HandleLevelResync()
+{
+    if (!IsActive(EMCPEventTopic::Actors))
+    {
+        return;
+    }
+
+    // Queued actor deltas are meaningless after a map change or undo; replace them with one resync
+    FScopeLock Lock(&Mutex);
+    FPendingEvent Event;
+    Event.Type = TEXT("resync");
+    for (TPair<int32, FSession>& Pair : Sessions)
+    {
+        if (EnumHasAnyFlags(Pair.Value.Topics, EMCPEventTopic::Actors))
+        {
+            FTopicQueue& Queue = Pair.Value.Queues[TopicIndex(EMCPEventTopic::Actors)];
+            Queue.Order.Reset();
+            Queue.Events.Reset();
+            Queue.bOverflow = false;
+            MergeEvent(Queue, FString(), Event);
+        }
+    }
+}
+
+void FUnrealMCPEventSubscriptions::HandleAssetAdded(const FAssetData& AssetData)
+{
+    // The initial registry scan reports every asset in the project as added
+    const IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        return;
+    }
+    EnqueueAsset(TEXT("added"), AssetData.GetObjectPathString(), AssetData.AssetClassPath.GetAssetName().ToString());
+}
+
+void FUnrealMCPEventSubscriptions::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    EnqueueAsset(TEXT("removed"), AssetData.GetObjectPathString(), AssetData.AssetClassPath.GetAssetName().ToString());
+}
+
+void FUnrealMCPEventSubscriptions::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    EnqueueAsset(TEXT("renamed"), AssetData.GetObjectPathString(), AssetData.AssetClassPath.GetAssetName().ToString(), OldObjectPath);
+}
+
+void FUnrealMCPEventSubscriptions::HandlePackageSaved(const FString& /*PackageFileName*/, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    if (!Package || SaveContext.IsProceduralSave())
+    {
+        return;
+    }
+
+    if (const UObject* Asset = Package->FindAssetInPackage())
+    {
+        EnqueueAsset(TEXT("saved"), Asset->GetPathName(), Asset->GetClass()->GetName());
+    }
+}
+
+void FUnrealMCPEventSubscriptions::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& /*Event*/)
+{
+    if (!Object || !IsActive(EMCPEventTopic::Assets | EMCPEventTopic::Dialogue))
+    {
+        return;
+    }
+
+    // Actors and their components are reported by the actors topic
+    UPackage* Package = Object->GetPackage();
+    if (!Package || Package == GetTransientPackage() || Package->ContainsMap())
+    {
+        return;
+    }
+
+    if (const UObject* Asset = Package->FindAssetInPackage())
+    {
+        EnqueueAsset(TEXT("modified"), Asset->GetPathName(), Asset->GetClass()->GetName());
+    }
+}
+
+void FUnrealMCPEventSubscriptions::HandleBlueprintPreCompile(UBlueprint* Blueprint)
+{
+    if (Blueprint && IsActive(EMCPEventTopic::Blueprints))
+    {
+        CompilingBlueprints.AddUnique(Blueprint);
+    }
+}
+
+void FUnrealMCPEventSubscriptions::HandleBlueprintCompiled()
+{
+    // OnBlueprintCompiled carries no blueprint; report the batch collected since the pre-compile events
+    TArray<TWeakObjectPtr<UBlueprint>> Compiled = MoveTemp(CompilingBlueprints);
+    CompilingBlueprints.Reset();
+    if (!IsActive(EMCPEventTopic::Blueprints))
+    {
+        return;
+    }
+
+    for (const TWeakObjectPtr<UBlueprint>& WeakBlueprint : Compiled)
+    {
+        const UBlueprint* Blueprint = WeakBlueprint.Get();
+        if (!Blueprint)
+        {
+            continue;
+        }
+
+        FPendingEvent Event;
+        Event.Type = TEXT("compiled");
+        Event.Name = Blueprint->GetName();
+        Event.Path = Blueprint->GetPathName();
+        Event.Class = Blueprint->GetClass()->GetName();
+        Event.Status = BlueprintStatusToString(Blueprint->Status);
+        Enqueue(EMCPEventTopic::Blueprints, Event.Path, Event);
+    }
+}
@@ -0,0 +1,159 @@
+#include "UnrealMCPTrafficRecorder.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+// Bumped whenever the record layout changes; the replay script checks it.
+const int32 TrafficLogFormatVersion = 1;
+}
+
+FUnrealMCPTrafficRecorder::FUnrealMCPTrafficRecorder()
+    : RecordingStartSeconds(0.0)
+    , RecordedCount(0)
+    , bIncludeResponses(false)
+{
+}
+
+FUnrealMCPTrafficRecorder::~FUnrealMCPTrafficRecorder()
+{
+    Stop();
+}
+
+bool FUnrealMCPTrafficRecorder::Start(const FString& InFilePath, bool bInIncludeResponses, FString& OutError)
+{
+    FScopeLock Lock(&Mutex);
+
+    if (Writer.IsValid())
+    {
+        OutError = FString::Printf(TEXT("Traffic recording already active: %s"), *FilePath);
+        return false;
+    }
+
+    FString NewPath = InFilePath;
+    if (NewPath.IsEmpty())
+    {
+        NewPath = FPaths::ProjectSavedDir() / TEXT("UnrealMCP") / TEXT("Traffic") /
+            FString::Printf(TEXT("traffic_%s.jsonl"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+    }
+    NewPath = FPaths::ConvertRelativePathToFull(NewPath);
+
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(NewPath), true);
+    FArchive* NewWriter = IFileManager::Get().CreateFileWriter(*NewPath, FILEWRITE_Append | FILEWRITE_AllowRead);
+    if (!NewWriter)
+    {
+        OutError = FString::Printf(TEXT("Failed to open traffic log for writing: %s"), *NewPath);
+        return false;
+    }
+
+    Writer.Reset(NewWriter);
+    FilePath = NewPath;
+    RecordingStartSeconds = FPlatformTime::Seconds();
+    RecordedCount = 0;
+    bIncludeResponses = bInIncludeResponses;
+
+    // Each recording segment starts with a header line so one file can hold several runs.
+    TSharedRef<FJsonObject> Header = MakeShared<FJsonObject>();
+    Header->SetStringField(TEXT("format"), TEXT("unrealmcp-traffic"));
+    Header->SetNumberField(TEXT("version"), TrafficLogFormatVersion);
+    Header->SetStringField(TEXT("started_utc"), FDateTime::UtcNow().ToIso8601());
+    Header->SetBoolField(TEXT("include_responses"), bIncludeResponses);
+    WriteLine(Header);
+
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCPTrafficRecorder: Recording to %s"), *FilePath);
+    return true;
+}
+
+void FUnrealMCPTrafficRecorder::Stop()
+{
+    FScopeLock Lock(&Mutex);
+
+    if (!Writer.IsValid())
+    {
+        return;
+    }
+
+    Writer->Close();
+    Writer.Reset();
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCPTrafficRecorder: Stopped after %lld request(s): %s"), RecordedCount, *FilePath);
+}
+
+bool FUnrealMCPTrafficRecorder::IsRecording() const
+{
+    FScopeLock Lock(&Mutex);
+    return Writer.IsValid();
+}
+
+void FUnrealMCPTrafficRecorder::RecordRequest(
+    int32 SessionId,
+    const FString& CommandType,
+    const TSharedPtr<FJsonObject>& Params,
+    double RequestStartSeconds,
+    double QueueMs,
+    double ExecMs,
+    bool bSuccess,
+    const FString& Response,
+    int32 ResponseBytes)
+{
+    FScopeLock Lock(&Mutex);
+
+    if (!Writer.IsValid())
+    {
+        return;
+    }
+
+    TSharedRef<FJsonObject> Line = MakeShared<FJsonObject>();
+    Line->SetNumberField(TEXT("seq"), static_cast<double>(RecordedCount));
+    Line->SetNumberField(TEXT("t"), RequestStartSeconds - RecordingStartSeconds);
+    Line->SetNumberField(TEXT("session"), SessionId);
+    Line->SetStringField(TEXT("type"), CommandType);
+    Line->SetObjectField(TEXT("params"), Params.IsValid() ? Params : MakeShared<FJsonObject>());
+    Line->SetNumberField(TEXT("queue_ms"), QueueMs);
+    Line->SetNumberField(TEXT("exec_ms"), ExecMs);
+    Line->SetStringField(TEXT("status"), bSuccess ? TEXT("success") : TEXT("error"));
+    Line->SetNumberField(TEXT("response_bytes"), ResponseBytes);
+    if (bIncludeResponses)
+    {
+        Line->SetStringField(TEXT("response"), Response);
+    }
+
+    WriteLine(Line);
+    ++RecordedCount;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPTrafficRecorder::GetStatus() const
+{
+    FScopeLock Lock(&Mutex);
+
+    TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+    Status->SetBoolField(TEXT("recording"), Writer.IsValid());
+    if (Writer.IsValid())
+    {
+        Status->SetStringField(TEXT("path"), FilePath);
+        Status->SetNumberField(TEXT("recorded_count"), static_cast<double>(RecordedCount));
+        Status->SetNumberField(TEXT("elapsed_seconds"), FPlatformTime::Seconds() - RecordingStartSeconds);
+        Status->SetBoolField(TEXT("include_responses"), bIncludeResponses);
+    }
+    return Status;
+}
+
+void FUnrealMCPTrafficRecorder::WriteLine(const TSharedRef<FJsonObject>& Line)
+{
+    // Caller holds Mutex.
+    FString LineString;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&LineString);
+    FJsonSerializer::Serialize(Line, JsonWriter);
+    LineString.AppendChar(TEXT('\n'));
+
+    FTCHARToUTF8 Utf8(*LineString);
+    Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+    Writer->Flush();
+}
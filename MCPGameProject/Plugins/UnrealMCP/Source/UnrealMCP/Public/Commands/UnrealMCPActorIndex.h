@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/**
+ * Name / label -> actor lookup for the world the editor commands operate on.
+ *
+ * Replaces the GetAllActorsOfClass + GetName() scans in the actor handlers. The index is built
+ * lazily for the requested world and kept current through the level-actor added/deleted and
+ * label-changed delegates; map changes and level streaming mark it dirty so the next lookup
+ * rebuilds it. Hits are re-validated against the actor (an object Rename() fires no delegate),
+ * and name misses fall back to the per-level object hash, so a stale index never hides an actor.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPActorIndex
+{
+public:
+    static FUnrealMCPActorIndex& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /** Actor in World whose object name is Name, or nullptr. */
+    AActor* FindByName(UWorld* World, const FString& Name);
+
+    /**
+     * Actor in World whose editor label is Label, or nullptr. If several share the label the first
+     * indexed wins and bOutAmbiguous (when given) is set.
+     */
+    AActor* FindByLabel(UWorld* World, const FString& Label, bool* bOutAmbiguous = nullptr);
+
+    /**
+     * Object name first, then label: the lookup read-only commands use for their name params.
+     * Labels are neither unique nor stable, so editing commands resolve the exact name instead.
+     */
+    AActor* FindActor(UWorld* World, const FString& NameOrLabel);
+
+    /** Number of indexed actors in World. */
+    int32 Num(UWorld* World);
+
+    /** Force a full rebuild on the next lookup. */
+    void Invalidate();
+
+    /**
+     * Bumped whenever an actor is added, deleted or relabelled, or the level set changes.
+     * get_actors_in_level uses it as the snapshot token for its pages.
+     */
+    uint64 GetGeneration() const { return Generation; }
+
+private:
+    FUnrealMCPActorIndex();
+
+    void EnsureBuilt(UWorld* World);
+    void AddActor(AActor* Actor);
+    void RemoveActor(AActor* Actor);
+    void RemoveLabelEntry(AActor* Actor, const FString& Label);
+    bool IsIndexedWorld(const AActor* Actor) const;
+
+    void HandleLevelActorAdded(AActor* Actor);
+    void HandleLevelActorDeleted(AActor* Actor);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleLevelChanged(ULevel* Level, UWorld* World);
+
+    TWeakObjectPtr<UWorld> IndexedWorld;
+    uint64 Generation;
+    bool bDirty;
+    bool bInitialized;
+
+    TMap<FName, TWeakObjectPtr<AActor>> ActorsByName;
+    TMap<FString, TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>> ActorsByLabel;
+    // Label each actor was indexed under, so a label change can drop the old entry
+    TMap<TWeakObjectPtr<AActor>, FString> IndexedLabels;
+
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorListChangedHandle;
+    FDelegateHandle ActorLabelChangedHandle;
+    FDelegateHandle MapChangeHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+};
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/** Fields selectable through the "fields" param of actor query commands. */
+enum class EMCPActorFields : uint32
+{
+    None     = 0,
+    Name     = 1 << 0,
+    Label    = 1 << 1,
+    Class    = 1 << 2,
+    Path     = 1 << 3,
+    Location = 1 << 4,
+    Rotation = 1 << 5,
+    Scale    = 1 << 6,
+    Bounds   = 1 << 7,
+    Folder   = 1 << 8,
+    Level    = 1 << 9,
+    Tags     = 1 << 10,
+
+    // Same shape get_actors_in_level has always returned
+    Default  = Name | Class | Location | Rotation | Scale,
+};
+ENUM_CLASS_FLAGS(EMCPActorFields);
+
+/** Result shape selected by the "layout" param. */
+enum class EMCPActorLayout : uint8
+{
+    /** "actors": one JSON object per actor */
+    Rows,
+    /** "columns": one value per field holding every actor */
+    Columnar,
+};
+
+/** How numeric columns are written, selected by the "encoding" param. */
+enum class EMCPColumnEncoding : uint8
+{
+    /** Little-endian float32 (uint32 for indices), base64 encoded */
+    Base64,
+    /** Flat JSON number arrays */
+    Array,
+};
+
+struct FMCPActorLayout
+{
+    EMCPActorLayout Layout = EMCPActorLayout::Rows;
+    EMCPColumnEncoding Encoding = EMCPColumnEncoding::Base64;
+};
+
+/**
+ * Accumulates actors into the columnar result layout without building a JSON object per actor.
+ * Text fields become a single '\n'-separated string, class becomes an index into a class table,
+ * and vector fields become packed xyz triples, so the DOM for N actors is a fixed handful of nodes
+ * (Base64) or one node per number (Array) instead of ~15 allocations per actor.
+ */
+class UNREALMCP_API FMCPActorColumnWriter
+{
+public:
+    FMCPActorColumnWriter(EMCPActorFields InFields, EMCPColumnEncoding InEncoding, int32 ExpectedCount = 0);
+
+    void Add(const AActor* Actor);
+
+    /** Extra per-actor numeric column (e.g. distance); must hold one value per added actor. */
+    void AddNumberColumn(const FString& Name, TArray<double> Values);
+
+    int32 Num() const { return Count; }
+
+    /** Sets "layout", "encoding" and "columns" on Result. */
+    void WriteTo(FJsonObject& Result) const;
+
+private:
+    EMCPActorFields Fields;
+    EMCPColumnEncoding Encoding;
+    int32 Count;
+
+    FString Names;
+    FString Labels;
+    FString Paths;
+    FString Folders;
+    FString Levels;
+    TArray<TSharedPtr<FJsonValue>> Tags;
+    TArray<FString> ClassTable;
+    TMap<const UClass*, uint32> ClassIndices;
+    TArray<uint32> Classes;
+    TArray<double> Locations;
+    TArray<double> Rotations;
+    TArray<double> Scales;
+    TArray<double> Bounds;
+    TArray<TPair<FString, TArray<double>>> ExtraColumns;
+};
+
+/** Server-side actor filter shared by the actor query commands. Empty members match everything. */
+struct UNREALMCP_API FMCPActorFilter
+{
+    /** Matches this class and its subclasses. */
+    UClass* Class = nullptr;
+    FName Tag;
+    /** Outliner folder; matches the folder and everything below it. */
+    FString Folder;
+    /** Only actors in this level (resolved from the "level" param). */
+    ULevel* Level = nullptr;
+    /** Wildcard (* and ?) on the editor label, case-insensitive. */
+    FString LabelPattern;
+
+    bool Matches(const AActor* Actor) const;
+};
+
+/**
+ * Parameter parsing and result projection shared by the actor query commands
+ * (get_actors_in_level, the spatial queries, ...).
+ */
+class UNREALMCP_API FUnrealMCPActorQuery
+{
+public:
+    /**
+     * Reads the "class", "tag", "folder", "level" and "label" params. Returns false with OutError
+     * when the class or level cannot be resolved. World is used to resolve "level".
+     */
+    static bool ParseFilter(const TSharedPtr<FJsonObject>& Params, UWorld* World, FMCPActorFilter& OutFilter, FString& OutError);
+
+    /** Reads the "fields" param (array of field names); missing means Default. Returns false on unknown names. */
+    static bool ParseFields(const TSharedPtr<FJsonObject>& Params, EMCPActorFields& OutFields, FString& OutError);
+
+    /**
+     * Calls Visit for every actor in World that passes Filter. Walks only the filter's level when
+     * one is set, otherwise the world's per-class object hash for Filter.Class (a typed actor
+     * iterator), so class-filtered queries never touch unrelated actors.
+     */
+    static void ForEachActor(UWorld* World, const FMCPActorFilter& Filter, TFunctionRef<void(AActor*)> Visit);
+
+    /** Reads the "layout" ("rows" | "columnar") and "encoding" ("base64" | "array") params. */
+    static bool ParseLayout(const TSharedPtr<FJsonObject>& Params, FMCPActorLayout& OutLayout, FString& OutError);
+
+    /** Actor as a JSON object holding only the requested fields. */
+    static TSharedPtr<FJsonObject> ActorToJson(const AActor* Actor, EMCPActorFields Fields);
+
+    /** Level in World by package path (/Game/Maps/Sub) or short name (Sub); "persistent" is the persistent level. */
+    static ULevel* ResolveLevel(UWorld* World, const FString& LevelName);
+
+    /** Actor class from a short name (StaticMeshActor, BP_Door_C, BP_Door) or a full class path. */
+    static UClass* ResolveActorClass(const FString& ClassName);
+
+    /** Param keys consumed by ParseFilter / ParseFields / ParseLayout, for CheckUnknownParams. */
+    static const TSet<FString>& GetQueryParamKeys();
+};
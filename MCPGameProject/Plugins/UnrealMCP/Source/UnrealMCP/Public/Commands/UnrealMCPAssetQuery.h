@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/TopLevelAssetPath.h"
+
+/** One asset-registry tag/value predicate of query_assets. */
+struct UNREALMCP_API FMCPAssetTagPredicate
+{
+    enum class EOp : uint8
+    {
+        Equal,
+        NotEqual,
+        Contains,
+        Glob,
+        Exists,
+        Missing,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+    };
+
+    FName Key;
+    EOp Op = EOp::Equal;
+    FString Value;
+
+    /** Evaluated on the registry's tag map only; the asset is never loaded. */
+    bool Matches(const FAssetData& Asset) const;
+};
+
+enum class EMCPAssetSort : uint8
+{
+    Name,
+    Path,
+    Class,
+};
+
+/** Parsed query_assets request, minus paging. */
+struct UNREALMCP_API FMCPAssetQuery
+{
+    TArray<FName> PackagePaths;
+    bool bRecursivePaths = true;
+    TArray<FTopLevelAssetPath> ClassPaths;
+    bool bRecursiveClasses = true;
+    bool bOnDiskOnly = false;
+    /** Wildcard (* and ?) on the asset name, case-insensitive. */
+    FString NamePattern;
+    TArray<FMCPAssetTagPredicate> Tags;
+    EMCPAssetSort Sort = EMCPAssetSort::Name;
+    bool bDescending = false;
+
+    /** Canonical text of everything that affects the match set and its order. */
+    FString GetCacheKey() const;
+};
+
+/** Matches of one query in result order. Key is the keyset cursor value of each entry. */
+struct FMCPAssetQueryResult
+{
+    struct FEntry
+    {
+        FAssetData Asset;
+        FString Key;
+    };
+
+    TArray<FEntry> Entries;
+    bool bDescending = false;
+    /** Registry generation the result was computed at. */
+    uint64 Generation = 0;
+
+    /** Index of the first entry after the one whose key is Cursor (0 for an empty cursor). */
+    int32 IndexAfter(const FString& Cursor) const;
+};
+
+/**
+ * Asset registry query engine behind query_assets (and find_assets' class lookup).
+ *
+ * A query is turned into one FARFilter (paths, classes) and the remaining predicates (name
+ * wildcard, tag/value) run over the returned FAssetData, so no package is ever loaded. The sorted
+ * match list is cached per query in a small LRU; any asset added/removed/renamed/updated event
+ * bumps the generation and drops the cache, so repeated browsing queries and paging over large
+ * projects only pay for the registry walk once. Class names resolve through FUnrealMCPClassIndex
+ * and are cached as class paths.
+ *
+ * Results computed while the registry is still discovering assets are returned but not cached.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPAssetQuery
+{
+public:
+    static FUnrealMCPAssetQuery& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /**
+     * Class path for a short name ("StaticMesh"), a full path ("/Script/Engine.StaticMesh") or a
+     * blueprint generated class path. Successful lookups are cached.
+     */
+    bool ResolveClassPath(const FString& ClassName, FTopLevelAssetPath& OutClassPath);
+
+    /**
+     * Reads paths/path, recursive, classes/class, recursive_classes, name, tags, sort, descending
+     * and on_disk_only. Returns false with OutError on an unknown class, tag operator or sort key.
+     */
+    bool ParseQuery(const TSharedPtr<FJsonObject>& Params, FMCPAssetQuery& OutQuery, FString& OutError);
+
+    /** Sorted matches of Query, from the cache when possible. */
+    TSharedRef<const FMCPAssetQueryResult> Run(const FMCPAssetQuery& Query, bool bUseCache, bool& bOutCacheHit);
+
+    /** Bumped on every asset registry add/remove/rename/update. */
+    uint64 GetGeneration() const { return Generation; }
+
+    /** True while the registry is still scanning; results may be incomplete. */
+    static bool IsRegistryLoading();
+
+    /** Param keys consumed by ParseQuery, for CheckUnknownParams. */
+    static const TSet<FString>& GetQueryParamKeys();
+
+private:
+    FUnrealMCPAssetQuery();
+
+    void Invalidate();
+    void HandleAssetChanged(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TMap<FString, FTopLevelAssetPath> ClassPathCache;
+    TMap<FString, TSharedRef<const FMCPAssetQueryResult>> ResultCache;
+    // Cache keys, least recently used first
+    TArray<FString> ResultLru;
+    int32 CachedEntryCount;
+    uint64 Generation;
+    bool bInitialized;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+    FDelegateHandle FilesLoadedHandle;
+};
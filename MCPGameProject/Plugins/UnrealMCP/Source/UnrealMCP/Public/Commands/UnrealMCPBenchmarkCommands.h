@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UnrealMCPCommandMeta.h"
+
+/**
+ * Handler class for benchmark fixture generators.
+ * Each command builds a large, deterministic (seeded) fixture in a single call so perf
+ * suites do not pay per-item MCP round trips: actors are spawned under one transaction,
+ * and generated blueprint / widget graphs are compiled once at the end.
+ */
+class UNREALMCP_API FUnrealMCPBenchmarkCommands
+{
+public:
+    FUnrealMCPBenchmarkCommands();
+
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+    static TArray<FMCPCommandMeta> GetCommandMetadata();
+
+private:
+    TSharedPtr<FJsonObject> HandleGenerateBenchmarkActors(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGenerateBenchmarkBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGenerateBenchmarkWidgetTree(const TSharedPtr<FJsonObject>& Params);
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+struct FAssetData;
+
+/**
+ * Blueprint name -> asset resolution behind FUnrealMCPCommonUtils::FindBlueprintByName.
+ *
+ * The old lookup tried up to eight LoadAsset candidate paths and then walked every Blueprint (and
+ * every map) in the asset registry comparing names, on nearly every command. This index maps asset
+ * short names to object paths, built once from the registry and kept current through its
+ * added/removed/renamed events, and remembers each resolved blueprint through a weak pointer, so a
+ * repeat lookup is a hash hit and a first lookup loads at most the asset it resolves to.
+ *
+ * Resolution order is unchanged: a short name or a relative path ("Characters/BP_Hero") is tried
+ * under /Game/Blueprints, /Game/Widgets, /Game/Maps and /Game first; a short name then matches any
+ * Blueprint, then the level blueprint of a map under /Game. When several assets share a short name
+ * outside those folders the pick is deterministic (lowest object path) and reported as ambiguous.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPBlueprintIndex
+{
+public:
+    static FUnrealMCPBlueprintIndex& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /**
+     * Blueprint for a short name ("BP_Door"), package path, object path or generated class path
+     * ("..._C"); map names resolve to their level blueprint. nullptr when nothing matches.
+     */
+    UBlueprint* FindBlueprint(const FString& NameOrPath);
+
+    /**
+     * Indexed assets FindBlueprint would try for NameOrPath, best first, without loading anything.
+     * bOutAmbiguous is set when more than one asset matches and no exact path or preferred folder decides.
+     */
+    void GetCandidates(const FString& NameOrPath, TArray<FSoftObjectPath>& OutCandidates, bool& bOutAmbiguous);
+
+    /** Number of indexed Blueprint and map assets. */
+    int32 Num();
+
+    /** Drop the index and resolved blueprints; the next lookup rebuilds from the registry. */
+    void Invalidate();
+
+private:
+    struct FEntry
+    {
+        FSoftObjectPath Path;
+        bool bWorld = false;
+    };
+
+    FUnrealMCPBlueprintIndex();
+
+    void EnsureBuilt();
+    void AddAsset(const FAssetData& AssetData);
+    void RemoveAsset(const FSoftObjectPath& Path);
+    void CollectCandidates(const FString& Key, TArray<FSoftObjectPath>& OutExact, TArray<FSoftObjectPath>& OutByName, bool& bOutAmbiguous);
+
+    void HandleAssetAdded(const FAssetData& AssetData);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    // Lower-cased asset name -> every indexed asset with that name
+    TMap<FString, TArray<FEntry, TInlineAllocator<1>>> EntriesByName;
+    // Lower-cased lookup key -> blueprint it resolved to
+    TMap<FString, TWeakObjectPtr<UBlueprint>> Resolved;
+    // Ambiguous keys already logged, so a hot name warns once
+    TSet<FString> ReportedAmbiguous;
+    int32 NumEntries;
+    bool bBuilt;
+    bool bInitialized;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+
+/**
+ * Class name -> UClass lookup shared by every command that takes a class by name.
+ *
+ * Handlers used to resolve class names each their own way: FindObject with ANY_PACKAGE (which
+ * needs a full path in UE5), UClass::TryFindTypeSlow, or a TObjectIterator<UClass> walk building
+ * two strings per class. This index maps lower-cased class names over native and blueprint
+ * generated classes, built in one pass on first use. Input may carry the C++ prefix
+ * ("UGameplayStatics", "AStaticMeshActor") and blueprint classes are found with or without "_C".
+ *
+ * Module loads and hot reloads mark the index dirty (rebuilt on the next lookup); compiled
+ * blueprints are added as they compile, and a miss falls back to FName-hashed FindFirstObject
+ * lookups whose hits are added, so a stale index never hides a class. Skeleton, reinstanced and
+ * superseded classes are never returned.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPClassIndex
+{
+public:
+    static FUnrealMCPClassIndex& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /**
+     * Class for a short name ("StaticMeshActor", "AStaticMeshActor", "BP_Door", "BP_Door_C") or a
+     * path ("/Script/Engine.StaticMeshActor", "/Game/BP/BP_Door.BP_Door_C", loaded if needed).
+     * When RequiredBase is set only subclasses of it match. Native classes win over blueprint
+     * classes of the same name. nullptr when nothing matches.
+     */
+    UClass* FindClass(const FString& ClassName, const UClass* RequiredBase = nullptr);
+
+    /** Number of indexed classes (builds the index if needed). */
+    int32 Num();
+
+    /** Force a full rebuild on the next lookup. */
+    void Invalidate();
+
+private:
+    FUnrealMCPClassIndex();
+
+    void EnsureBuilt();
+    void AddClass(UClass* Class);
+    UClass* FindIndexed(const FString& Key, const UClass* RequiredBase);
+    UClass* FindUnindexed(const FString& Name, const UClass* RequiredBase);
+
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleBlueprintPreCompile(UBlueprint* Blueprint);
+    void HandleBlueprintCompiled();
+
+    // Lower-cased class name (and, for blueprint classes, the name without "_C") -> classes
+    TMap<FString, TArray<TWeakObjectPtr<UClass>, TInlineAllocator<1>>> ClassesByName;
+    // Blueprints between pre-compile and compiled; their generated classes are indexed afterwards
+    TArray<TWeakObjectPtr<UBlueprint>> CompilingBlueprints;
+    int32 NumClasses;
+    bool bDirty;
+    bool bInitialized;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle BlueprintPreCompileHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
@@ -21,6 +21,9 @@ public:
 
 	/** Return metadata for all commands this handler supports (for the help system). */
 	virtual TArray<FMCPCommandMeta> GetCommandMetadata() const { return {}; }
+
+	/** Read-only commands that load the asset they read; the bridge tracks those loads (FUnrealMCPReadLoads). */
+	virtual bool IsAssetReadCommand(const FString& CommandType) const { return false; }
 };
 
 class UNREALMCP_API FUnrealMCPCommandRegistry
@@ -23,14 +23,28 @@ private:
     // Actor manipulation commands
     TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetLevelChanges(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSpawnActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDeleteActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSetActorTransforms(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleGetActorProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetActorProperty(const TSharedPtr<FJsonObject>& Params);
 
+    // Spatial queries (FUnrealMCPSpatialIndex)
+    TSharedPtr<FJsonObject> HandleFindActorsInBox(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleFindActorsInSphere(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleFindActorsInFrustum(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleFindNearestActors(const TSharedPtr<FJsonObject>& Params);
+
+    // World Partition descriptor queries (FUnrealMCPWorldPartitionActors)
+    TSharedPtr<FJsonObject> HandleFindWorldPartitionActors(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleLoadWorldPartitionActors(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleReleaseWorldPartitionActors(const TSharedPtr<FJsonObject>& Params);
+
     // Blueprint actor spawning
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSpawnActors(const TSharedPtr<FJsonObject>& Params);
 
     // Editor viewport commands
     TSharedPtr<FJsonObject> HandleFocusViewport(const TSharedPtr<FJsonObject>& Params);
@@ -48,4 +62,6 @@ private:
     // Asset introspection commands
     TSharedPtr<FJsonObject> HandleGetDataAsset(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindAssets(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleQueryAssets(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetAssetsBulk(const TSharedPtr<FJsonObject>& Params);
 };
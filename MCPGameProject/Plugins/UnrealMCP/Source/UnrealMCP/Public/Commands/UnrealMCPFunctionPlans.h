@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+struct FMCPPropertyPlan;
+
+/** Precomputed calling convention of one UFunction: parameter layout, converters and return serializers. */
+struct UNREALMCP_API FMCPFunctionPlan
+{
+    struct FParam
+    {
+        FProperty* Property = nullptr;
+        FString Name;
+        // Input converter; null on the return value
+        TSharedPtr<const FMCPPropertyPlan> Plan;
+        bool bNeedsInit = false;
+        bool bNeedsDestroy = false;
+        // Output serializer: object references keep the name (+ actor details) form, the rest go through FJsonObjectConverter
+        bool bObjectResult = false;
+    };
+
+    TWeakObjectPtr<UClass> Class;
+    TWeakObjectPtr<UFunction> Function;
+    int32 ParmsSize = 0;
+    int32 MinAlignment = 1;
+    // Every parameter, for buffer init/destroy; Inputs and Outputs index into it
+    TArray<FParam> Params;
+    TArray<int32> Inputs;
+    TArray<int32> Outputs;
+
+    /**
+     * Call the function on Target with Arguments (parameter name -> JSON value; missing ones stay
+     * default) and write the return value and out parameters to OutResult.
+     */
+    bool Invoke(UObject* Target, const TSharedPtr<FJsonObject>& Arguments, const TSharedRef<FJsonObject>& OutResult, FString& OutErrorMessage) const;
+};
+
+/**
+ * Per-(class, function) invocation plans behind call_subsystem_function.
+ *
+ * Each call used to find the UFunction, zero a parameter buffer and walk the parameters through an
+ * IsA<> ladder both ways (covering only strings, ints, floats and bools). A plan keeps the function,
+ * its buffer size, which parameters need construction and destruction, a property setter plan per
+ * input and the serializer per output, so a call in an agent's loop is a map hit, the conversions and
+ * ProcessEvent. Inputs accept everything FUnrealMCPPropertyPlans can write (enums, names, vectors,
+ * structs, object paths).
+ *
+ * Plans are dropped with the layouts they point into: those of non-native classes on blueprint
+ * pre-compile, all of them on hot reload or module load.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPFunctionPlans
+{
+public:
+    static FUnrealMCPFunctionPlans& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /** Plan for FunctionName on Class (or a super class); null when there is no such function. */
+    TSharedPtr<const FMCPFunctionPlan> FindPlan(UClass* Class, FName FunctionName);
+
+    /** Number of cached plans. */
+    int32 Num() const;
+
+    /** Drop every plan. */
+    void Invalidate();
+
+private:
+    FUnrealMCPFunctionPlans();
+
+    static void BuildPlan(UClass* Class, UFunction* Function, FMCPFunctionPlan& OutPlan);
+
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleBlueprintPreCompile(UBlueprint* Blueprint);
+
+    TMap<TPair<const UClass*, FName>, TSharedPtr<const FMCPFunctionPlan>> Plans;
+    bool bInitialized;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle BlueprintPreCompileHandle;
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+struct FPropertyChangedEvent;
+
+enum class EMCPLevelChangeType : uint8
+{
+    Added,
+    Removed,
+    Moved,
+    Modified,
+};
+
+/** One entry of the change log. Name and path are captured at record time so removals stay readable. */
+struct FMCPLevelChange
+{
+    uint64 Revision = 0;
+    EMCPLevelChangeType Type = EMCPLevelChangeType::Modified;
+    FObjectKey ActorKey;
+    TWeakObjectPtr<AActor> Actor;
+    FString Name;
+    FString Path;
+};
+
+/** Fired after a change is stored or coalesced; the argument is the resulting log entry. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMCPLevelChangeRecorded, const FMCPLevelChange&);
+
+/**
+ * Bounded log of actor changes in the editor world, behind get_level_changes.
+ *
+ * Every recorded change bumps a monotonically increasing world revision. Repeated changes of
+ * the same kind to the same actor (a gizmo drag firing OnActorMoved every frame) collapse into
+ * the newest log entry. When the log exceeds its capacity the oldest quarter is dropped; a
+ * client whose revision predates the dropped range, or predates a map change / undo / level
+ * streaming event (which cannot be expressed as per-actor deltas), is told to resync.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPLevelChangeFeed
+{
+public:
+    static FUnrealMCPLevelChangeFeed& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /** Max log entries kept (default 10000, -MCPChangeLogSize=). */
+    void SetCapacity(int32 InCapacity);
+    int32 GetCapacity() const { return Capacity; }
+
+    /** Revision of the newest change. */
+    uint64 GetRevision() const { return Revision; }
+
+    /** Changes before this revision are unavailable; SinceRevision < this means resync. */
+    uint64 GetOldestResumableRevision() const { return ResyncRevision; }
+
+    /** Random per editor session; a client holding another epoch must resync. */
+    const FString& GetEpoch() const { return Epoch; }
+
+    /** For edits made without an editor event (MCP transform and property commands). */
+    void RecordChange(AActor* Actor, EMCPLevelChangeType Type);
+
+    /**
+     * Appends up to MaxEntries log entries newer than SinceRevision to OutChanges, oldest first.
+     * Returns false, leaving OutChanges empty, when SinceRevision predates the resumable range.
+     */
+    bool GetChangesSince(uint64 SinceRevision, int32 MaxEntries, TArray<FMCPLevelChange>& OutChanges, bool& bOutHasMore) const;
+
+    static const TCHAR* ChangeTypeToString(EMCPLevelChangeType Type);
+
+    /** Change notifications for the event subscriptions; broadcast on the game thread. */
+    FOnMCPLevelChangeRecorded& OnChangeRecorded() { return ChangeRecordedEvent; }
+
+    /** Broadcast when the log is reset and per-actor deltas no longer describe the world. */
+    FSimpleMulticastDelegate& OnResyncRequired() { return ResyncRequiredEvent; }
+
+private:
+    FUnrealMCPLevelChangeFeed();
+
+    bool IsTrackedWorld(const AActor* Actor) const;
+    void RequireResync();
+
+    void HandleActorAdded(AActor* Actor);
+    void HandleActorDeleted(AActor* Actor);
+    void HandleActorMoved(AActor* Actor);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+    void HandleLevelChanged(ULevel* Level, UWorld* World);
+
+    TArray<FMCPLevelChange> Log;
+    int32 Capacity;
+    uint64 Revision;
+    uint64 ResyncRevision;
+    FString Epoch;
+    bool bInitialized;
+
+    FOnMCPLevelChangeRecorded ChangeRecordedEvent;
+    FSimpleMulticastDelegate ResyncRequiredEvent;
+
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle ActorListChangedHandle;
+    FDelegateHandle ActorLabelChangedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle MapChangeHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+};
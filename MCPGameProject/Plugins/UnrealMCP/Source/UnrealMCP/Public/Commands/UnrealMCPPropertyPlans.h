@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+
+/** How a plan writes a JSON value into property memory; picked once when the plan is built. */
+enum class EMCPPropertySetter : uint8
+{
+    Bool,
+    Integer,
+    Float,
+    String,
+    Name,
+    Text,
+    Enum,
+    LinearColor,
+    Vector,
+    Rotator,
+    // Anything else, through FJsonObjectConverter (other structs, containers, object paths)
+    Json
+};
+
+/** Resolved setter for one property of one class. */
+struct UNREALMCP_API FMCPPropertyPlan
+{
+    TWeakObjectPtr<const UStruct> Owner;
+    FProperty* Property = nullptr;
+    // Property the Integer, Float and Enum setters write (an FEnumProperty's underlying property)
+    FNumericProperty* NumericProperty = nullptr;
+    UEnum* Enum = nullptr;
+    // Lower-cased short ("player0") and qualified ("eautoreceiveinput::player0") enumerator names
+    TMap<FString, int64> EnumValues;
+    EMCPPropertySetter Setter = EMCPPropertySetter::Json;
+
+    /** Convert Value and write it to the property value at ValuePtr. */
+    bool Apply(void* ValuePtr, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage) const;
+
+    /** Convert Value and write it to the property inside Container (an object or struct instance). */
+    bool ApplyInContainer(void* Container, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage) const;
+};
+
+/** Where a property path led. */
+struct FMCPPropertyPathTarget
+{
+    // Leaf property plan; null when the path ends on an object ("Subobject:Mesh")
+    TSharedPtr<const FMCPPropertyPlan> Plan;
+    // Leaf value memory
+    void* ValuePtr = nullptr;
+    // Innermost object the path went through: the one to Modify()/PostEditChange() around a write
+    UObject* Object = nullptr;
+};
+
+/**
+ * Per-(class, property) setter plans and the property path resolver behind
+ * FUnrealMCPCommonUtils::SetObjectProperty, set_component_property and the property reads.
+ *
+ * Every write used to look the property up by name and walk an IsA<> ladder to pick a conversion,
+ * building enum lookups from the UEnum each time. A plan does that once per class and property:
+ * it keeps the FProperty, the setter for its type and, for enums, a name -> value table, so
+ * repeated writes (batch edits over many actors or blueprints) are a map hit and one conversion.
+ *
+ * Paths are '.'-separated segments walked from a root object: a property name, optionally indexed
+ * ("Points[3]" on arrays, "Stats[Health]" on maps), or "Subobject:Name" for a default subobject,
+ * inner object or blueprint component template. Struct properties are entered in place and object
+ * properties are followed to the object they reference, so "Mesh.BodyInstance.MassScale" and
+ * "Subobject:Interaction.Abilities[0].Tag" both work; a component variable that is None on a
+ * blueprint CDO resolves to its construction script template. Each named step is a plan lookup.
+ *
+ * Plans point into class layouts, so they are dropped when those change: every plan of a blueprint
+ * generated class on blueprint pre-compile, and every plan on hot reload or module load. Native
+ * class plans otherwise live for the session.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPPropertyPlans
+{
+public:
+    static FUnrealMCPPropertyPlans& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /** Plan for the property named PropertyName on Struct (or a super struct); null when there is no such property. */
+    TSharedPtr<const FMCPPropertyPlan> FindPlan(const UStruct* Struct, FName PropertyName);
+
+    /** Plan for a property reached through a container (array element, map value). */
+    TSharedPtr<const FMCPPropertyPlan> FindPlan(FProperty* Property);
+
+    /**
+     * Resolve Path from Root. With bForWrite, object references are only followed into objects in
+     * Root's package (subobjects, component and widget templates), never into other assets.
+     */
+    bool ResolvePath(UObject* Root, const FString& Path, bool bForWrite, FMCPPropertyPathTarget& OutTarget, FString& OutErrorMessage);
+
+    /** Serialize only the value Path points at (an object's properties when it ends on an object). */
+    TSharedPtr<FJsonValue> ReadPath(UObject* Root, const FString& Path, int64 SkipFlags, FString& OutErrorMessage);
+
+    /** True when Name is a path ("A.B", "A[0]", "Subobject:A") rather than a plain property name. */
+    static bool IsPropertyPath(const FString& Name);
+
+    /** Set a property (or property path) on Object from JSON. OutErrorMessage is filled on failure. */
+    bool SetProperty(UObject* Object, const FString& PropertyName, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+
+    /** Number of cached plans. */
+    int32 Num() const;
+
+    /** Drop every plan. */
+    void Invalidate();
+
+private:
+    FUnrealMCPPropertyPlans();
+
+    static void BuildPlan(const UStruct* Owner, FProperty* Property, FMCPPropertyPlan& OutPlan);
+
+    void InvalidateBlueprintClasses();
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleBlueprintPreCompile(UBlueprint* Blueprint);
+
+    // (struct, property name) -> plan; the struct pointer is checked against the plan's weak Owner on use
+    TMap<TPair<const UStruct*, FName>, TSharedPtr<const FMCPPropertyPlan>> Plans;
+    // Container element and value properties -> plan, checked the same way against their owner struct
+    TMap<const FProperty*, TSharedPtr<const FMCPPropertyPlan>> ElementPlans;
+    bool bInitialized;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle BlueprintPreCompileHandle;
+};
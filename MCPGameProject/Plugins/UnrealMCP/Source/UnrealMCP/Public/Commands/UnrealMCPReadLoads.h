@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UPackage;
+
+/**
+ * Packages that read-only commands pulled into memory, released again under an LRU and byte budget.
+ *
+ * Reads (get_data_asset, get_assets_bulk, get_blueprint_graph_info, get_montage_info, the dialogue
+ * reads, ...) load their asset, and the editor keeps that RF_Standalone package resident for the
+ * rest of the session. The bridge opens a read scope only around an allow-list of read commands
+ * that load assets (IsAssetReadCommand on extension handlers). Inside it, the call sites that load
+ * the requested asset report it through TrackRead: only a package that was not resident before the
+ * request is tracked, with its exclusive resource size. Unrelated loads that finish meanwhile (other
+ * async requests, editor streaming) are never attributed to the read. Repeat reads Touch the
+ * package so recently read packages are kept longest.
+ *
+ * When a scope closes and the tracked set is over max_packages or max_bytes, the least recently
+ * read packages are released: RF_Standalone is cleared on their objects and an incremental GC is
+ * requested for the next engine tick. A package that became dirty, has an asset editor open, or
+ * lost its Standalone flag to someone else is no longer ours and is dropped from tracking instead.
+ * A released package that something started referencing in the meantime simply survives the GC.
+ *
+ * The budget comes from -MCPReadLoadMaxPackages=<n> / -MCPReadLoadBudgetMB=<mb> or
+ * set_read_load_policy; get_read_load_stats reports it.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPReadLoads
+{
+public:
+    static FUnrealMCPReadLoads& Get();
+
+    void Initialize();
+    void Shutdown();
+
+    /** Accept TrackRead until the matching EndReadScope. Scopes nest. */
+    void BeginReadScope();
+
+    /** Close a read scope; the outermost one tracks its reads and enforces the budget. */
+    void EndReadScope();
+
+    /** True when the package holding Path (package or object path) is in memory. Call before loading. */
+    static bool IsResident(const FString& Path);
+
+    /**
+     * Object was loaded for the open read scope. Its package is tracked when the scope closes unless
+     * it was resident before the request (bWasResident, from IsResident); outside a scope this only Touches.
+     */
+    void TrackRead(const UObject* Object, bool bWasResident);
+
+    /** An async load a read requested finished after the read returned: tracked now, budget enforced. */
+    void TrackLateRead(const UObject* Object);
+
+    /** Mark the package of Object as just read (no-op when it is not tracked). */
+    void Touch(const UObject* Object);
+
+    /** Update the policy and enforce it. Negative values leave a setting unchanged. */
+    void SetPolicy(int32 InMaxPackages, int64 InMaxBytes, bool bInEnabled);
+
+    bool IsEnabled() const { return bEnabled; }
+
+    /** Release every tracked package now. */
+    void ReleaseAll();
+
+    /** Policy, tracked count and bytes, release counters and the largest tracked packages. */
+    TSharedPtr<FJsonObject> GetStats() const;
+
+private:
+    FUnrealMCPReadLoads();
+
+    struct FTrackedPackage
+    {
+        TWeakObjectPtr<UPackage> Package;
+        int64 Bytes = 0;
+        double LastReadSeconds = 0.0;
+    };
+
+    void TrackScopeLoads();
+    void Enforce(bool bReleaseAll);
+
+    static bool IsTrackable(const UPackage* Package);
+    static bool IsStillOurs(const UPackage* Package);
+    static int64 MeasurePackage(const UPackage* Package);
+    static void ReleasePackage(UPackage* Package);
+
+    TMap<FName, FTrackedPackage> Tracked;
+    // Packages the open scope's reads loaded, measured and tracked when it closes
+    TArray<TWeakObjectPtr<UPackage>> ScopeLoads;
+    // Released but not yet collected; pruned as they go
+    TArray<TWeakObjectPtr<UPackage>> Released;
+    int64 TrackedBytes;
+    int64 ReleasedBytes;
+    int32 ReleasedCount;
+    int32 DroppedCount;
+    int32 GCRequests;
+    int32 ScopeDepth;
+
+    int32 MaxPackages;
+    int64 MaxBytes;
+    bool bEnabled;
+    bool bInitialized;
+};
+
+/** Read scope for the lifetime of the object; does nothing when bActive is false. */
+struct FMCPReadLoadScope
+{
+    explicit FMCPReadLoadScope(bool bInActive)
+        : bActive(bInActive)
+    {
+        if (bActive)
+        {
+            FUnrealMCPReadLoads::Get().BeginReadScope();
+        }
+    }
+
+    ~FMCPReadLoadScope()
+    {
+        if (bActive)
+        {
+            FUnrealMCPReadLoads::Get().EndReadScope();
+        }
+    }
+
+    FMCPReadLoadScope(const FMCPReadLoadScope&) = delete;
+    FMCPReadLoadScope& operator=(const FMCPReadLoadScope&) = delete;
+
+private:
+    bool bActive;
+};
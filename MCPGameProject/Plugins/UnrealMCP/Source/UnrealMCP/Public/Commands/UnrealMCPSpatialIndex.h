@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+class FMCPActorOctree;
+struct FConvexVolume;
+struct FPropertyChangedEvent;
+
+/**
+ * Octree of actor bounds for the spatial query commands (find_actors_in_box, ..._sphere,
+ * ..._frustum, find_nearest_actors).
+ *
+ * Built lazily for the requested world on the first query. After that it is updated
+ * incrementally: actor added/deleted/moved and property-change events only queue the actor,
+ * and queued actors are re-bounded at the start of the next query, so editor edits cost a set
+ * insert rather than an octree update each. Node and element culling use TOctree2's vectorized
+ * FBoxCenterAndExtent tests. Map changes, undo/redo and level streaming force a full rebuild.
+ *
+ * Actors moved by code that fires no editor event should be reported with MarkActorDirty
+ * (the MCP transform commands do this).
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPSpatialIndex
+{
+public:
+    /** Called per matching actor with its indexed world-space bounds. */
+    using FVisitFunc = TFunctionRef<void(AActor* Actor, const FBox& Bounds)>;
+
+    static FUnrealMCPSpatialIndex& Get();
+    ~FUnrealMCPSpatialIndex();
+
+    void Initialize();
+    void Shutdown();
+
+    /** Re-read Actor's bounds before the next query. */
+    void MarkActorDirty(AActor* Actor);
+
+    /** Throw the octree away; the next query rebuilds it. */
+    void Invalidate();
+
+    /** Actors whose bounds intersect Box. */
+    void QueryBox(UWorld* World, const FBox& Box, FVisitFunc Visit);
+
+    /** Actors whose bounds intersect the sphere. */
+    void QuerySphere(UWorld* World, const FVector& Center, double Radius, FVisitFunc Visit);
+
+    /** Actors whose bounds intersect Volume. BroadPhase must enclose the volume (e.g. the frustum corners). */
+    void QueryConvex(UWorld* World, const FConvexVolume& Volume, const FBox& BroadPhase, FVisitFunc Visit);
+
+    /**
+     * Up to Count actors accepted by Filter, closest first by distance from Point to their bounds
+     * (0 when Point is inside). MaxDistance <= 0 means unbounded.
+     */
+    void QueryNearest(UWorld* World, const FVector& Point, int32 Count, double MaxDistance,
+        TFunctionRef<bool(AActor*)> Filter, TArray<TPair<AActor*, double>>& OutActors);
+
+    /** Number of actors in the octree for World (after applying pending updates). */
+    int32 Num(UWorld* World);
+
+private:
+    FUnrealMCPSpatialIndex();
+
+    void EnsureUpToDate(UWorld* World);
+    void AddActor(AActor* Actor);
+    void RemoveActor(const FObjectKey& ActorKey);
+
+    void HandleActorChanged(AActor* Actor);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+    void HandleLevelChanged(ULevel* Level, UWorld* World);
+
+    TUniquePtr<FMCPActorOctree> Octree;
+    TWeakObjectPtr<UWorld> IndexedWorld;
+    TSet<FObjectKey> PendingActors;
+    bool bInitialized;
+
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle ActorListChangedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle MapChangeHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+};
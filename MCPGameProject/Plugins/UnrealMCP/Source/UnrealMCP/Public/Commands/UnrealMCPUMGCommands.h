@@ -129,6 +129,20 @@ private:
      */
     TSharedPtr<FJsonObject> HandleSetWidgetCommonPropertiesBatch(const TSharedPtr<FJsonObject>& Params);
 
+    /**
+     * Read one property path from a widget in a WidgetBlueprint widget tree
+     * @param Params - Must include "blueprint_name", "widget_name", "property_path"
+     * @return JSON response with the value at the path
+     */
+    TSharedPtr<FJsonObject> HandleGetWidgetProperty(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Set one property path on a widget in a WidgetBlueprint widget tree, then compile and save
+     * @param Params - Must include "blueprint_name", "widget_name", "property_path", "property_value"
+     * @return JSON response with the value read back
+     */
+    TSharedPtr<FJsonObject> HandleSetWidgetProperty(const TSharedPtr<FJsonObject>& Params);
+
     /**
      * Set common TextBlock properties useful for debug UI automation
      * @param Params - Must include "blueprint_name", "widget_name"
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Misc/Guid.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "WorldPartition/WorldPartitionHandle.h"
+
+class AActor;
+class UWorld;
+class UWorldPartition;
+class FWorldPartitionActorDescInstance;
+
+/** Descriptor-level filter for find_world_partition_actors. Empty members match everything. */
+struct UNREALMCP_API FMCPActorDescFilter
+{
+    /** Matches this class and its subclasses (blueprint classes match by exact base class). */
+    UClass* Class = nullptr;
+    /** Wildcard (* and ?) on the actor name or label, case-insensitive. */
+    FString NamePattern;
+    /** Editor bounds must intersect this box. */
+    TOptional<FBox> Bounds;
+    /** When set, the actor must belong to one of these data layer instances (see ResolveDataLayer). */
+    TOptional<TSet<FName>> DataLayerInstances;
+    /** Only loaded (true) or only unloaded (false) actors. */
+    TOptional<bool> bLoaded;
+
+    bool Matches(const FWorldPartitionActorDescInstance& Desc) const;
+};
+
+/**
+ * Actor queries on World Partition maps answered from the actor descriptors, which the editor
+ * keeps in memory for every actor whether or not its cell is loaded. GetAllActorsOfClass and the
+ * actor index only see loaded actors, and loading regions just to inspect them is slow and
+ * memory hungry; the descriptors carry class, name, label, bounds and data layers already.
+ *
+ * Actors are loaded one at a time, only when a caller needs the UObject: commands that mutate an
+ * actor by name resolve unloaded ones through ResolveForEdit, and load_world_partition_actors
+ * loads explicitly. Loaded actors are pinned (an FWorldPartitionReference) until released or the
+ * world is torn down, so an edit is not lost to the editor unloading the region.
+ *
+ * Game thread only. Initialize/Shutdown are driven by the bridge subsystem.
+ */
+class UNREALMCP_API FUnrealMCPWorldPartitionActors
+{
+public:
+    static FUnrealMCPWorldPartitionActors& Get();
+    ~FUnrealMCPWorldPartitionActors();
+
+    void Initialize();
+    void Shutdown();
+
+    /** World's partition, or nullptr for non-partitioned maps. */
+    static UWorldPartition* GetWorldPartition(UWorld* World);
+
+    /** Calls Visit for every descriptor in World's partition that passes Filter; stops when Visit returns false. */
+    static void ForEachActorDesc(UWorld* World, const FMCPActorDescFilter& Filter, TFunctionRef<bool(const FWorldPartitionActorDescInstance&)> Visit);
+
+    /**
+     * Data layer instance names in World matching Name, which may be the instance name, the short
+     * name shown in the Data Layers outliner, or the data layer asset path. False when none match.
+     */
+    static bool ResolveDataLayer(UWorld* World, const FString& Name, TSet<FName>& OutInstanceNames);
+
+    /** Descriptor summary: guid, name, label, class, package, bounds, data layers, loaded, spatially_loaded, runtime_grid. */
+    static TSharedPtr<FJsonObject> ActorDescToJson(const FWorldPartitionActorDescInstance& Desc);
+
+    /** Loads (if needed) and pins the actor with ActorGuid. Returns nullptr when no such descriptor exists or loading failed. */
+    AActor* LoadActor(UWorld* World, const FGuid& ActorGuid);
+
+    /**
+     * Unloaded actor whose object name, package path or actor GUID is NameOrGuid: loaded and pinned.
+     * Labels are never matched, so an edit cannot land on a lookalike. nullptr on non-partitioned maps
+     * or when no descriptor matches; nullptr with OutError set when several descriptors share the name.
+     * Callers try the loaded actors (FUnrealMCPActorIndex) first.
+     */
+    AActor* ResolveForEdit(UWorld* World, const FString& NameOrGuid, FString& OutError);
+
+    /** Error for a name several descriptors match, listing each candidate's GUID and package path. */
+    static FString AmbiguousMatchError(const FString& Name, const TArray<const FWorldPartitionActorDescInstance*>& Candidates);
+
+    /**
+     * Drops the pins on Guids (all pins when empty). Actors with unsaved changes stay pinned and are
+     * reported in OutKeptDirty, so releasing never discards an edit.
+     */
+    void Release(const TArray<FGuid>& Guids, TArray<FGuid>& OutReleased, TArray<FGuid>& OutKeptDirty);
+
+    int32 NumPinned() const { return Pinned.Num(); }
+
+private:
+    FUnrealMCPWorldPartitionActors();
+
+    void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+    TMap<FGuid, FWorldPartitionReference> Pinned;
+    TWeakObjectPtr<UWorld> PinnedWorld;
+    bool bInitialized;
+
+    FDelegateHandle WorldCleanupHandle;
+};
@@ -23,12 +23,42 @@ public:
 	virtual void Exit() override;
 
 protected:
+	// One accepted connection; its session id scopes event subscriptions and traffic recording
+	struct FMCPClientConnection
+	{
+		TSharedPtr<FSocket> Socket;
+		int32 SessionId = 0;
+		// Bytes of a request that has not parsed as complete JSON yet
+		FString MessageBuffer;
+	};
+
+	// Accepts every queued connection into Clients. True when one was accepted.
+	bool AcceptPendingClients();
+
+	// Pushes due notifications, reads what the client sent and answers a complete request.
+	// False when the client disconnected or a send failed; the caller then closes it.
+	bool ServiceClient(FMCPClientConnection& Client, bool& bOutActivity);
+
+	// Ends the client's session and closes its socket
+	void CloseClient(FMCPClientConnection& Client);
+
 	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
 	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
 
+	// Sends the whole UTF-8 encoding of Message, retrying partial sends. Fails when the client
+	// accepts nothing for SendStallTimeoutSeconds or the server is stopping; the caller then drops the session.
+	bool SendString(FSocket& Socket, int32 SessionId, const FString& Message);
+
+	// Pushes the client's due subscription notification frames; only called between responses. False when a send failed.
+	bool SendPendingNotifications(FMCPClientConnection& Client);
+
 private:
 	UUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
+	// Open connections, all polled from the server thread
+	TArray<FMCPClientConnection> Clients;
 	bool bRunning;
+
+	// Incremented per accepted connection; tags requests for traffic recording
+	int32 NextSessionId;
 }; 
\ No newline at end of file
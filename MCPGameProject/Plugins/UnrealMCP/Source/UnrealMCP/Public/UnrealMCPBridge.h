@@ -15,6 +15,11 @@
 #include "Commands/UnrealMCPUMGCommands.h"
 #include "Commands/UnrealMCPBehaviorTreeCommands.h"
 #include "Commands/UnrealMCPAnimationCommands.h"
+#include "Commands/UnrealMCPBenchmarkCommands.h"
+#include "UnrealMCPTrafficRecorder.h"
+#include "UnrealMCPCommandStats.h"
+#include "UnrealMCPCommandWatchdog.h"
+#include "UnrealMCPEventSubscriptions.h"
 #include "UnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
@@ -43,8 +48,14 @@ public:
 	void StopServer();
 	bool IsRunning() const { return bIsRunning; }
 
-	// Command execution
-	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	// Command execution. SessionId identifies the client connection (0 = unknown).
+	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 SessionId = 0);
+
+	// Server thread: notification frames due for SessionId's subscriptions
+	void CollectNotifications(int32 SessionId, TArray<FString>& OutFrames);
+
+	// Server thread: SessionId's connection closed
+	void EndSession(int32 SessionId);
 
 private:
 	// Server state
@@ -65,4 +76,17 @@ private:
 	TSharedPtr<FUnrealMCPUMGCommands> UMGCommands;
 	TSharedPtr<FUnrealMCPBehaviorTreeCommands> BehaviorTreeCommands;
 	TSharedPtr<FUnrealMCPAnimationCommands> AnimationCommands;
+	TSharedPtr<FUnrealMCPBenchmarkCommands> BenchmarkCommands;
+
+	// Optional request log for record-and-replay investigations
+	TSharedPtr<FUnrealMCPTrafficRecorder> TrafficRecorder;
+
+	// Per-command timing / allocation accounting (get_mcp_stats)
+	TSharedPtr<FUnrealMCPCommandStats> CommandStats;
+
+	// Times out commands stuck on the game thread so the server thread never blocks forever
+	TSharedPtr<FUnrealMCPCommandWatchdog> CommandWatchdog;
+
+	// Per-session topic subscriptions whose events the server thread pushes between responses
+	TSharedPtr<FUnrealMCPEventSubscriptions> EventSubscriptions;
 };
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Json.h"
+
+/** Memory counters captured around one command. */
+struct FMCPAllocSnapshot
+{
+    // Bytes currently held under the UnrealMCP LLM tag; only when running with -llm
+    int64 LLMBytes = 0;
+    bool bHasLLM = false;
+    uint64 UsedPhysical = 0;
+    uint64 PeakUsedPhysical = 0;
+};
+
+/**
+ * Per-command execution statistics reported by get_mcp_stats.
+ *
+ * Timing and response size are always collected. Memory accounting is opt-in
+ * (-MCPAllocStats or reset_mcp_stats with alloc_tracking=true): each command is bracketed
+ * by FPlatformMemory::GetStats() snapshots and, when the editor runs with -llm, by the
+ * total of the UnrealMCP LLM tag every handler runs under. The LLM delta is what the
+ * handler left allocated (net, not gross); working-set deltas include other threads.
+ *
+ * Thread-safe: commands are recorded from the server thread, queries come from the game thread.
+ */
+class UNREALMCP_API FUnrealMCPCommandStats
+{
+public:
+    FUnrealMCPCommandStats();
+
+    /** Turn memory accounting on/off. */
+    void SetAllocationTracking(bool bEnable);
+    bool IsAllocationTracking() const;
+
+    /** Memory counters now. */
+    static FMCPAllocSnapshot CaptureAllocSnapshot();
+
+    void RecordCommand(
+        const FString& CommandType,
+        double QueueMs,
+        double ExecMs,
+        bool bSuccess,
+        int32 ResponseBytes,
+        const FMCPAllocSnapshot* AllocStart,
+        const FMCPAllocSnapshot* AllocEnd);
+
+    void Reset();
+
+    /** CommandFilter limits output to one command; SortBy is calls | exec_ms | memory_bytes | response_bytes. */
+    TSharedPtr<FJsonObject> ToJson(const FString& CommandFilter, const FString& SortBy) const;
+
+private:
+    struct FCommandEntry
+    {
+        int64 Calls = 0;
+        int64 Errors = 0;
+        double TotalExecMs = 0.0;
+        double MaxExecMs = 0.0;
+        double TotalQueueMs = 0.0;
+        int64 TotalResponseBytes = 0;
+        int32 MaxResponseBytes = 0;
+        int64 AllocTrackedCalls = 0;
+        int64 TotalWorkingSetDeltaBytes = 0;
+        int64 MaxWorkingSetDeltaBytes = 0;
+        uint64 MaxPeakWorkingSetDeltaBytes = 0;
+        int64 LLMTrackedCalls = 0;
+        int64 TotalLLMBytes = 0;
+        int64 MaxLLMBytes = 0;
+    };
+
+    mutable FCriticalSection Mutex;
+    TMap<FString, FCommandEntry> Entries;
+    double WindowStartSeconds;
+    bool bAllocationTracking;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Json.h"
+
+/**
+ * Detects commands that hold the game thread longer than a timeout.
+ *
+ * The server thread waits for each command with the configured timeout instead of blocking
+ * forever. When the timeout expires the watchdog captures the game-thread callstack, logs it
+ * together with the command's params, and builds the timeout error that is returned to the
+ * client. Until the stuck handler finally returns, further commands are rejected immediately
+ * with a game_thread_busy error instead of queueing behind it, so the server keeps answering.
+ *
+ * The timeout comes from -MCPCommandTimeout=<seconds> or set_mcp_watchdog. It is off (0) by default:
+ * a timed-out command keeps running, so a timeout shorter than a legitimate bulk command turns it
+ * into a command_timeout plus game_thread_busy for everything after it.
+ * Thread-safe: BeginCommand/ReportTimeout run on the server thread, EndCommand on the game thread.
+ */
+class UNREALMCP_API FUnrealMCPCommandWatchdog
+{
+public:
+    FUnrealMCPCommandWatchdog();
+
+    void SetTimeoutSeconds(double InTimeoutSeconds);
+    double GetTimeoutSeconds() const;
+
+    /** Register a command that is about to be queued on the game thread. Returns its ticket. */
+    uint64 BeginCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 SessionId);
+
+    /** Game thread: the handler for Ticket returned. Logs the recovery if it had timed out. */
+    void EndCommand(uint64 Ticket);
+
+    /**
+     * Server thread: Ticket exceeded the timeout. Captures diagnostics and returns the error response,
+     * or nullptr if the handler finished in the meantime (the caller should read its result instead).
+     */
+    TSharedPtr<FJsonObject> ReportTimeout(uint64 Ticket);
+
+    /** Error response for CommandType while a timed-out handler still holds the game thread; nullptr when not stuck. */
+    TSharedPtr<FJsonObject> MakeBusyResponse(const FString& CommandType) const;
+
+    /** Timeout setting, the stuck command (if any) and diagnostics of the last timeout. */
+    TSharedPtr<FJsonObject> GetStatus() const;
+
+private:
+    struct FInFlightCommand
+    {
+        uint64 Ticket = 0;
+        FString CommandType;
+        TSharedPtr<FJsonObject> Params;
+        int32 SessionId = 0;
+        double StartSeconds = 0.0;
+        bool bTimedOut = false;
+    };
+
+    // Plain copy of a timeout's diagnostics; JSON is built from it per call, so the server thread
+    // never serializes an object the game thread is still updating
+    struct FTimeoutInfo
+    {
+        FString CommandType;
+        int32 SessionId = 0;
+        double ElapsedMs = 0.0;
+        double TimeoutSeconds = 0.0;
+        FString ParamsJson;
+        TArray<FString> Callstack;
+        // Negative until the handler returns
+        double RecoveredAfterMs = -1.0;
+    };
+
+    static TArray<FString> CaptureGameThreadCallstack();
+    static TSharedPtr<FJsonObject> TimeoutInfoToJson(const FTimeoutInfo& Info);
+
+    mutable FCriticalSection Mutex;
+    double TimeoutSeconds;
+    uint64 NextTicket;
+    int32 TimeoutCount;
+    TOptional<FInFlightCommand> InFlight;
+    TOptional<FTimeoutInfo> LastTimeout;
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Json.h"
+#include <atomic>
+
+class UBlueprint;
+class UPackage;
+struct FAssetData;
+struct FMCPLevelChange;
+struct FPropertyChangedEvent;
+class FObjectPostSaveContext;
+
+enum class EMCPEventTopic : uint8
+{
+    None = 0,
+    Actors = 1 << 0,
+    Assets = 1 << 1,
+    Blueprints = 1 << 2,
+    Dialogue = 1 << 3,
+    All = Actors | Assets | Blueprints | Dialogue,
+};
+ENUM_CLASS_FLAGS(EMCPEventTopic);
+
+/**
+ * Per-session event subscriptions behind subscribe / unsubscribe / get_subscriptions.
+ *
+ * Editor events for subscribed topics are queued per session and coalesced by key (actor or
+ * asset path), so a gizmo drag or a burst of saves collapses into one entry per object. The
+ * server thread collects due notifications between requests and pushes them on the session's
+ * connection as {"type": "notification", ...} frames, at most one frame per topic per
+ * min_interval_ms. A queue that outgrows its bound is dropped and the next frame carries
+ * overflow=true, telling the client to re-query instead of trusting deltas.
+ *
+ * Topics:
+ *   actors     - editor-world actor added/removed/moved/modified (from the level change feed)
+ *   assets     - asset added/removed/renamed/saved/modified
+ *   blueprints - blueprint compile results with the resulting status
+ *   dialogue   - the asset events for classes whose name contains "Dialogue"
+ *                (the UnrealMCPDialogue extension's assets)
+ *
+ * Thread-safe: events are recorded on the game thread, subscriptions change and notifications
+ * are collected on the server thread.
+ */
+class UNREALMCP_API FUnrealMCPEventSubscriptions
+{
+public:
+    FUnrealMCPEventSubscriptions();
+    ~FUnrealMCPEventSubscriptions();
+
+    /** Game thread: bind the editor delegates. Driven by the bridge subsystem. */
+    void Initialize();
+    void Shutdown();
+
+    static bool ParseTopic(const FString& Name, EMCPEventTopic& OutTopic);
+    static const TCHAR* TopicToString(EMCPEventTopic Topic);
+
+    /**
+     * Add Topics to SessionId's subscription. PathPrefixes (when set) replace the session's path
+     * filter; MinIntervalSeconds < 0 keeps the current interval. Returns the session description.
+     */
+    TSharedPtr<FJsonObject> Subscribe(int32 SessionId, EMCPEventTopic Topics, const TArray<FString>* PathPrefixes, double MinIntervalSeconds);
+
+    /** Remove Topics from SessionId's subscription, discarding their queued events. */
+    TSharedPtr<FJsonObject> Unsubscribe(int32 SessionId, EMCPEventTopic Topics);
+
+    /** Topics, path filter, interval and queued event counts for SessionId. */
+    TSharedPtr<FJsonObject> Describe(int32 SessionId) const;
+
+    /** The session's connection closed. */
+    void EndSession(int32 SessionId);
+
+    /** Server thread: serialized notification frames due for SessionId, at most one per topic. */
+    void CollectDueNotifications(int32 SessionId, TArray<FString>& OutFrames);
+
+private:
+    struct FPendingEvent
+    {
+        FString Type;
+        FString Name;
+        FString Path;
+        FString Class;
+        FString OldPath;
+        FString Status;
+    };
+
+    struct FTopicQueue
+    {
+        // Keys in first-seen order; a key whose event was cancelled out is skipped on collection
+        TArray<FString> Order;
+        TMap<FString, FPendingEvent> Events;
+        double LastSentSeconds = 0.0;
+        uint64 NextSequence = 1;
+        bool bOverflow = false;
+    };
+
+    struct FSession
+    {
+        EMCPEventTopic Topics = EMCPEventTopic::None;
+        TArray<FString> PathPrefixes;
+        double MinIntervalSeconds = 0.0;
+        FTopicQueue Queues[4];
+    };
+
+    static int32 TopicIndex(EMCPEventTopic Topic);
+    static void MergeEvent(FTopicQueue& Queue, const FString& Key, const FPendingEvent& Event);
+
+    bool IsActive(EMCPEventTopic Topic) const;
+    void RefreshActiveTopics();
+    void Enqueue(EMCPEventTopic Topic, const FString& Key, const FPendingEvent& Event);
+    void EnqueueAsset(const FString& Type, const FString& ObjectPath, const FString& ClassName, const FString& OldPath = FString());
+    TSharedPtr<FJsonObject> DescribeLocked(int32 SessionId, const FSession* Session) const;
+
+    void HandleLevelChange(const FMCPLevelChange& Change);
+    void HandleLevelResync();
+    void HandleAssetAdded(const FAssetData& AssetData);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+    void HandleBlueprintPreCompile(UBlueprint* Blueprint);
+    void HandleBlueprintCompiled();
+
+    mutable FCriticalSection Mutex;
+    TMap<int32, FSession> Sessions;
+
+    // Union of all sessions' topics, so unsubscribed topics cost one atomic load per editor event
+    std::atomic<uint8> ActiveTopics;
+
+    // Game thread only: blueprints between pre-compile and the compiled broadcast
+    TArray<TWeakObjectPtr<UBlueprint>> CompilingBlueprints;
+    bool bInitialized;
+
+    FDelegateHandle LevelChangeHandle;
+    FDelegateHandle LevelResyncHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle BlueprintPreCompileHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Json.h"
+
+/**
+ * Append-only request log for reproducing slow agent runs.
+ * Every command that passes through UUnrealMCPBridge::ExecuteCommand is written as one
+ * JSON line (offset, session, command, params, queue/exec timing, status). The log is
+ * replayed against a fresh editor by Python/scripts/mcp_traffic_replay.py.
+ *
+ * Thread-safe: records are written from the server thread, start/stop/status come from
+ * the game thread.
+ */
+class UNREALMCP_API FUnrealMCPTrafficRecorder
+{
+public:
+    FUnrealMCPTrafficRecorder();
+    ~FUnrealMCPTrafficRecorder();
+
+    /** Open (or append to) a log file. An empty path picks Saved/UnrealMCP/Traffic/traffic_<timestamp>.jsonl. */
+    bool Start(const FString& InFilePath, bool bInIncludeResponses, FString& OutError);
+    void Stop();
+    bool IsRecording() const;
+
+    /** Append one request record; ResponseBytes is the UTF-8 length of Response. No-op when not recording. */
+    void RecordRequest(
+        int32 SessionId,
+        const FString& CommandType,
+        const TSharedPtr<FJsonObject>& Params,
+        double RequestStartSeconds,
+        double QueueMs,
+        double ExecMs,
+        bool bSuccess,
+        const FString& Response,
+        int32 ResponseBytes);
+
+    TSharedPtr<FJsonObject> GetStatus() const;
+
+private:
+    void WriteLine(const TSharedRef<FJsonObject>& Line);
+
+    mutable FCriticalSection Mutex;
+    TUniquePtr<FArchive> Writer;
+    FString FilePath;
+    double RecordingStartSeconds;
+    int64 RecordedCount;
+    bool bIncludeResponses;
+};
@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPDialogueCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPReadLoads.h"
 #include "EditorAssetLibrary.h"
 #include "AssetToolsModule.h"
 #include "IAssetTools.h"
@@ -24,6 +25,8 @@
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphSchema.h"
 #include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
 
 FUnrealMCPDialogueCommands::FUnrealMCPDialogueCommands()
 {
@@ -69,6 +72,8 @@ TSharedPtr<FJsonObject> FUnrealMCPDialogueCommands::HandleCommand(
 		return HandleListDialogueNodes(Params);
 	if (CommandType == TEXT("set_dialogue_node_speaker_id"))
 		return HandleSetDialogueNodeSpeakerId(Params);
+	if (CommandType == TEXT("generate_benchmark_dialogue"))
+		return HandleGenerateBenchmarkDialogue(Params);
 
 	return FUnrealMCPCommonUtils::CreateErrorResponse(
 		FString::Printf(TEXT("Unknown dialogue command: %s"), *CommandType));
@@ -77,6 +82,7 @@ TSharedPtr<FJsonObject> FUnrealMCPDialogueCommands::HandleCommand(
 UDialogueAsset* FUnrealMCPDialogueCommands::LoadDialogueAsset(
 	const FString& AssetPath, TSharedPtr<FJsonObject>& OutError)
 {
+	const bool bWasResident = FUnrealMCPReadLoads::IsResident(AssetPath);
 	UObject* LoadedObj = UEditorAssetLibrary::LoadAsset(AssetPath);
 	if (!LoadedObj)
 	{
@@ -92,6 +98,7 @@ UDialogueAsset* FUnrealMCPDialogueCommands::LoadDialogueAsset(
 				*AssetPath, *LoadedObj->GetClass()->GetName()));
 		return nullptr;
 	}
+	FUnrealMCPReadLoads::Get().TrackRead(Asset, bWasResident);
 	return Asset;
 }
 
@@ -1852,3 +1859,210 @@ TSharedPtr<FJsonObject> FUnrealMCPDialogueCommands::HandleSetDialogueNodeSpeaker
 	Result->SetBoolField(TEXT("written"), true);
 	return FUnrealMCPCommonUtils::CreateSuccessResponse(Result);
 }
+
+// =============================================================================
+// MCP-5: Benchmark fixtures
+//
+// `generate_benchmark_dialogue` builds a seeded dialogue asset with P nodes in one
+// call. Nodes are added without per-node graph notifications and the transition
+// compiler runs once at the end, so large fixtures do not pay the per-edit cost
+// of add_dialogue_node + connect_dialogue_nodes.
+// =============================================================================
+
+namespace DialogueBenchmark
+{
+	static constexpr int32 MaxNodes = 100000;
+	static constexpr int32 NodesPerRow = 20;
+	static constexpr int32 SpeakerPoolSize = 8;
+
+	/** First output pin matching PinName, else the first output pin. Avoids FindOutputPin's whole-graph scan. */
+	static UEdGraphPin* FindGraphNodeOutputPin(UEdGraphNode* GraphNode, const FName PinName)
+	{
+		UEdGraphPin* FirstOutput = nullptr;
+		for (UEdGraphPin* Pin : GraphNode->Pins)
+		{
+			if (Pin->Direction != EGPD_Output)
+			{
+				continue;
+			}
+			if (Pin->PinName == PinName)
+			{
+				return Pin;
+			}
+			if (!FirstOutput)
+			{
+				FirstOutput = Pin;
+			}
+		}
+		return FirstOutput;
+	}
+
+	static UEdGraphPin* FindGraphNodeInputPin(UEdGraphNode* GraphNode)
+	{
+		for (UEdGraphPin* Pin : GraphNode->Pins)
+		{
+			if (Pin->Direction == EGPD_Input)
+			{
+				return Pin;
+			}
+		}
+		return nullptr;
+	}
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPDialogueCommands::HandleGenerateBenchmarkDialogue(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	FString AssetPath;
+	if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'asset_path'"));
+	}
+
+	int32 NodeCount = 0;
+	if (!Params->TryGetNumberField(TEXT("node_count"), NodeCount))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'node_count'"));
+	}
+
+	if (auto Err = FUnrealMCPCommonUtils::CheckUnknownParams(Params,
+		{TEXT("asset_path"), TEXT("node_count"), TEXT("seed"), TEXT("choice_ratio"), TEXT("save")}))
+		return Err;
+
+	if (NodeCount < 1 || NodeCount > DialogueBenchmark::MaxNodes)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(
+			FString::Printf(TEXT("'node_count' must be between 1 and %d"), DialogueBenchmark::MaxNodes));
+	}
+
+	int32 Seed = 0;
+	Params->TryGetNumberField(TEXT("seed"), Seed);
+	double ChoiceRatio = 0.2;
+	Params->TryGetNumberField(TEXT("choice_ratio"), ChoiceRatio);
+	ChoiceRatio = FMath::Clamp(ChoiceRatio, 0.0, 1.0);
+	bool bSave = false;
+	Params->TryGetBoolField(TEXT("save"), bSave);
+
+#if WITH_EDITORONLY_DATA
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	TSharedPtr<FJsonObject> CreateParams = MakeShared<FJsonObject>();
+	CreateParams->SetStringField(TEXT("asset_path"), AssetPath);
+	TSharedPtr<FJsonObject> CreateResult = HandleCreateDialogueAsset(CreateParams);
+	bool bCreated = false;
+	if (!CreateResult.IsValid() || !CreateResult->TryGetBoolField(TEXT("success"), bCreated) || !bCreated)
+	{
+		return CreateResult;
+	}
+
+	TSharedPtr<FJsonObject> Error;
+	UDialogueAsset* Asset = LoadDialogueAsset(AssetPath, Error);
+	if (!Asset)
+	{
+		return Error;
+	}
+
+	UEdGraphNode* PrevGraphNode = nullptr;
+	for (UEdGraphNode* GN : Asset->EditorGraph->Nodes)
+	{
+		UDialogueGraphNode* DGN = Cast<UDialogueGraphNode>(GN);
+		if (DGN && Cast<UDialogueEntryNode>(DGN->RuntimeNode))
+		{
+			PrevGraphNode = DGN;
+			break;
+		}
+	}
+	if (!PrevGraphNode)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Entry graph node not found on the new asset"));
+	}
+	FName PrevPinName(TEXT("Out"));
+
+	FRandomStream Stream(Seed);
+	int32 SpeechCount = 0;
+	int32 ChoiceCount = 0;
+	int32 EdgeCount = 0;
+	Asset->AllNodes.Reserve(Asset->AllNodes.Num() + NodeCount);
+
+	// The last generated node is always an Exit so the chain is a complete conversation.
+	for (int32 Index = 0; Index < NodeCount; ++Index)
+	{
+		const bool bExit = Index == NodeCount - 1;
+		const bool bChoice = !bExit && Stream.GetFraction() < ChoiceRatio;
+		TSubclassOf<UStateGraphNode> NodeClass = bExit
+			? UDialogueExitNode::StaticClass()
+			: (bChoice ? UDialogueChoiceNode::StaticClass() : UDialogueSpeechNode::StaticClass());
+
+		const double PosX = 400.0 + (Index % DialogueBenchmark::NodesPerRow) * 350.0;
+		const double PosY = 100.0 + (Index / DialogueBenchmark::NodesPerRow) * 250.0;
+
+		UStateGraphNode* RuntimeNode = NewObject<UStateGraphNode>(Asset, NodeClass, NAME_None, RF_Transactional);
+		RuntimeNode->NodeId = FGuid::NewGuid();
+		RuntimeNode->NodePosition = FVector2D(PosX, PosY);
+
+		const FName SpeakerId(*FString::Printf(TEXT("Speaker_%d"), Stream.RandHelper(DialogueBenchmark::SpeakerPoolSize)));
+		const FText LineText = FText::FromString(FString::Printf(TEXT("Benchmark line %d"), Index));
+		if (UDialogueSpeechNode* Speech = Cast<UDialogueSpeechNode>(RuntimeNode))
+		{
+			Speech->AdhocSpeakerId = SpeakerId;
+			Speech->AdhocDialogueText = LineText;
+			++SpeechCount;
+		}
+		else if (UDialogueChoiceNode* Choice = Cast<UDialogueChoiceNode>(RuntimeNode))
+		{
+			Choice->AdhocSpeakerId = SpeakerId;
+			Choice->AdhocDialogueText = LineText;
+			UDialogueChoiceItemNode* Item = NewObject<UDialogueChoiceItemNode>(RuntimeNode, NAME_None, RF_Transactional);
+			Item->NodeId = FGuid::NewGuid();
+			Item->AdhocChoiceText = FText::FromString(FString::Printf(TEXT("Choice %d"), Index));
+			Choice->Items.Add(Item);
+			++ChoiceCount;
+		}
+
+		Asset->AllNodes.Add(RuntimeNode);
+
+		UDialogueGraphNode* GraphNode = NewObject<UDialogueGraphNode>(Asset->EditorGraph, NAME_None, RF_Transactional);
+		GraphNode->RuntimeNode = RuntimeNode;
+		GraphNode->CreateNewGuid();
+		GraphNode->PostPlacedNewNode();
+		GraphNode->NodePosX = PosX;
+		GraphNode->NodePosY = PosY;
+		Asset->EditorGraph->AddNode(GraphNode, false, false);
+		GraphNode->AllocateDefaultPins();
+
+		UEdGraphPin* OutPin = DialogueBenchmark::FindGraphNodeOutputPin(PrevGraphNode, PrevPinName);
+		UEdGraphPin* InPin = DialogueBenchmark::FindGraphNodeInputPin(GraphNode);
+		if (OutPin && InPin)
+		{
+			OutPin->MakeLinkTo(InPin);
+			++EdgeCount;
+		}
+
+		PrevGraphNode = GraphNode;
+		PrevPinName = bChoice ? FName(TEXT("Item_0")) : FName(TEXT("Out"));
+	}
+
+	// Single transition compile + notify for the whole fixture (see HandleConnectDialogueNodes).
+	FStateGraphTransitionCompiler::Compile(Asset, Asset->EditorGraph);
+	Asset->EditorGraph->NotifyGraphChanged();
+	Asset->MarkPackageDirty();
+	if (bSave)
+	{
+		UEditorAssetLibrary::SaveAsset(AssetPath, false);
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("asset_path"), AssetPath);
+	Result->SetStringField(TEXT("entry_node_id"), CreateResult->GetStringField(TEXT("entry_node_id")));
+	Result->SetNumberField(TEXT("node_count"), NodeCount);
+	Result->SetNumberField(TEXT("speech_count"), SpeechCount);
+	Result->SetNumberField(TEXT("choice_count"), ChoiceCount);
+	Result->SetNumberField(TEXT("edge_count"), EdgeCount);
+	Result->SetNumberField(TEXT("seed"), Seed);
+	Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+	return Result;
+#else
+	return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Write commands require editor build"));
+#endif
+}
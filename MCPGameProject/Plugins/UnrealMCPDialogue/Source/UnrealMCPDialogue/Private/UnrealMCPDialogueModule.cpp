@@ -36,7 +36,16 @@ namespace
 				CommandType == TEXT("dialogue_registry_info") ||
 				// MCP-4 Speaker migration commands
 				CommandType == TEXT("list_dialogue_nodes") ||
-				CommandType == TEXT("set_dialogue_node_speaker_id");
+				CommandType == TEXT("set_dialogue_node_speaker_id") ||
+				// MCP-5 Benchmark fixtures
+				CommandType == TEXT("generate_benchmark_dialogue");
+		}
+
+		virtual bool IsAssetReadCommand(const FString& CommandType) const override
+		{
+			return CommandType == TEXT("get_dialogue_graph") ||
+				CommandType == TEXT("get_dialogue_connections") ||
+				CommandType == TEXT("list_dialogue_nodes");
 		}
 
 		virtual TSharedPtr<FJsonObject> HandleCommand(
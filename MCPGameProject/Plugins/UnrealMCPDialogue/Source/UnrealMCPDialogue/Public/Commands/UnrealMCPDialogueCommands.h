@@ -14,6 +14,7 @@ class UEdGraphPin;
  *                connect_dialogue_nodes, disconnect_dialogue_nodes, delete_dialogue_node
  * MCP-3 (Line ID): bind_dialogue_node_line, unbind_dialogue_node_line,
  *                  query_dialogue_line, list_dialogue_lines, dialogue_registry_info
+ * MCP-5 (benchmark): generate_benchmark_dialogue
  */
 class UNREALMCPDIALOGUE_API FUnrealMCPDialogueCommands
 {
@@ -49,6 +50,9 @@ private:
 	TSharedPtr<FJsonObject> HandleListDialogueNodes(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> HandleSetDialogueNodeSpeakerId(const TSharedPtr<FJsonObject>& Params);
 
+	// MCP-5: Benchmark fixtures (seeded P-node dialogue, single transition compile)
+	TSharedPtr<FJsonObject> HandleGenerateBenchmarkDialogue(const TSharedPtr<FJsonObject>& Params);
+
 	UDialogueAsset* LoadDialogueAsset(const FString& AssetPath, TSharedPtr<FJsonObject>& OutError);
 	UStateGraphNode* FindNodeByGuid(UDialogueAsset* Asset, const FString& NodeIdStr);
 	UEdGraphPin* FindOutputPin(UDialogueAsset* Asset, UStateGraphNode* Node, const FString& PinName);
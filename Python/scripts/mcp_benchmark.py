@@ -0,0 +1,299 @@
+"""
+Run the UnrealMCP benchmark suite and write a JSON result file.
+
+The suite builds seeded fixtures with the generate_benchmark_* commands, then
+times a fixed set of read commands against them: every case is repeated
+--iterations times per run, and the whole suite is repeated --runs times so the
+comparator can judge run-to-run noise.
+
+Results are compared against a stored baseline with mcp_benchmark_compare.py.
+
+Usage examples:
+  # against an editor that is already running
+  python Python/scripts/mcp_benchmark.py --out bench_candidate.json
+
+  # start a headless editor, run, and shut it down again
+  python Python/scripts/mcp_benchmark.py --editor "C:/UE_5.5/Engine/Binaries/Win64/UnrealEditor.exe" \
+      --project MCPGameProject/MCPGameProject.uproject --out bench_candidate.json
+
+  python Python/scripts/mcp_benchmark_compare.py bench_baseline.json bench_candidate.json
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import platform
+import socket
+import statistics
+import subprocess
+import sys
+import time
+from datetime import datetime, timezone
+from pathlib import Path
+
+
+RESULT_FORMAT = "unrealmcp-benchmark"
+RESULT_VERSION = 1
+
+HEADLESS_EDITOR_ARGS = ("-nullrhi", "-unattended", "-nosplash", "-nosound", "-nopause", "-stdout")
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description="Run the UnrealMCP benchmark suite")
+    parser.add_argument("--out", required=True, help="Result JSON path")
+    parser.add_argument("--label", default="", help="Free-form label stored in the result (e.g. git sha)")
+    parser.add_argument("--runs", type=int, default=3, help="Full-suite repetitions (noise check needs >= 2)")
+    parser.add_argument("--iterations", type=int, default=10, help="Timed calls per case per run")
+    parser.add_argument("--warmup", type=int, default=2, help="Untimed calls per case before each run")
+    parser.add_argument("--seed", type=int, default=1234)
+    parser.add_argument("--actor-count", type=int, default=10000)
+    parser.add_argument("--blueprint-nodes", type=int, default=500)
+    parser.add_argument("--widget-depth", type=int, default=4)
+    parser.add_argument("--widget-fanout", type=int, default=4)
+    parser.add_argument("--no-alloc-stats", action="store_true",
+                        help="Skip per-case memory accounting (reset_mcp_stats / get_mcp_stats)")
+    parser.add_argument("--case", action="append", default=[], help="Only run cases whose name contains this (repeatable)")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=55557)
+    parser.add_argument("--timeout", type=float, default=300.0, help="Per-request socket timeout in seconds")
+    parser.add_argument("--editor", default="", help="Editor executable; when set a headless editor is launched for the run")
+    parser.add_argument("--project", default="", help=".uproject to open with --editor")
+    parser.add_argument("--editor-arg", action="append", default=[], help="Extra editor command-line argument (repeatable)")
+    parser.add_argument("--startup-timeout", type=float, default=900.0, help="Seconds to wait for the launched editor to answer ping")
+    return parser.parse_args()
+
+
+def send_unreal_command(host: str, port: int, timeout: float, command: str, params: dict) -> tuple[dict, float, int]:
+    """Returns (response, client latency ms, response size in bytes)."""
+    payload = json.dumps({"type": command, "params": params}).encode("utf-8")
+    start = time.perf_counter()
+    with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as sock:
+        sock.settimeout(timeout)
+        sock.connect((host, port))
+        sock.sendall(payload)
+        buf = b""
+        while True:
+            chunk = sock.recv(65536)
+            if not chunk:
+                break
+            buf += chunk
+            try:
+                response = json.loads(buf.decode("utf-8"))
+                return response, (time.perf_counter() - start) * 1000.0, len(buf)
+            except json.JSONDecodeError:
+                continue
+    if not buf:
+        raise RuntimeError(f"{command}: empty response")
+    return json.loads(buf.decode("utf-8")), (time.perf_counter() - start) * 1000.0, len(buf)
+
+
+def wait_for_editor(args: argparse.Namespace, proc: subprocess.Popen | None) -> None:
+    deadline = time.monotonic() + args.startup_timeout
+    while time.monotonic() < deadline:
+        if proc is not None and proc.poll() is not None:
+            raise RuntimeError(f"editor exited during startup (exit={proc.returncode})")
+        try:
+            response, _, _ = send_unreal_command(args.host, args.port, 5.0, "ping", {})
+            if response.get("status") == "success":
+                return
+        except OSError:
+            pass
+        time.sleep(2.0)
+    raise RuntimeError(f"editor did not answer ping within {args.startup_timeout:.0f}s")
+
+
+def launch_headless_editor(args: argparse.Namespace) -> subprocess.Popen:
+    if not args.project:
+        raise RuntimeError("--editor requires --project")
+    command = [args.editor, str(Path(args.project).resolve()), *HEADLESS_EDITOR_ARGS, *args.editor_arg]
+    print(f"launching: {' '.join(command)}", file=sys.stderr)
+    return subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+
+def shutdown_editor(args: argparse.Namespace, proc: subprocess.Popen) -> None:
+    try:
+        send_unreal_command(args.host, args.port, 10.0, "request_editor_exit", {"force": True})
+    except Exception as exc:
+        print(f"warning: request_editor_exit failed: {exc}", file=sys.stderr)
+    try:
+        proc.wait(timeout=120)
+    except subprocess.TimeoutExpired:
+        print("warning: editor did not exit in time; killing it", file=sys.stderr)
+        proc.kill()
+
+
+def checked(args: argparse.Namespace, command: str, params: dict) -> dict:
+    response, elapsed_ms, _ = send_unreal_command(args.host, args.port, args.timeout, command, params)
+    if response.get("status") != "success":
+        raise RuntimeError(f"{command} failed: {response.get('error', response)}")
+    print(f"  {command}: {elapsed_ms:.0f} ms", file=sys.stderr)
+    return response.get("result", {})
+
+
+def build_fixtures(args: argparse.Namespace, tag: str) -> dict:
+    """Create the seeded content the cases read. Nothing is saved; fixtures vanish with the editor session."""
+    print("building fixtures", file=sys.stderr)
+    actor_prefix = f"Bench{tag}"
+    actors = checked(args, "generate_benchmark_actors", {
+        "count": args.actor_count,
+        "distribution": "random",
+        "seed": args.seed,
+        "name_prefix": actor_prefix,
+        "folder": f"Benchmark/{tag}",
+    })
+    blueprint_name = f"BP_Bench{tag}"
+    checked(args, "generate_benchmark_blueprint", {
+        "name": blueprint_name,
+        "node_count": args.blueprint_nodes,
+        "seed": args.seed,
+    })
+    widget_name = f"WBP_Bench{tag}"
+    checked(args, "generate_benchmark_widget_tree", {
+        "name": widget_name,
+        "depth": args.widget_depth,
+        "fanout": args.widget_fanout,
+        "seed": args.seed,
+    })
+    return {
+        "actor_prefix": actor_prefix,
+        "middle_actor": f"{actor_prefix}_{args.actor_count // 2}",
+        "actor_spawn_ms": actors.get("elapsed_ms", 0.0),
+        "blueprint_name": blueprint_name,
+        "widget_name": widget_name,
+    }
+
+
+def build_cases(args: argparse.Namespace, fixtures: dict) -> list[tuple[str, str, dict]]:
+    """(case name, command, params). Case names are the keys thresholds refer to; keep them stable."""
+    cases = [
+        ("ping", "ping", {}),
+        ("help", "help", {}),
+        ("get_actors_in_level", "get_actors_in_level", {}),
+        ("get_actors_in_level_columnar", "get_actors_in_level", {"layout": "columnar"}),
+        ("find_actors_by_name", "find_actors_by_name", {"pattern": fixtures["actor_prefix"] + "_1"}),
+        ("get_actor_properties", "get_actor_properties", {"name": fixtures["middle_actor"]}),
+        ("get_blueprint_info", "get_blueprint_info", {"blueprint_name": fixtures["blueprint_name"]}),
+        ("get_blueprint_graph_info", "get_blueprint_graph_info", {"blueprint_name": fixtures["blueprint_name"]}),
+        ("get_widget_tree", "get_widget_tree", {"blueprint_name": fixtures["widget_name"]}),
+        ("find_assets", "find_assets", {"path": "/Game", "class_name": "Blueprint"}),
+    ]
+    if args.case:
+        cases = [c for c in cases if any(token in c[0] for token in args.case)]
+    return cases
+
+
+def read_alloc_stats(args: argparse.Namespace, command: str) -> dict:
+    """Per-call memory figures for the calls made since the last reset_mcp_stats."""
+    response, _, _ = send_unreal_command(args.host, args.port, args.timeout, "get_mcp_stats", {"command": command})
+    rows = response.get("result", {}).get("commands", []) if response.get("status") == "success" else []
+    if not rows or "alloc_tracked_calls" not in rows[0]:
+        return {}
+    row = rows[0]
+    stats = {
+        "working_set_delta_bytes": row.get("avg_working_set_delta_bytes", 0),
+        "peak_working_set_delta_bytes": row.get("max_peak_working_set_delta_bytes", 0),
+        "server_exec_ms": row.get("avg_exec_ms", 0.0),
+    }
+    # Only present when the editor runs with -llm
+    if "avg_llm_bytes" in row:
+        stats["llm_bytes"] = row["avg_llm_bytes"]
+    return stats
+
+
+def run_case(args: argparse.Namespace, command: str, params: dict, alloc_stats: bool) -> dict:
+    for _ in range(args.warmup):
+        send_unreal_command(args.host, args.port, args.timeout, command, params)
+    if alloc_stats:
+        send_unreal_command(args.host, args.port, args.timeout, "reset_mcp_stats", {"alloc_tracking": True})
+
+    latencies: list[float] = []
+    payload_sizes: list[int] = []
+    errors = 0
+    for _ in range(args.iterations):
+        response, elapsed_ms, size = send_unreal_command(args.host, args.port, args.timeout, command, params)
+        latencies.append(elapsed_ms)
+        payload_sizes.append(size)
+        if response.get("status") != "success":
+            errors += 1
+    run = {
+        "latencies_ms": latencies,
+        "payload_bytes": int(statistics.median(payload_sizes)) if payload_sizes else 0,
+        "errors": errors,
+    }
+    if alloc_stats:
+        run.update(read_alloc_stats(args, command))
+    return run
+
+
+def server_supports_stats(args: argparse.Namespace) -> bool:
+    try:
+        response, _, _ = send_unreal_command(args.host, args.port, args.timeout, "reset_mcp_stats", {"alloc_tracking": True})
+    except Exception:
+        return False
+    return response.get("status") == "success"
+
+
+def main() -> int:
+    args = parse_args()
+    if args.runs < 1 or args.iterations < 1:
+        raise SystemExit("--runs and --iterations must be >= 1")
+
+    proc = launch_headless_editor(args) if args.editor else None
+    try:
+        wait_for_editor(args, proc)
+        tag = datetime.now().strftime("%H%M%S")
+        fixtures = build_fixtures(args, tag)
+        cases = build_cases(args, fixtures)
+        alloc_stats = not args.no_alloc_stats and server_supports_stats(args)
+        if not args.no_alloc_stats and not alloc_stats:
+            print("warning: editor has no get_mcp_stats; memory figures are omitted", file=sys.stderr)
+
+        results: dict[str, dict] = {
+            name: {"command": command, "params": params, "runs": []} for name, command, params in cases
+        }
+        for run_index in range(args.runs):
+            print(f"run {run_index + 1}/{args.runs}", file=sys.stderr)
+            for name, command, params in cases:
+                run = run_case(args, command, params, alloc_stats)
+                results[name]["runs"].append(run)
+                alloc_note = f"  retained={run['llm_bytes'] / 1024:.0f} KiB" if "llm_bytes" in run else ""
+                print(f"  {name:<28} p50={statistics.median(run['latencies_ms']):8.2f} ms  "
+                      f"payload={run['payload_bytes']} B  errors={run['errors']}{alloc_note}", file=sys.stderr)
+    finally:
+        if proc is not None:
+            shutdown_editor(args, proc)
+
+    report = {
+        "format": RESULT_FORMAT,
+        "version": RESULT_VERSION,
+        "label": args.label,
+        "started_utc": datetime.now(timezone.utc).isoformat(),
+        "host": platform.node(),
+        "headless": bool(args.editor),
+        "alloc_stats": alloc_stats,
+        "config": {
+            "runs": args.runs,
+            "iterations": args.iterations,
+            "warmup": args.warmup,
+            "seed": args.seed,
+            "actor_count": args.actor_count,
+            "blueprint_nodes": args.blueprint_nodes,
+            "widget_depth": args.widget_depth,
+            "widget_fanout": args.widget_fanout,
+        },
+        "fixtures": fixtures,
+        "cases": results,
+    }
+    Path(args.out).write_text(json.dumps(report, indent=2), encoding="utf-8")
+    print(f"wrote {args.out}", file=sys.stderr)
+
+    failed_cases = [name for name, case in results.items() if any(run["errors"] for run in case["runs"])]
+    if failed_cases:
+        print(f"cases with command errors: {', '.join(failed_cases)}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
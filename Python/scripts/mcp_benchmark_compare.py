@@ -0,0 +1,282 @@
+"""
+Compare two mcp_benchmark.py result files (baseline vs candidate) and gate on regressions.
+
+For every case the comparator checks:
+  - p50 / p95 latency against per-case percentage thresholds,
+  - payload size (response bytes),
+  - retained memory per call (llm_bytes), when both files carry it.
+
+Latency regressions only fail the gate when they are larger than the threshold,
+larger than --min-abs-ms, and statistically significant (Mann-Whitney U over the
+pooled per-call samples of all runs). A case whose run-to-run median spread
+exceeds --max-run-spread in either file is reported as NOISY instead of failing,
+so an unstable machine does not block a change; rerun with more --runs.
+
+Thresholds file (optional, JSON):
+  {
+    "default":  {"p50_pct": 10, "p95_pct": 25, "payload_pct": 5, "llm_bytes_pct": 10},
+    "cases":    {"get_actors_in_level": {"p50_pct": 5}, "find_*": {"p95_pct": 40}}
+  }
+Case keys are fnmatch patterns; the first match (in file order) overrides the default.
+
+Exit code: 0 = pass (warnings allowed), 1 = regression, 2 = bad input.
+
+Usage:
+  python Python/scripts/mcp_benchmark_compare.py baseline.json candidate.json \
+      --thresholds Python/scripts/benchmark_thresholds.json
+"""
+
+from __future__ import annotations
+
+import argparse
+import fnmatch
+import json
+import math
+import statistics
+import sys
+from pathlib import Path
+
+
+RESULT_FORMAT = "unrealmcp-benchmark"
+
+DEFAULT_THRESHOLDS = {
+    "p50_pct": 10.0,
+    "p95_pct": 25.0,
+    "payload_pct": 5.0,
+    "llm_bytes_pct": 10.0,
+}
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description="Gate an UnrealMCP benchmark run against a baseline")
+    parser.add_argument("baseline", help="Baseline result JSON")
+    parser.add_argument("candidate", help="Candidate result JSON")
+    parser.add_argument("--thresholds", default="", help="Per-case thresholds JSON")
+    parser.add_argument("--alpha", type=float, default=0.01, help="Significance level for latency regressions")
+    parser.add_argument("--min-abs-ms", type=float, default=0.5,
+                        help="Ignore latency deltas smaller than this many ms regardless of percentage")
+    parser.add_argument("--max-run-spread", type=float, default=20.0,
+                        help="Max (max-min)/median of per-run p50s, in percent, before a case is NOISY")
+    parser.add_argument("--fail-on-noise", action="store_true", help="Treat NOISY cases as failures")
+    parser.add_argument("--json-out", default="", help="Write the verdicts as JSON")
+    return parser.parse_args()
+
+
+def load_result(path: str) -> dict:
+    data = json.loads(Path(path).read_text(encoding="utf-8"))
+    if data.get("format") != RESULT_FORMAT:
+        raise ValueError(f"{path}: not an {RESULT_FORMAT} file")
+    return data
+
+
+def load_thresholds(path: str) -> tuple[dict, list[tuple[str, dict]]]:
+    default = dict(DEFAULT_THRESHOLDS)
+    overrides: list[tuple[str, dict]] = []
+    if path:
+        data = json.loads(Path(path).read_text(encoding="utf-8"))
+        default.update(data.get("default", {}))
+        overrides = list(data.get("cases", {}).items())
+    return default, overrides
+
+
+def thresholds_for(case: str, default: dict, overrides: list[tuple[str, dict]]) -> dict:
+    for pattern, values in overrides:
+        if fnmatch.fnmatchcase(case, pattern):
+            merged = dict(default)
+            merged.update(values)
+            return merged
+    return default
+
+
+def percentile(values: list[float], fraction: float) -> float:
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, max(0, int(math.ceil(fraction * len(ordered))) - 1))
+    return ordered[index]
+
+
+def pct_change(base: float, cand: float) -> float:
+    if base <= 0:
+        return 0.0 if cand <= 0 else math.inf
+    return (cand - base) / base * 100.0
+
+
+def mann_whitney_p_greater(base: list[float], cand: list[float]) -> float:
+    """One-sided p-value that cand is stochastically larger than base (normal approximation, tie-corrected)."""
+    n1, n2 = len(base), len(cand)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    pooled = sorted([(v, 0) for v in base] + [(v, 1) for v in cand])
+    ranks = [0.0] * len(pooled)
+    tie_term = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        average_rank = (i + j) / 2.0 + 1.0
+        for k in range(i, j + 1):
+            ranks[k] = average_rank
+        tied = j - i + 1
+        tie_term += tied ** 3 - tied
+        i = j + 1
+    rank_sum_cand = sum(rank for rank, (_, group) in zip(ranks, pooled) if group == 1)
+    u_cand = rank_sum_cand - n2 * (n2 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1))) if n > 1 else 0.0
+    if variance <= 0:
+        return 1.0
+    z = (u_cand - n1 * n2 / 2.0 - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def run_spread_pct(case: dict) -> float:
+    medians = [statistics.median(run["latencies_ms"]) for run in case["runs"] if run["latencies_ms"]]
+    if len(medians) < 2:
+        return 0.0
+    center = statistics.median(medians)
+    return (max(medians) - min(medians)) / center * 100.0 if center > 0 else 0.0
+
+
+def pooled(case: dict, key: str) -> list[float]:
+    values: list[float] = []
+    for run in case["runs"]:
+        values.extend(run.get(key, []))
+    return values
+
+
+def per_run_metric(case: dict, key: str) -> float | None:
+    values = [run[key] for run in case["runs"] if run.get(key) is not None]
+    return statistics.median(values) if values else None
+
+
+def compare_case(name: str, base: dict, cand: dict, limits: dict, args: argparse.Namespace) -> dict:
+    base_lat = pooled(base, "latencies_ms")
+    cand_lat = pooled(cand, "latencies_ms")
+    result = {
+        "case": name,
+        "checks": [],
+        "noise_pct": max(run_spread_pct(base), run_spread_pct(cand)),
+        "runs": (len(base["runs"]), len(cand["runs"])),
+    }
+
+    p_value = mann_whitney_p_greater(base_lat, cand_lat)
+    result["p_value"] = p_value
+    noisy = result["noise_pct"] > args.max_run_spread or min(result["runs"]) < 2
+
+    for label, fraction, limit_key in (("p50", 0.50, "p50_pct"), ("p95", 0.95, "p95_pct")):
+        base_value = percentile(base_lat, fraction)
+        cand_value = percentile(cand_lat, fraction)
+        delta = pct_change(base_value, cand_value)
+        limit = float(limits[limit_key])
+        exceeded = delta > limit and (cand_value - base_value) > args.min_abs_ms
+        if not exceeded:
+            status = "ok"
+        elif p_value >= args.alpha:
+            status = "not_significant"
+        elif noisy:
+            status = "noisy"
+        else:
+            status = "fail"
+        result["checks"].append({"metric": f"{label}_ms", "baseline": base_value, "candidate": cand_value,
+                                 "delta_pct": delta, "limit_pct": limit, "status": status})
+
+    for metric, limit_key in (("payload_bytes", "payload_pct"), ("llm_bytes", "llm_bytes_pct")):
+        base_value = per_run_metric(base, metric)
+        cand_value = per_run_metric(cand, metric)
+        if base_value is None or cand_value is None:
+            continue
+        delta = pct_change(base_value, cand_value)
+        limit = float(limits[limit_key])
+        # Payload and retained memory are deterministic for a seeded fixture, so no significance test.
+        result["checks"].append({"metric": metric, "baseline": base_value, "candidate": cand_value,
+                                 "delta_pct": delta, "limit_pct": limit, "status": "fail" if delta > limit else "ok"})
+
+    statuses = {check["status"] for check in result["checks"]}
+    if "fail" in statuses:
+        result["verdict"] = "FAIL"
+    elif "noisy" in statuses:
+        result["verdict"] = "NOISY"
+    elif noisy:
+        result["verdict"] = "PASS (noisy)"
+    else:
+        result["verdict"] = "PASS"
+    return result
+
+
+def print_report(verdicts: list[dict], missing: list[str], added: list[str]) -> None:
+    header = f"{'case':<30} {'verdict':<13} {'p50 base':>9} {'p50 cand':>9} {'d p50':>8} {'p95 base':>9} {'p95 cand':>9} {'d p95':>8} {'noise':>7} {'p':>7}"
+    print(header)
+    print("-" * len(header))
+    for v in verdicts:
+        checks = {c["metric"]: c for c in v["checks"]}
+        p50 = checks["p50_ms"]
+        p95 = checks["p95_ms"]
+        print(f"{v['case']:<30} {v['verdict']:<13} {p50['baseline']:>9.2f} {p50['candidate']:>9.2f} {p50['delta_pct']:>7.1f}% "
+              f"{p95['baseline']:>9.2f} {p95['candidate']:>9.2f} {p95['delta_pct']:>7.1f}% {v['noise_pct']:>6.1f}% {v['p_value']:>7.4f}")
+        for check in v["checks"]:
+            if check["metric"] in ("p50_ms", "p95_ms") or check["status"] == "ok":
+                continue
+            print(f"    {check['metric']}: {check['baseline']:.0f} -> {check['candidate']:.0f} "
+                  f"({check['delta_pct']:+.1f}%, limit {check['limit_pct']:.1f}%) {check['status']}")
+    for name in missing:
+        print(f"{name:<30} {'MISSING':<13} case absent from candidate")
+    for name in added:
+        print(f"{name:<30} {'NEW':<13} no baseline; not gated")
+
+
+def main() -> int:
+    args = parse_args()
+    try:
+        baseline = load_result(args.baseline)
+        candidate = load_result(args.candidate)
+        default_limits, overrides = load_thresholds(args.thresholds)
+    except (OSError, ValueError) as exc:
+        print(f"error: {exc}", file=sys.stderr)
+        return 2
+
+    if baseline.get("config") != candidate.get("config"):
+        print("warning: benchmark configs differ; deltas may not be comparable", file=sys.stderr)
+
+    base_cases = baseline["cases"]
+    cand_cases = candidate["cases"]
+    missing = sorted(set(base_cases) - set(cand_cases))
+    added = sorted(set(cand_cases) - set(base_cases))
+
+    verdicts = [
+        compare_case(name, base_cases[name], cand_cases[name], thresholds_for(name, default_limits, overrides), args)
+        for name in base_cases if name in cand_cases
+    ]
+    print_report(verdicts, missing, added)
+
+    failed = [v["case"] for v in verdicts if v["verdict"] == "FAIL"] + missing
+    noisy = [v["case"] for v in verdicts if v["verdict"] == "NOISY"]
+    if args.fail_on_noise:
+        failed += noisy
+
+    print()
+    if failed:
+        print(f"RESULT: FAIL ({len(failed)} case(s): {', '.join(failed)})")
+    elif noisy:
+        print(f"RESULT: PASS with noisy case(s): {', '.join(noisy)} - rerun with more --runs to confirm")
+    else:
+        print("RESULT: PASS")
+
+    if args.json_out:
+        Path(args.json_out).write_text(json.dumps({
+            "baseline": args.baseline,
+            "candidate": args.candidate,
+            "passed": not failed,
+            "failed_cases": failed,
+            "noisy_cases": noisy,
+            "missing_cases": missing,
+            "new_cases": added,
+            "cases": verdicts,
+        }, indent=2), encoding="utf-8")
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
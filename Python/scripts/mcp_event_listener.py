@@ -0,0 +1,121 @@
+"""
+Subscribe to UnrealMCP editor events and print the pushed notification frames.
+
+Subscriptions belong to one connection, so this keeps a single socket open
+(the MCP tool server reconnects per command and cannot receive pushes). The
+bridge serves every open connection, so this can run alongside the tool server
+and other clients; only this connection receives its frames. After
+the subscribe response, the bridge pushes frames like
+
+  {"type": "notification", "topic": "actors", "sequence": 3, "overflow": false,
+   "events": [{"type": "moved", "name": "Cube_2", "path": "/Game/Maps/Main.Main:PersistentLevel.Cube_2"}],
+   "pending": 0}
+
+whenever subscribed events are queued, at most once per topic per
+--min-interval-ms. Frames and responses are bare JSON objects with no delimiter
+between them; a response has a "status" field, a frame has type=notification.
+
+Usage examples:
+  python Python/scripts/mcp_event_listener.py --topic actors --topic blueprints
+  python Python/scripts/mcp_event_listener.py --topic dialogue --path-prefix /Game/Dialogues --duration 60
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import socket
+import sys
+import time
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description="Print UnrealMCP notification frames for the given topics")
+    parser.add_argument("--topic", action="append", default=[],
+                        help="actors, assets, blueprints, dialogue or all (repeatable, default: all)")
+    parser.add_argument("--path-prefix", action="append", default=[],
+                        help="Only events whose object path starts with this (repeatable)")
+    parser.add_argument("--min-interval-ms", type=float, default=250.0)
+    parser.add_argument("--duration", type=float, default=0.0, help="Stop after N seconds (0 = until Ctrl+C)")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=55557)
+    return parser.parse_args()
+
+
+class FrameReader:
+    """Splits the undelimited stream of JSON objects the bridge writes into messages."""
+
+    def __init__(self, sock: socket.socket) -> None:
+        self._sock = sock
+        self._buffer = ""
+        self._decoder = json.JSONDecoder()
+
+    def next_message(self) -> dict | None:
+        while True:
+            text = self._buffer.lstrip()
+            if text:
+                try:
+                    message, end = self._decoder.raw_decode(text)
+                    self._buffer = text[end:]
+                    return message
+                except json.JSONDecodeError:
+                    pass
+            try:
+                chunk = self._sock.recv(65536)
+            except socket.timeout:
+                return None
+            if not chunk:
+                raise ConnectionError("Connection closed by the editor")
+            self._buffer += chunk.decode("utf-8")
+
+
+def request(sock: socket.socket, reader: FrameReader, command: str, params: dict) -> dict:
+    """Send a command and return its response, printing any frames that arrive first."""
+    sock.sendall(json.dumps({"type": command, "params": params}).encode("utf-8"))
+    while True:
+        message = reader.next_message()
+        if message is None:
+            continue
+        if message.get("type") == "notification":
+            print_frame(message)
+            continue
+        return message
+
+
+def print_frame(frame: dict) -> None:
+    if frame.get("overflow"):
+        print(f"[{frame.get('topic')} #{frame.get('sequence')}] overflow: events were dropped, re-query state")
+    for event in frame.get("events", []):
+        detail = event.get("status") or event.get("old_path") or ""
+        print(f"[{frame.get('topic')} #{frame.get('sequence')}] {event.get('type'):<9} {event.get('path', '')} {detail}".rstrip())
+    sys.stdout.flush()
+
+
+def main() -> int:
+    args = parse_args()
+    params: dict = {"topics": args.topic or ["all"], "min_interval_ms": args.min_interval_ms}
+    if args.path_prefix:
+        params["path_prefixes"] = args.path_prefix
+
+    with socket.create_connection((args.host, args.port), timeout=10.0) as sock:
+        reader = FrameReader(sock)
+        response = request(sock, reader, "subscribe", params)
+        if response.get("status") != "success":
+            print(f"subscribe failed: {response.get('error', response)}", file=sys.stderr)
+            return 1
+        print(f"subscribed: {json.dumps(response.get('result', {}))}")
+
+        sock.settimeout(0.5)
+        deadline = time.monotonic() + args.duration if args.duration > 0 else None
+        try:
+            while deadline is None or time.monotonic() < deadline:
+                message = reader.next_message()
+                if message is not None and message.get("type") == "notification":
+                    print_frame(message)
+        except KeyboardInterrupt:
+            pass
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,310 @@
+"""
+Replay a traffic log recorded by the UnrealMCP bridge and report timing diffs.
+
+Recording (editor side):
+  - launch the editor with -MCPRecordTraffic=<path>, or
+  - send {"type": "start_traffic_recording", "params": {"path": "..."}} and later
+    {"type": "stop_traffic_recording"}
+
+Each log line is one request: seq, t (seconds since recording start), session,
+type, params, queue_ms, exec_ms, status, response_bytes. Header lines
+({"format": "unrealmcp-traffic", ...}) start a new recording segment.
+
+Replay re-issues every request against a running editor, either back-to-back
+(--mode fast) or honouring the original inter-request gaps (--mode timed), then
+prints per-command original vs replay latency. Both sides are the bridge's own
+queue_ms + exec_ms: the replay records a traffic log of its own on the target
+editor (which must share this machine's filesystem, as with the default
+127.0.0.1) and reads the timings back. The client round trip is reported
+separately as replay_rtt_ms. Requests that failed in transport are listed but
+left out of the statistics.
+
+Usage examples:
+  python Python/scripts/mcp_traffic_replay.py Saved/UnrealMCP/Traffic/traffic_20261018_101500.jsonl
+  python Python/scripts/mcp_traffic_replay.py run.jsonl --mode timed --speed 2.0 --json-out replay.json
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import socket
+import statistics
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+
+LOG_FORMAT = "unrealmcp-traffic"
+SUPPORTED_LOG_VERSION = 1
+
+# Never replayed by default: they would tear down the target editor or recurse into recording.
+DEFAULT_SKIPPED_COMMANDS = (
+    "request_editor_exit",
+    "save_and_exit_editor",
+    "start_traffic_recording",
+    "stop_traffic_recording",
+    "get_traffic_recording_status",
+)
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description="Replay an UnrealMCP traffic log and diff per-command timing")
+    parser.add_argument("log", help="Traffic log (.jsonl) written by the bridge")
+    parser.add_argument("--mode", choices=("fast", "timed"), default="fast",
+                        help="fast = back-to-back; timed = keep original request offsets")
+    parser.add_argument("--speed", type=float, default=1.0, help="Time compression for --mode timed (2.0 = twice as fast)")
+    parser.add_argument("--session", type=int, action="append", default=[],
+                        help="Only replay requests from this session id (repeatable)")
+    parser.add_argument("--skip-command", action="append", default=[],
+                        help="Additional command type to skip (repeatable)")
+    parser.add_argument("--limit", type=int, default=0, help="Replay at most N requests (0 = all)")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=55557)
+    parser.add_argument("--timeout", type=float, default=60.0, help="Per-request socket timeout in seconds")
+    parser.add_argument("--top", type=int, default=10, help="How many largest per-request regressions to print")
+    parser.add_argument("--replay-log", default="",
+                        help="Where the target editor records the replay's own traffic (default: a temp file)")
+    parser.add_argument("--json-out", default="", help="Write the full report as JSON to this path")
+    return parser.parse_args()
+
+
+def load_traffic_log(path: Path) -> list[dict]:
+    """Flatten all segments into one timeline; segment N starts where segment N-1 ended."""
+    records: list[dict] = []
+    segment_base = 0.0
+    segment_last = 0.0
+    with path.open("r", encoding="utf-8") as handle:
+        for line_number, raw_line in enumerate(handle, start=1):
+            raw_line = raw_line.strip()
+            if not raw_line:
+                continue
+            try:
+                entry = json.loads(raw_line)
+            except json.JSONDecodeError:
+                # A crashed editor can leave a torn final line; everything before it is usable.
+                print(f"warning: skipping malformed line {line_number}", file=sys.stderr)
+                continue
+            if entry.get("format") == LOG_FORMAT:
+                version = entry.get("version", 0)
+                if version > SUPPORTED_LOG_VERSION:
+                    raise RuntimeError(f"log version {version} is newer than this script supports ({SUPPORTED_LOG_VERSION})")
+                segment_base = segment_last
+                continue
+            entry["t"] = segment_base + float(entry.get("t", 0.0))
+            segment_last = entry["t"]
+            records.append(entry)
+    return records
+
+
+def send_unreal_command(host: str, port: int, timeout: float, command: str, params: dict) -> tuple[dict, float]:
+    payload = json.dumps({"type": command, "params": params}).encode("utf-8")
+    start = time.perf_counter()
+    with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as sock:
+        sock.settimeout(timeout)
+        sock.connect((host, port))
+        sock.sendall(payload)
+        chunks: list[bytes] = []
+        while True:
+            chunk = sock.recv(65536)
+            if not chunk:
+                break
+            chunks.append(chunk)
+            try:
+                response = json.loads(b"".join(chunks).decode("utf-8"))
+                return response, (time.perf_counter() - start) * 1000.0
+            except json.JSONDecodeError:
+                continue
+    if not chunks:
+        raise RuntimeError(f"{command}: empty response")
+    return json.loads(b"".join(chunks).decode("utf-8")), (time.perf_counter() - start) * 1000.0
+
+
+def _percentile(values: list[float], fraction: float) -> float:
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, max(0, int(round(fraction * (len(ordered) - 1)))))
+    return ordered[index]
+
+
+def start_replay_recording(args: argparse.Namespace) -> Path | None:
+    """Have the target editor record the replay, so replay timings are server-side like the original ones."""
+    path = Path(args.replay_log) if args.replay_log else Path(tempfile.gettempdir()) / f"mcp_replay_{int(time.time())}.jsonl"
+    path.unlink(missing_ok=True)
+    try:
+        response, _ = send_unreal_command(args.host, args.port, args.timeout, "start_traffic_recording", {"path": str(path.resolve())})
+    except Exception as exc:
+        print(f"warning: could not start replay recording ({exc}); no server-side replay timings", file=sys.stderr)
+        return None
+    if response.get("status") == "error" or response.get("success") is False:
+        print(f"warning: could not start replay recording ({response.get('error') or response.get('message')}); "
+              "no server-side replay timings", file=sys.stderr)
+        return None
+    return path
+
+
+def stop_replay_recording(args: argparse.Namespace, path: Path) -> list[dict]:
+    try:
+        send_unreal_command(args.host, args.port, args.timeout, "stop_traffic_recording", {})
+    except Exception as exc:
+        print(f"warning: could not stop replay recording: {exc}", file=sys.stderr)
+    if not path.is_file():
+        print(f"warning: replay recording {path} is not readable from here (remote editor?); "
+              "no server-side replay timings", file=sys.stderr)
+        return []
+    records = load_traffic_log(path)
+    path.unlink(missing_ok=True)
+    return records
+
+
+def replay(args: argparse.Namespace, records: list[dict]) -> list[dict]:
+    skipped = set(DEFAULT_SKIPPED_COMMANDS) | set(args.skip_command)
+    selected = [
+        r for r in records
+        if r.get("type") not in skipped and (not args.session or r.get("session") in args.session)
+    ]
+    if args.limit > 0:
+        selected = selected[: args.limit]
+
+    results: list[dict] = []
+    if not selected:
+        return results
+
+    replay_log = start_replay_recording(args)
+    first_offset = selected[0]["t"]
+    replay_start = time.perf_counter()
+    for index, record in enumerate(selected):
+        if args.mode == "timed":
+            target = (record["t"] - first_offset) / max(args.speed, 1e-6)
+            delay = target - (time.perf_counter() - replay_start)
+            if delay > 0:
+                time.sleep(delay)
+
+        command = record["type"]
+        original_ms = float(record.get("queue_ms", 0.0)) + float(record.get("exec_ms", 0.0))
+        try:
+            response, replay_rtt_ms = send_unreal_command(args.host, args.port, args.timeout, command, record.get("params") or {})
+            replay_status = response.get("status", "unknown")
+            transport_ok = True
+        except Exception as exc:  # keep going; a single failed request should not hide the rest of the diff
+            replay_rtt_ms = None
+            replay_status = f"transport_error: {exc}"
+            transport_ok = False
+
+        results.append({
+            "seq": record.get("seq", index),
+            "session": record.get("session", 0),
+            "type": command,
+            "original_ms": original_ms,
+            "original_exec_ms": float(record.get("exec_ms", 0.0)),
+            "replay_ms": None,
+            "replay_rtt_ms": replay_rtt_ms,
+            "delta_ms": None,
+            "original_status": record.get("status", "unknown"),
+            "replay_status": replay_status,
+            "transport_ok": transport_ok,
+        })
+        rtt_text = f"{replay_rtt_ms:.1f}ms" if replay_rtt_ms is not None else "n/a"
+        print(f"[{index + 1}/{len(selected)}] {command}: original={original_ms:.1f}ms replay rtt={rtt_text} ({replay_status})",
+              file=sys.stderr)
+
+    if replay_log is not None:
+        attach_server_timings(results, stop_replay_recording(args, replay_log))
+    return results
+
+
+def attach_server_timings(results: list[dict], server_records: list[dict]) -> None:
+    """Match the replay's own log to the requests in order; only requests that reached the bridge are in it."""
+    pending = iter(server_records)
+    for result in results:
+        if not result["transport_ok"]:
+            continue
+        for server_record in pending:
+            if server_record.get("type") == result["type"]:
+                result["replay_ms"] = float(server_record.get("queue_ms", 0.0)) + float(server_record.get("exec_ms", 0.0))
+                result["delta_ms"] = result["replay_ms"] - result["original_ms"]
+                break
+
+
+def summarize(results: list[dict]) -> list[dict]:
+    by_command: dict[str, list[dict]] = {}
+    for result in results:
+        by_command.setdefault(result["type"], []).append(result)
+
+    summary = []
+    for command, entries in by_command.items():
+        # Like with like: only requests with a server-side replay timing enter the statistics
+        timed = [e for e in entries if e["replay_ms"] is not None]
+        original = [e["original_ms"] for e in timed] or [e["original_ms"] for e in entries]
+        replayed = [e["replay_ms"] for e in timed]
+        original_p50 = statistics.median(original)
+        replay_p50 = statistics.median(replayed) if replayed else None
+        summary.append({
+            "type": command,
+            "count": len(entries),
+            "timed_count": len(timed),
+            "failed_count": sum(1 for e in entries if not e["transport_ok"]),
+            "original_p50_ms": original_p50,
+            "replay_p50_ms": replay_p50,
+            "original_p95_ms": _percentile(original, 0.95),
+            "replay_p95_ms": _percentile(replayed, 0.95) if replayed else None,
+            "delta_p50_pct": ((replay_p50 - original_p50) / original_p50 * 100.0) if replayed and original_p50 > 0 else None,
+            "status_mismatches": sum(1 for e in entries if e["original_status"] != e["replay_status"]),
+        })
+    summary.sort(key=lambda row: row["original_p50_ms"] * row["count"], reverse=True)
+    return summary
+
+
+def print_report(summary: list[dict], results: list[dict], top: int) -> None:
+    def ms(value: float | None, width: int) -> str:
+        return f"{value:>{width}.1f}" if value is not None else f"{'n/a':>{width}}"
+
+    header = (f"{'command':<44} {'n':>5} {'failed':>6} {'orig p50':>10} {'replay p50':>11} {'orig p95':>10} {'replay p95':>11} "
+              f"{'d p50':>8} {'status!=':>8}")
+    print(header)
+    print("-" * len(header))
+    for row in summary:
+        delta = f"{row['delta_p50_pct']:>7.1f}%" if row["delta_p50_pct"] is not None else f"{'n/a':>8}"
+        print(f"{row['type']:<44} {row['count']:>5} {row['failed_count']:>6} {ms(row['original_p50_ms'], 10)} {ms(row['replay_p50_ms'], 11)} "
+              f"{ms(row['original_p95_ms'], 10)} {ms(row['replay_p95_ms'], 11)} {delta} {row['status_mismatches']:>8}")
+
+    compared = [r for r in results if r["delta_ms"] is not None]
+    if top > 0 and compared:
+        print()
+        print(f"Largest per-request differences (top {top}):")
+        for result in sorted(compared, key=lambda r: abs(r["delta_ms"]), reverse=True)[:top]:
+            print(f"  seq={result['seq']:<6} session={result['session']:<4} {result['type']:<40} "
+                  f"orig={result['original_ms']:.1f}ms replay={result['replay_ms']:.1f}ms delta={result['delta_ms']:+.1f}ms")
+
+
+def main() -> int:
+    args = parse_args()
+    log_path = Path(args.log)
+    if not log_path.is_file():
+        print(f"traffic log not found: {log_path}", file=sys.stderr)
+        return 2
+
+    records = load_traffic_log(log_path)
+    results = replay(args, records)
+    summary = summarize(results)
+    print_report(summary, results, args.top)
+
+    if args.json_out:
+        report = {
+            "log": str(log_path),
+            "mode": args.mode,
+            "speed": args.speed,
+            "replayed_count": len(results),
+            "summary": summary,
+            "requests": results,
+        }
+        Path(args.json_out).write_text(json.dumps(report, indent=2), encoding="utf-8")
+
+    transport_failures = sum(1 for r in results if not r["transport_ok"])
+    return 1 if transport_failures else 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
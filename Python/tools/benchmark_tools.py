@@ -0,0 +1,160 @@
+"""
+Benchmark fixture tools for Unreal MCP.
+
+Seeded generators that build large perf-test content in a single command:
+  - generate_benchmark_actors: N actors in a grid/random/sphere layout (one undo transaction).
+  - generate_benchmark_blueprint: Actor blueprint with an M-node random graph, compiled once.
+  - generate_benchmark_widget_tree: Widget Blueprint with a depth x fanout tree, compiled once.
+"""
+
+import logging
+from typing import Dict, Any, List, Optional
+from mcp.server.fastmcp import FastMCP, Context
+
+logger = logging.getLogger("UnrealMCP")
+
+
+def _send(command: str, params: dict) -> dict:
+    """Helper: send command to Unreal and return response."""
+    from unreal_mcp_server import get_unreal_connection
+
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    response = unreal.send_command(command, params)
+    if not response:
+        return {"success": False, "message": "No response from Unreal Engine"}
+
+    return response
+
+
+def register_benchmark_tools(mcp: FastMCP):
+    """Register benchmark fixture tools with the MCP server."""
+
+    @mcp.tool()
+    def generate_benchmark_actors(
+        ctx: Context,
+        count: int,
+        actor_class: str = "StaticMeshActor",
+        distribution: str = "grid",
+        seed: int = 0,
+        origin: Optional[List[float]] = None,
+        spacing: float = 200.0,
+        extent: float = 10000.0,
+        random_yaw: bool = False,
+        static_mesh: str = "",
+        name_prefix: str = "Bench",
+        folder: str = "Benchmark",
+    ) -> Dict[str, Any]:
+        """
+        Spawn a deterministic set of actors for benchmarking.
+
+        Args:
+            count: Number of actors to spawn (1..1000000).
+            actor_class: Shorthand (StaticMeshActor, PointLight, ...) or class path.
+            distribution: "grid", "random" or "sphere".
+            seed: Random seed; same seed + params = same layout.
+            origin: [x, y, z] centre of the layout.
+            spacing: Grid cell size in cm.
+            extent: Half-size of the random box / sphere radius in cm.
+            random_yaw: Randomize yaw per actor.
+            static_mesh: Optional mesh for StaticMeshActors, e.g. "/Engine/BasicShapes/Cube.Cube".
+            name_prefix: Actors are named <prefix>_<index>.
+            folder: Outliner folder ("" = none).
+        """
+        params: Dict[str, Any] = {
+            "count": count,
+            "class": actor_class,
+            "distribution": distribution,
+            "seed": seed,
+            "spacing": spacing,
+            "extent": extent,
+            "random_yaw": random_yaw,
+            "name_prefix": name_prefix,
+            "folder": folder,
+        }
+        if origin is not None:
+            params["origin"] = origin
+        if static_mesh:
+            params["static_mesh"] = static_mesh
+
+        try:
+            return _send("generate_benchmark_actors", params)
+        except Exception as e:
+            logger.error(f"Error generating benchmark actors: {e}")
+            return {"success": False, "message": f"Error: {e}"}
+
+    @mcp.tool()
+    def generate_benchmark_blueprint(
+        ctx: Context,
+        name: str,
+        node_count: int,
+        path: str = "/Game/Benchmark",
+        seed: int = 0,
+        link_probability: float = 0.5,
+        compile: bool = True,
+        save: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Create an Actor blueprint with a seeded random (acyclic) node graph.
+
+        Args:
+            name: Blueprint asset name (must not exist).
+            node_count: Number of generated graph nodes (1..20000).
+            path: Content folder.
+            seed: Random seed.
+            link_probability: Chance each math input is wired to an earlier node.
+            compile: Compile once after generation.
+            save: Save the asset after generation.
+        """
+        try:
+            return _send("generate_benchmark_blueprint", {
+                "name": name,
+                "node_count": node_count,
+                "path": path,
+                "seed": seed,
+                "link_probability": link_probability,
+                "compile": compile,
+                "save": save,
+            })
+        except Exception as e:
+            logger.error(f"Error generating benchmark blueprint: {e}")
+            return {"success": False, "message": f"Error: {e}"}
+
+    @mcp.tool()
+    def generate_benchmark_widget_tree(
+        ctx: Context,
+        name: str,
+        depth: int,
+        fanout: int,
+        path: str = "/Game/Benchmark",
+        seed: int = 0,
+        compile: bool = True,
+        save: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Create a Widget Blueprint with a full widget tree of the given depth and fanout.
+
+        Args:
+            name: Widget Blueprint asset name (must not exist).
+            depth: Levels below the root.
+            fanout: Children per panel (total widgets capped at 200000).
+            path: Content folder.
+            seed: Random seed for panel/leaf widget classes.
+            compile: Compile once after generation.
+            save: Save the asset after generation.
+        """
+        try:
+            return _send("generate_benchmark_widget_tree", {
+                "name": name,
+                "depth": depth,
+                "fanout": fanout,
+                "path": path,
+                "seed": seed,
+                "compile": compile,
+                "save": save,
+            })
+        except Exception as e:
+            logger.error(f"Error generating benchmark widget tree: {e}")
+            return {"success": False, "message": f"Error: {e}"}
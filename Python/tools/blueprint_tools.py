@@ -174,7 +174,10 @@ def register_blueprint_tools(mcp: FastMCP):
         property_name: str,
         property_value,
     ) -> Dict[str, Any]:
-        """Set a property on a component in a Blueprint."""
+        """Set a property on a component in a Blueprint.
+
+        property_name may be a nested path, e.g. "BodyInstance.MassScale".
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -295,7 +298,8 @@ def register_blueprint_tools(mcp: FastMCP):
         
         Args:
             blueprint_name: Name of the target Blueprint
-            property_name: Name of the property to set
+            property_name: Name of the property to set, or a property path
+                  (e.g. "CharacterMovement.MaxWalkSpeed", "Items[0].Count")
             property_value: Value to set the property to
             
         Returns:
@@ -585,6 +589,7 @@ def register_blueprint_tools(mcp: FastMCP):
         ctx: Context,
         blueprint_name: str,
         property_path: str = "",
+        diff_against: str = "",
     ) -> Dict[str, Any]:
         """
         Read a Blueprint CDO's property values (Details-panel-level data).
@@ -596,22 +601,32 @@ def register_blueprint_tools(mcp: FastMCP):
 
         Args:
             blueprint_name: Asset name of the Blueprint.
-            property_path: Optional top-level property name to narrow the dump
-                  (e.g. "GrantAbilitiesOnStart"). Nested paths
-                  (e.g. "CharacterMovement.MaxWalkSpeed") are not yet supported —
-                  follow the returned object path with a separate command.
+            property_path: Optional property path to narrow the dump; only that
+                  value is serialized (e.g. "GrantAbilitiesOnStart",
+                  "CharacterMovement.MaxWalkSpeed", "Abilities[2].Tag",
+                  "Subobject:InteractionComponent.GrantAbilitiesOnStart").
+                  Blueprint-added components resolve to their templates.
+            diff_against: Optional "parent", or a class / Blueprint name. Only
+                  properties whose value differs from that class's CDO are
+                  returned, usually a small fraction of the full dump. Cannot be
+                  combined with property_path.
 
         Returns:
             Dict with:
               - blueprint_name, path
               - parent_class (full path), generated_class (full path)
               - property_path (echoed when provided)
-              - properties (object) — all properties by default, or just
-                  {property_path: value} when narrowed.
+              - properties (object) — all properties by default, just
+                  {property_path: value} when narrowed, or only the changed
+                  properties with diff_against
+              - diff_against (reference class path), changed_count,
+                  compared_count when diffing
 
         Example:
             # Find which abilities a player BP grants at start
             get_blueprint_defaults("BP_PlayerCharacter", "GrantAbilitiesOnStart")
+            # What does this BP override from its parent?
+            get_blueprint_defaults("BP_PlayerCharacter", diff_against="parent")
         """
         from unreal_mcp_server import get_unreal_connection
 
@@ -622,6 +637,8 @@ def register_blueprint_tools(mcp: FastMCP):
             params: Dict[str, Any] = {"blueprint_name": blueprint_name}
             if property_path:
                 params["property_path"] = property_path
+            if diff_against:
+                params["diff_against"] = diff_against
             response = unreal.send_command("get_blueprint_defaults", params)
             if not response:
                 return {"success": False, "message": "No response from Unreal Engine"}
@@ -631,4 +648,142 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def resolve_blueprint(ctx: Context, blueprint_name: str) -> Dict[str, Any]:
+        """
+        Show which asset a Blueprint name resolves to, without changing anything.
+
+        Every blueprint command looks its target up the same way: exact path first,
+        then /Game/Blueprints, /Game/Widgets, /Game/Maps and /Game, then any
+        Blueprint with that short name (lowest path wins), then a map's level
+        blueprint. Use this when a short name may be shared.
+
+        Args:
+            blueprint_name: Short name, package path, object path or generated class path.
+
+        Returns:
+            Dict with found, path, ambiguous (several matches and no exact path or
+            preferred folder decides), candidates (object paths, best first) and
+            indexed_count.
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            response = unreal.send_command("resolve_blueprint", {"blueprint_name": blueprint_name})
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            return response
+        except Exception as e:
+            error_msg = f"Error resolving blueprint: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def set_blueprint_properties(
+        ctx: Context,
+        assignments: List[Dict[str, Any]],
+        blueprints: List[str] = None,
+        filter: Dict[str, Any] = None,
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Apply property assignments to many Blueprints in one transaction and one compile pass.
+
+        Args:
+            assignments: List of {"property": ..., "value": ..., "component": optional}.
+                         property accepts nested paths; component targets that
+                         component's template instead of the class defaults.
+            blueprints: Blueprint names or paths.
+            filter: query_assets filter selecting the Blueprints instead (classes
+                    default to Blueprint; at most 1000 matches).
+            compile: Compile the edited Blueprints once at the end (default True);
+                     False only marks them modified.
+
+        Returns:
+            Dict with per-blueprint results (applied, errors, status), count,
+            applied_count, failed_count, missing, compiled, compile_ms and elapsed_ms.
+
+        Example:
+            set_blueprint_properties(
+                [{"component": "Mesh", "property": "CastShadow", "value": False}],
+                filter={"path": "/Game/Props", "name": "BP_Rock*"})
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            params: Dict[str, Any] = {"assignments": assignments, "compile": compile}
+            if blueprints is not None:
+                params["blueprints"] = blueprints
+            if filter is not None:
+                params["filter"] = filter
+            response = unreal.send_command("set_blueprint_properties", params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            return response
+        except Exception as e:
+            error_msg = f"Error setting blueprint properties: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def compile_blueprints(
+        ctx: Context,
+        blueprints: List[str] = None,
+        filter: Dict[str, Any] = None,
+        dirty: bool = False,
+        mode: str = "queued"
+    ) -> Dict[str, Any]:
+        """
+        Compile many Blueprints in one pass and report errors and warnings per node.
+
+        Pass exactly one of blueprints, filter or dirty=True.
+
+        Args:
+            blueprints: Blueprint names or paths.
+            filter: query_assets filter selecting the Blueprints instead (classes
+                    default to Blueprint; at most 1000 matches).
+            dirty: Compile every loaded Blueprint that needs a recompile.
+            mode: "queued" (default) compiles the set in one compilation manager
+                  pass, reinstancing once, and reports only the average
+                  ms_per_blueprint; "sequential" compiles them one by one and
+                  times each.
+
+        Returns:
+            Dict with per-blueprint status, errors and warnings ({graph, node_id,
+            node_title, message}) and ms in sequential mode, plus count,
+            failed_count, error_count, warning_count, missing, compile_ms and
+            ms_per_blueprint.
+
+        Example:
+            # After a bulk refactor, recompile everything it touched
+            compile_blueprints(dirty=True)
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            params: Dict[str, Any] = {"mode": mode}
+            if blueprints is not None:
+                params["blueprints"] = blueprints
+            if filter is not None:
+                params["filter"] = filter
+            if dirty:
+                params["dirty"] = True
+            response = unreal.send_command("compile_blueprints", params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            return response
+        except Exception as e:
+            error_msg = f"Error compiling blueprints: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     logger.info("Blueprint tools registered successfully")
\ No newline at end of file
@@ -22,6 +22,9 @@ MCP-3 (Line ID, mirrors Details panel Pick Line / Unbind):
 MCP-4 (Speaker migration, for schema change TObjectPtr<UDialogueSpeakerAsset> -> FName SpeakerId):
   - list_dialogue_nodes: Enumerate nodes + Speaker UPROPERTY state via reflection.
   - set_dialogue_node_speaker_id: Write FName SpeakerId on a node by GUID.
+
+MCP-5 (benchmark fixtures):
+  - generate_benchmark_dialogue: Seeded P-node dialogue asset built in one call.
 """
 
 import logging
@@ -519,3 +522,36 @@ def register_dialogue_tools(mcp: FastMCP):
             })
         except Exception as e:
             return {"success": False, "message": f"Error: {e}"}
+
+    @mcp.tool()
+    def generate_benchmark_dialogue(
+        ctx: Context,
+        asset_path: str,
+        node_count: int,
+        seed: int = 0,
+        choice_ratio: float = 0.2,
+        save: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Create a seeded benchmark DialogueAsset with node_count nodes in one call.
+
+        Nodes form one chain from Entry (Speech/Choice mix, last node is Exit);
+        the transition compiler runs once at the end. Same seed = same content.
+
+        Args:
+            asset_path: Content path for the new asset, e.g. "/Game/Benchmark/DA_Bench_1k".
+            node_count: Number of generated nodes (1..100000).
+            seed: Random seed for node types and speakers.
+            choice_ratio: Fraction of non-exit nodes that are Choice nodes.
+            save: Save the asset after generation.
+        """
+        try:
+            return _send("generate_benchmark_dialogue", {
+                "asset_path": asset_path,
+                "node_count": node_count,
+                "seed": seed,
+                "choice_ratio": choice_ratio,
+                "save": save,
+            })
+        except Exception as e:
+            return {"success": False, "message": f"Error: {e}"}
@@ -15,41 +15,104 @@ def register_editor_tools(mcp: FastMCP):
     """Register editor tools with the MCP server."""
     
     @mcp.tool()
-    def get_actors_in_level(ctx: Context) -> List[Dict[str, Any]]:
-        """Get a list of all actors in the current level."""
+    def get_actors_in_level(
+        ctx: Context,
+        class_name: str = "",
+        tag: str = "",
+        folder: str = "",
+        level: str = "",
+        label: str = "",
+        fields: Optional[List[str]] = None,
+        limit: int = 1000,
+        cursor: str = "",
+        snapshot: str = "",
+        layout: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Get a page of actors in the current level. Filtering and projection happen in the editor,
+        so narrow the query instead of listing everything.
+
+        Args:
+            class_name: Only actors of this class or a subclass ("StaticMeshActor", "BP_Door").
+            tag: Only actors with this tag.
+            folder: Only actors in this outliner folder or below it.
+            level: Only actors in this level (package path, short name, or "persistent").
+            label: Case-insensitive wildcard on the actor label ("Wall_*").
+            fields: Fields per actor (name, label, class, path, location, rotation,
+                  scale, bounds, folder, level, tags). Default: name, class and transform.
+            limit: Page size (max 10000).
+            cursor: next_cursor from the previous page.
+            snapshot: snapshot from the first page; the response reports snapshot_changed.
+            layout: "columnar" returns parallel per-field columns (numbers as base64 float32)
+                  instead of one object per actor; much smaller for large pages.
+
+        Returns:
+            Dict with actors, count, total, snapshot and, when more pages remain, next_cursor.
+        """
         from unreal_mcp_server import get_unreal_connection
-        
+
         try:
             unreal = get_unreal_connection()
             if not unreal:
-                logger.warning("Failed to connect to Unreal Engine")
-                return []
-                
-            response = unreal.send_command("get_actors_in_level", {})
-            
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            params: Dict[str, Any] = {"limit": limit}
+            optional = {"class": class_name, "tag": tag, "folder": folder, "level": level,
+                        "label": label, "cursor": cursor, "snapshot": snapshot, "layout": layout}
+            params.update({key: value for key, value in optional.items() if value})
+            if fields:
+                params["fields"] = fields
+            response = unreal.send_command("get_actors_in_level", params)
             if not response:
-                logger.warning("No response from Unreal Engine")
-                return []
-                
-            # Log the complete response for debugging
-            logger.info(f"Complete response from Unreal: {response}")
-            
-            # Check response format
-            if "result" in response and "actors" in response["result"]:
-                actors = response["result"]["actors"]
-                logger.info(f"Found {len(actors)} actors in level")
-                return actors
-            elif "actors" in response:
-                actors = response["actors"]
-                logger.info(f"Found {len(actors)} actors in level")
-                return actors
-                
-            logger.warning(f"Unexpected response format: {response}")
-            return []
-            
+                return {"success": False, "message": "No response from Unreal Engine"}
+            result = response.get("result", response)
+            logger.info(f"get_actors_in_level count={result.get('count', '?')} total={result.get('total', '?')}")
+            return response
         except Exception as e:
-            logger.error(f"Error getting actors: {e}")
-            return []
+            error_msg = f"Error getting actors: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_level_changes(
+        ctx: Context,
+        since_revision: int,
+        epoch: str = "",
+        limit: int = 1000,
+        fields: Optional[List[str]] = None,
+    ) -> Dict[str, Any]:
+        """
+        Actor changes since a world revision, for keeping a mirrored actor list current.
+
+        Args:
+            since_revision: "revision" from get_actors_in_level, or "next_revision" from
+                  the previous get_level_changes call.
+            epoch: "epoch" from the same response; a different editor session forces a resync.
+            limit: Max log entries consumed per call.
+            fields: Fields of the current actor state to include with each change.
+
+        Returns:
+            Dict with changes ([{revision, type, name, path, actor}]), next_revision, has_more
+            and resync_required. When resync_required is true, re-list with get_actors_in_level.
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            params: Dict[str, Any] = {"since_revision": since_revision, "limit": limit}
+            if epoch:
+                params["epoch"] = epoch
+            if fields:
+                params["fields"] = fields
+            response = unreal.send_command("get_level_changes", params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            return response
+        except Exception as e:
+            error_msg = f"Error getting level changes: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
 
     @mcp.tool()
     def find_actors_by_name(ctx: Context, pattern: str) -> List[str]:
@@ -144,8 +207,8 @@ def register_editor_tools(mcp: FastMCP):
             return {"success": False, "message": error_msg}
     
     @mcp.tool()
-    def delete_actor(ctx: Context, name: str) -> Dict[str, Any]:
-        """Delete an actor by name."""
+    def delete_actor(ctx: Context, name: str, match_label: bool = False) -> Dict[str, Any]:
+        """Delete an actor by object name (or by its label with match_label=True, if unique)."""
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -154,9 +217,10 @@ def register_editor_tools(mcp: FastMCP):
                 logger.error("Failed to connect to Unreal Engine")
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
                 
-            response = unreal.send_command("delete_actor", {
-                "name": name
-            })
+            params = {"name": name}
+            if match_label:
+                params["match_label"] = True
+            response = unreal.send_command("delete_actor", params)
             return response or {}
             
         except Exception as e:
@@ -169,9 +233,10 @@ def register_editor_tools(mcp: FastMCP):
         name: str,
         location: List[float]  = None,
         rotation: List[float]  = None,
-        scale: List[float] = None
+        scale: List[float] = None,
+        match_label: bool = False
     ) -> Dict[str, Any]:
-        """Set the transform of an actor."""
+        """Set the transform of an actor by object name (or by its label with match_label=True, if unique)."""
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -181,6 +246,8 @@ def register_editor_tools(mcp: FastMCP):
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
                 
             params = {"name": name}
+            if match_label:
+                params["match_label"] = True
             if location is not None:
                 params["location"] = location
             if rotation is not None:
@@ -196,8 +263,78 @@ def register_editor_tools(mcp: FastMCP):
             return {}
     
     @mcp.tool()
-    def get_actor_properties(ctx: Context, name: str) -> Dict[str, Any]:
-        """Get all properties of an actor."""
+    def set_actor_transforms(
+        ctx: Context,
+        names: Optional[List[str]] = None,
+        match_label: bool = False,
+        filter: Optional[Dict[str, Any]] = None,
+        in_box: Optional[Dict[str, Any]] = None,
+        in_sphere: Optional[Dict[str, Any]] = None,
+        mode: str = "relative",
+        location: Optional[List[float]] = None,
+        rotation: Optional[List[float]] = None,
+        scale: Optional[List[float]] = None,
+        matrix: Optional[List[float]] = None,
+        rotate: Optional[List[float]] = None,
+        offset: Optional[List[float]] = None,
+        scale_by: Optional[List[float]] = None,
+        pivot: Optional[List[float]] = None,
+        snap: Optional[Any] = None,
+        snap_rotation: Optional[float] = None,
+    ) -> Dict[str, Any]:
+        """
+        Transform many actors in one call and one undo transaction.
+
+        Select with names, or with filter ({class, tag, folder, level, label}) and/or
+        in_box ({min, max}) / in_sphere ({center, radius}).
+
+        Args:
+            names: Actor object names.
+            match_label: Also accept a unique editor label for names that match no object name.
+            mode: "relative" (default) or "absolute".
+            location, rotation, scale: Absolute mode values; only the given ones are set.
+            matrix: Relative; 16 numbers, row-major 4x4 applied in world space about pivot.
+            rotate: Relative; [pitch, yaw, roll] about pivot or each actor's own location.
+            offset: Relative; added to location.
+            scale_by: Relative; multiplied into scale.
+            pivot: Relative; pivot for matrix and rotate.
+            snap: Location grid (number or [x, y, z]), applied last.
+            snap_rotation: Rotation grid in degrees, applied last.
+
+        Returns:
+            Dict with count, missing (unknown names), skipped and elapsed_ms.
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            optional = {"names": names, "filter": filter, "in_box": in_box, "in_sphere": in_sphere,
+                        "location": location, "rotation": rotation, "scale": scale, "matrix": matrix,
+                        "rotate": rotate, "offset": offset, "scale_by": scale_by, "pivot": pivot,
+                        "snap": snap, "snap_rotation": snap_rotation}
+            params: Dict[str, Any] = {"mode": mode}
+            params.update({key: value for key, value in optional.items() if value is not None})
+            if match_label:
+                params["match_label"] = True
+            response = unreal.send_command("set_actor_transforms", params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            return response
+        except Exception as e:
+            error_msg = f"Error setting actor transforms: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_actor_properties(ctx: Context, name: str, property_path: str = "") -> Dict[str, Any]:
+        """Get all properties of an actor, or just the value at property_path.
+
+        property_path follows nested properties, e.g. "RootComponent.RelativeLocation",
+        "Subobject:Mesh.BodyInstance" or "Tags[0]"; the result is then
+        {name, property_path, properties: {property_path: value}}.
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -206,9 +343,10 @@ def register_editor_tools(mcp: FastMCP):
                 logger.error("Failed to connect to Unreal Engine")
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
                 
-            response = unreal.send_command("get_actor_properties", {
-                "name": name
-            })
+            params = {"name": name}
+            if property_path:
+                params["property_path"] = property_path
+            response = unreal.send_command("get_actor_properties", params)
             return response or {}
             
         except Exception as e:
@@ -221,13 +359,16 @@ def register_editor_tools(mcp: FastMCP):
         name: str,
         property_name: str,
         property_value,
+        match_label: bool = False,
     ) -> Dict[str, Any]:
         """
         Set a property on an actor.
         
         Args:
-            name: Name of the actor
-            property_name: Name of the property to set
+            name: Object name of the actor
+            match_label: Also accept the actor's label when no actor has that name (must be unique)
+            property_name: Name of the property to set, or a property path
+                  (e.g. "Subobject:Mesh.BodyInstance.MassScale")
             property_value: Value to set the property to
             
         Returns:
@@ -241,11 +382,14 @@ def register_editor_tools(mcp: FastMCP):
                 logger.error("Failed to connect to Unreal Engine")
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
                 
-            response = unreal.send_command("set_actor_property", {
+            params = {
                 "name": name,
                 "property_name": property_name,
                 "property_value": property_value
-            })
+            }
+            if match_label:
+                params["match_label"] = True
+            response = unreal.send_command("set_actor_property", params)
             
             if not response:
                 logger.error("No response from Unreal Engine")
@@ -306,6 +450,52 @@ def register_editor_tools(mcp: FastMCP):
             logger.error(f"Error focusing viewport: {e}")
             return {"status": "error", "message": str(e)}
 
+    @mcp.tool()
+    def spawn_actors(
+        ctx: Context,
+        actors: List[Dict[str, Any]],
+        class_name: str = "",
+        blueprint: str = "",
+        static_mesh: str = "",
+        folder: str = "",
+        instancing: str = "none",
+    ) -> Dict[str, Any]:
+        """
+        Spawn many actors in one call and one undo transaction.
+
+        Args:
+            actors: Entries like {"class": "PointLight", "name": "Lamp_01", "location": [0, 0, 300]}
+                  or {"static_mesh": "/Game/Props/SM_Rock", "location": [...], "rotation": [...],
+                  "scale": [...]}. Per-entry keys: class or blueprint, name, location, rotation,
+                  scale, static_mesh, folder.
+            class_name: Default class for entries without class/blueprint (default StaticMeshActor).
+            blueprint: Default Blueprint for entries without class/blueprint.
+            static_mesh: Default static mesh for StaticMeshActor entries.
+            folder: Default outliner folder.
+            instancing: "ism" or "hism" merges unnamed StaticMeshActor entries into one
+                  instanced-mesh actor per mesh; "none" spawns one actor each.
+
+        Returns:
+            Dict with spawned_count, actors, instanced, failed_count and elapsed_ms.
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            params: Dict[str, Any] = {"actors": actors, "instancing": instancing}
+            optional = {"class": class_name, "blueprint": blueprint, "static_mesh": static_mesh, "folder": folder}
+            params.update({key: value for key, value in optional.items() if value})
+            response = unreal.send_command("spawn_actors", params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            return response
+        except Exception as e:
+            error_msg = f"Error spawning actors: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def spawn_blueprint_actor(
         ctx: Context,
@@ -484,7 +674,9 @@ def register_editor_tools(mcp: FastMCP):
         ctx: Context,
         subsystem_class: str,
         function_name: str,
-        parameters: Dict[str, Any] = None
+        parameters: Dict[str, Any] = None,
+        parameter_sets: Optional[List[Dict[str, Any]]] = None,
+        stop_on_error: bool = False
     ) -> Dict[str, Any]:
         """
         Call a BlueprintCallable function on a WorldSubsystem.
@@ -498,9 +690,15 @@ def register_editor_tools(mcp: FastMCP):
             subsystem_class: Full class path of the subsystem (e.g. "/Script/AIPoint.AIPointWorldSubsystem")
             function_name: Name of the function to call (e.g. "CreateRoute")
             parameters: Dict of parameter names and values to pass to the function
+            parameter_sets: Batch form: a list of parameter dicts; the function is
+                  called once per dict in a single editor round trip. Use this
+                  instead of calling the tool in a loop.
+            stop_on_error: Batch form: stop at the first call that fails
 
         Returns:
-            Dict containing the function's return value(s) and success status
+            Dict containing the function's return value(s) and success status.
+            The batch form returns results (one dict per call, each with success,
+            error or the return values), count and failed_count.
 
         Examples:
             # Create a new AIPointRoute through the subsystem
@@ -509,6 +707,13 @@ def register_editor_tools(mcp: FastMCP):
                 function_name="CreateRoute",
                 parameters={"Label": "MyRoute"}
             )
+
+            # Create three routes in one call
+            call_subsystem_function(
+                subsystem_class="/Script/AIPoint.AIPointWorldSubsystem",
+                function_name="CreateRoute",
+                parameter_sets=[{"Label": "A"}, {"Label": "B"}, {"Label": "C"}]
+            )
         """
         from unreal_mcp_server import get_unreal_connection
 
@@ -523,7 +728,10 @@ def register_editor_tools(mcp: FastMCP):
                 "function_name": function_name
             }
 
-            if parameters:
+            if parameter_sets is not None:
+                params["parameter_sets"] = parameter_sets
+                params["stop_on_error"] = stop_on_error
+            elif parameters:
                 params["parameters"] = parameters
 
             logger.info(f"Calling subsystem function '{function_name}' on '{subsystem_class}'")
@@ -547,7 +755,8 @@ def register_editor_tools(mcp: FastMCP):
         actor_name: str,
         property_name: str,
         element_name: str = None,
-        element_names: List[str] = None
+        element_names: List[str] = None,
+        match_label: bool = False
     ) -> Dict[str, Any]:
         """
         Add actor(s) to an array property on a target actor.
@@ -561,6 +770,7 @@ def register_editor_tools(mcp: FastMCP):
             property_name: Name of the array property (e.g. "AIPoints")
             element_name: Name of a single actor to add to the array
             element_names: Names of multiple actors to add to the array
+            match_label: Also accept unique editor labels for all of these names
 
         Returns:
             Dict containing success status, added count, and new array size
@@ -593,6 +803,8 @@ def register_editor_tools(mcp: FastMCP):
                 "property_name": property_name
             }
 
+            if match_label:
+                params["match_label"] = True
             if element_name:
                 params["element_name"] = element_name
             elif element_names:
@@ -631,9 +843,10 @@ def register_editor_tools(mcp: FastMCP):
         Args:
             path: Content-browser path (/Game/.../MyAsset) or full object path
                   (/Game/.../MyAsset.MyAsset).
-            property_path: Optional top-level property name. When set, only that
-                  property's value is returned, keyed under `properties[property_path]`.
-                  Nested paths (e.g. "Comp.Field") are not yet supported.
+            property_path: Optional property path. When set, only the value at that
+                  path is serialized, keyed under `properties[property_path]`. Paths
+                  follow structs, arrays, maps and subobjects, e.g. "Entries[0].Tag",
+                  "Stats[Health]" or "Subobject:Name.Prop".
             allow_any_object: When false (default) the command rejects assets that
                   aren't UDataAsset. Set true to read arbitrary UObject assets.
 
@@ -715,4 +928,425 @@ def register_editor_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def query_assets(
+        ctx: Context,
+        paths: Optional[List[str]] = None,
+        classes: Optional[List[str]] = None,
+        name: str = "",
+        tags: Optional[List[Dict[str, Any]]] = None,
+        return_tags: Optional[List[str]] = None,
+        sort: str = "name",
+        descending: bool = False,
+        recursive: bool = True,
+        recursive_classes: bool = True,
+        on_disk_only: bool = False,
+        limit: int = 500,
+        cursor: str = "",
+        no_cache: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Sorted, paged AssetRegistry query with tag/value filters. Never loads assets.
+
+        Results are cached per query in the editor until an asset is added, removed,
+        renamed or re-saved, so paging through a large project only walks the
+        registry once.
+
+        Args:
+            paths: Package paths (default ["/Game"]).
+            classes: Asset classes, short names ("StaticMesh") or full paths; a
+                  blueprint class path ("/Game/BP/BP_Item.BP_Item_C") finds assets
+                  of that blueprint class (e.g. data assets).
+            name: Wildcard glob on asset name, case-insensitive.
+            tags: Asset registry tag predicates, all must match, e.g.
+                  [{"key": "NativeParentClass", "op": "contains", "value": "Character"},
+                   {"key": "Triangles", "op": "gt", "value": 10000}].
+                  op: eq (default), ne, contains, glob, exists, missing, lt, le, gt, ge.
+                  Comparisons are numeric when both sides are numbers.
+            return_tags: Tag keys to return per asset (["*"] for all tags).
+            sort: name, path or class.
+            descending: Reverse the order.
+            recursive: Recurse into subfolders.
+            recursive_classes: Include subclasses of the given classes.
+            on_disk_only: Skip assets that only exist in memory.
+            limit: Page size (max 10000).
+            cursor: next_cursor from the previous page.
+            no_cache: Bypass the editor-side result cache.
+
+        Returns:
+            Dict with assets (name, path, package_path, class, parent_class?, tags?),
+            count, total, next_cursor (absent on the last page), cached, generation
+            and registry_loading (true while the editor is still discovering assets;
+            results may be incomplete and are not cached).
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            params: Dict[str, Any] = {
+                "sort": sort,
+                "descending": descending,
+                "recursive": recursive,
+                "recursive_classes": recursive_classes,
+                "on_disk_only": on_disk_only,
+                "limit": limit,
+            }
+            if paths:
+                params["paths"] = paths
+            if classes:
+                params["classes"] = classes
+            if name:
+                params["name"] = name
+            if tags:
+                params["tags"] = tags
+            if return_tags:
+                params["return_tags"] = return_tags
+            if cursor:
+                params["cursor"] = cursor
+            if no_cache:
+                params["no_cache"] = True
+            response = unreal.send_command("query_assets", params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            result = response.get("result", {})
+            logger.info(f"query_assets count={result.get('count', '?')} total={result.get('total', '?')} cached={result.get('cached', '?')}")
+            return response
+        except Exception as e:
+            error_msg = f"Error querying assets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_assets_bulk(
+        ctx: Context,
+        assets: Optional[List[str]] = None,
+        paths: Optional[List[str]] = None,
+        classes: Optional[List[str]] = None,
+        name: str = "",
+        tags: Optional[List[Dict[str, Any]]] = None,
+        property_path: str = "",
+        limit: int = 100,
+        cursor: str = "",
+        time_budget_seconds: float = 20.0,
+    ) -> Dict[str, Any]:
+        """
+        Read the properties of many assets in one call instead of one get_data_asset
+        or get_blueprint_defaults call per asset.
+
+        Every package is requested up front and loaded asynchronously; each asset is
+        serialized as soon as it finishes loading, so disk reads overlap serialization.
+        Blueprints report their class defaults (CDO), other assets their own properties.
+
+        Args:
+            assets: Asset paths to read (max 1000). When omitted, the query_assets
+                  filter below selects one page of assets instead.
+            paths: Filter: package paths (default ["/Game"]).
+            classes: Filter: asset classes, short names or full paths.
+            name: Filter: wildcard glob on asset name.
+            tags: Filter: query_assets tag predicates.
+            property_path: Read only this property path from each asset
+                  (e.g. "Stats.MaxHealth").
+            limit: Filter page size (max 1000).
+            cursor: next_cursor from the previous page.
+            time_budget_seconds: Stop waiting for loads after this long (max 50);
+                  unfinished assets are listed in pending and keep loading, so a
+                  follow-up call with assets=pending is cheap.
+
+        Returns:
+            Dict with assets (in load-completion order: path, asset_name, asset_class,
+            parent_class? for blueprints, properties, or error), count, requested,
+            already_loaded_count, failed_count, pending, elapsed_ms, and for filter
+            reads total and next_cursor (absent on the last page).
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            params: Dict[str, Any] = {"time_budget_seconds": time_budget_seconds}
+            if assets:
+                params["assets"] = assets
+            else:
+                params["limit"] = limit
+                if paths:
+                    params["paths"] = paths
+                if classes:
+                    params["classes"] = classes
+                if name:
+                    params["name"] = name
+                if tags:
+                    params["tags"] = tags
+                if cursor:
+                    params["cursor"] = cursor
+            if property_path:
+                params["property_path"] = property_path
+            response = unreal.send_command("get_assets_bulk", params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            result = response.get("result", {})
+            logger.info(f"get_assets_bulk count={result.get('count', '?')} failed={result.get('failed_count', '?')} pending={len(result.get('pending', []))} elapsed_ms={result.get('elapsed_ms', '?')}")
+            return response
+        except Exception as e:
+            error_msg = f"Error reading assets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    def _spatial_query(command: str, params: Dict[str, Any], class_name: str, tag: str,
+                       fields: Optional[List[str]], refresh: bool) -> Dict[str, Any]:
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            if class_name:
+                params["class"] = class_name
+            if tag:
+                params["tag"] = tag
+            if fields:
+                params["fields"] = fields
+            if refresh:
+                params["refresh"] = True
+            response = unreal.send_command(command, params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            logger.info(f"{command} count={response.get('result', {}).get('count', '?')}")
+            return response
+        except Exception as e:
+            error_msg = f"Error in {command}: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def find_actors_in_box(
+        ctx: Context,
+        min: Optional[List[float]] = None,
+        max: Optional[List[float]] = None,
+        center: Optional[List[float]] = None,
+        extent: Optional[List[float]] = None,
+        class_name: str = "",
+        tag: str = "",
+        fields: Optional[List[str]] = None,
+        limit: int = 1000,
+        refresh: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Find actors whose bounds intersect an axis-aligned box (octree-backed).
+
+        Args:
+            min, max: [x, y, z] box corners. Alternatively give center and extent.
+            center, extent: [x, y, z] box center and half-size.
+            class_name: Only actors of this class or a subclass.
+            tag: Only actors with this tag.
+            fields: Fields per actor (name, label, class, path, location, rotation,
+                  scale, bounds, folder, level, tags). Default: name, class and transform.
+            limit: Max actors returned; `truncated` is true when more matched.
+            refresh: Rebuild the spatial index first.
+
+        Returns:
+            Dict with actors, count and truncated.
+        """
+        params: Dict[str, Any] = {"limit": limit}
+        if min is not None and max is not None:
+            params["min"] = min
+            params["max"] = max
+        if center is not None and extent is not None:
+            params["center"] = center
+            params["extent"] = extent
+        return _spatial_query("find_actors_in_box", params, class_name, tag, fields, refresh)
+
+    @mcp.tool()
+    def find_actors_in_sphere(
+        ctx: Context,
+        center: List[float],
+        radius: float,
+        class_name: str = "",
+        tag: str = "",
+        fields: Optional[List[str]] = None,
+        limit: int = 1000,
+        refresh: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Find actors whose bounds intersect a sphere (octree-backed).
+
+        Args:
+            center: [x, y, z] sphere center.
+            radius: Sphere radius.
+            class_name, tag, fields, limit, refresh: As find_actors_in_box.
+
+        Returns:
+            Dict with actors, count and truncated.
+        """
+        params: Dict[str, Any] = {"center": center, "radius": radius, "limit": limit}
+        return _spatial_query("find_actors_in_sphere", params, class_name, tag, fields, refresh)
+
+    @mcp.tool()
+    def find_actors_in_frustum(
+        ctx: Context,
+        use_viewport: bool = False,
+        origin: Optional[List[float]] = None,
+        rotation: Optional[List[float]] = None,
+        fov: Optional[float] = None,
+        aspect_ratio: Optional[float] = None,
+        near: Optional[float] = None,
+        far: Optional[float] = None,
+        class_name: str = "",
+        tag: str = "",
+        fields: Optional[List[str]] = None,
+        limit: int = 1000,
+        refresh: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Find actors whose bounds intersect a perspective view frustum (octree-backed).
+
+        Args:
+            use_viewport: Use the active level viewport's camera, FOV and aspect ratio.
+            origin: [x, y, z] camera location (required without use_viewport).
+            rotation: [pitch, yaw, roll] camera rotation (required without use_viewport).
+            fov: Horizontal field of view in degrees (default 90).
+            aspect_ratio: Width / height (default 16:9).
+            near, far: Clip distances (default 10 and 100000).
+            class_name, tag, fields, limit, refresh: As find_actors_in_box.
+
+        Returns:
+            Dict with actors, count and truncated.
+        """
+        params: Dict[str, Any] = {"limit": limit}
+        if use_viewport:
+            params["use_viewport"] = True
+        optional = {"origin": origin, "rotation": rotation, "fov": fov,
+                    "aspect_ratio": aspect_ratio, "near": near, "far": far}
+        params.update({key: value for key, value in optional.items() if value is not None})
+        return _spatial_query("find_actors_in_frustum", params, class_name, tag, fields, refresh)
+
+    @mcp.tool()
+    def find_nearest_actors(
+        ctx: Context,
+        point: List[float],
+        count: int = 10,
+        max_distance: float = 0.0,
+        class_name: str = "",
+        tag: str = "",
+        fields: Optional[List[str]] = None,
+        refresh: bool = False,
+    ) -> Dict[str, Any]:
+        """
+        Find the actors nearest to a point, measured to their bounds.
+
+        Args:
+            point: [x, y, z] query point.
+            count: Number of actors to return.
+            max_distance: Ignore actors farther than this (0 = unbounded).
+            class_name, tag, fields, refresh: As find_actors_in_box.
+
+        Returns:
+            Dict with actors (nearest first, each with a distance field) and count.
+        """
+        params: Dict[str, Any] = {"point": point, "count": count}
+        if max_distance > 0:
+            params["max_distance"] = max_distance
+        return _spatial_query("find_nearest_actors", params, class_name, tag, fields, refresh)
+
+    def _send_world_partition_command(command: str, params: Dict[str, Any]) -> Dict[str, Any]:
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            response = unreal.send_command(command, params)
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+            return response
+        except Exception as e:
+            error_msg = f"Error in {command}: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def find_world_partition_actors(
+        ctx: Context,
+        class_name: str = "",
+        name: str = "",
+        min: Optional[List[float]] = None,
+        max: Optional[List[float]] = None,
+        data_layer: str = "",
+        loaded: Optional[bool] = None,
+        limit: int = 1000,
+        cursor: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Query actors of a World Partition map from their descriptors, without loading cells.
+
+        Args:
+            class_name: Only actors of this class or a subclass (blueprint classes match exactly).
+            name: Wildcard (* and ?) on actor name or label.
+            min, max: [x, y, z] box the actor's editor bounds must intersect.
+            data_layer: Data layer instance name, short name or asset path.
+            loaded: True for loaded actors only, False for unloaded only.
+            limit: Page size.
+            cursor: "next_cursor" from the previous page.
+
+        Returns:
+            Dict with actors ([{guid, name, label, class, package, bounds, data_layers, loaded,
+            spatially_loaded, runtime_grid}]), count, total and next_cursor.
+        """
+        params: Dict[str, Any] = {"limit": limit}
+        if class_name:
+            params["class"] = class_name
+        if name:
+            params["name"] = name
+        if min is not None and max is not None:
+            params["min"] = min
+            params["max"] = max
+        if data_layer:
+            params["data_layer"] = data_layer
+        if loaded is not None:
+            params["loaded"] = loaded
+        if cursor:
+            params["cursor"] = cursor
+        return _send_world_partition_command("find_world_partition_actors", params)
+
+    @mcp.tool()
+    def load_world_partition_actors(
+        ctx: Context,
+        guids: Optional[List[str]] = None,
+        names: Optional[List[str]] = None,
+    ) -> Dict[str, Any]:
+        """
+        Load and pin individual World Partition actors (not their cells) for inspection.
+
+        Edit commands (set_actor_transform, set_actor_property, ...) already load an unloaded
+        actor by name on their own; this is for reading full properties first.
+
+        Args:
+            guids: Actor guids from find_world_partition_actors.
+            names: Actor names, package paths or labels. A name matching several actors is an
+                error listing their GUIDs and packages.
+
+        Returns:
+            Dict with actors (loaded, with guid), failed and pinned_count.
+        """
+        params: Dict[str, Any] = {}
+        if guids:
+            params["guids"] = guids
+        if names:
+            params["names"] = names
+        return _send_world_partition_command("load_world_partition_actors", params)
+
+    @mcp.tool()
+    def release_world_partition_actors(ctx: Context, guids: Optional[List[str]] = None) -> Dict[str, Any]:
+        """
+        Drop the pins on loaded World Partition actors (all when guids is omitted).
+
+        Actors with unsaved changes stay pinned and are listed in kept_dirty.
+        """
+        params: Dict[str, Any] = {}
+        if guids:
+            params["guids"] = guids
+        return _send_world_partition_command("release_world_partition_actors", params)
+
     logger.info("Editor tools registered successfully")
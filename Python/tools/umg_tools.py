@@ -1109,6 +1109,87 @@ def register_umg_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def get_widget_property(
+        ctx: Context,
+        blueprint_name: str,
+        widget_name: str,
+        property_path: str
+    ) -> Dict[str, Any]:
+        """
+        Read one property path from a widget in a Widget Blueprint's tree.
+
+        Args:
+            blueprint_name: Name or asset path of the target Widget Blueprint
+            widget_name: Target widget name
+            property_path: Property path, e.g. "ColorAndOpacity", "Font.Size"
+                or "Slot.LayoutData.Offsets" (the widget's panel slot)
+
+        Returns:
+            Dict with widget_name, widget_class, property_path and value
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "blueprint_name": blueprint_name,
+                "widget_name": widget_name,
+                "property_path": property_path,
+            }
+            response = unreal.send_command("get_widget_property", params)
+            return response or {"success": False, "message": "No response from Unreal Engine"}
+        except Exception as e:
+            error_msg = f"Error reading widget property: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def set_widget_property(
+        ctx: Context,
+        blueprint_name: str,
+        widget_name: str,
+        property_path: str,
+        property_value: Any
+    ) -> Dict[str, Any]:
+        """
+        Set one property path on a widget in a Widget Blueprint's tree, then compile and save.
+
+        Args:
+            blueprint_name: Name or asset path of the target Widget Blueprint
+            widget_name: Target widget name
+            property_path: Property path, e.g. "RenderOpacity" or "Slot.Padding.Left"
+            property_value: Value in the shape get_widget_property returns
+
+        Returns:
+            Dict with widget_name, property_path and the value read back
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "blueprint_name": blueprint_name,
+                "widget_name": widget_name,
+                "property_path": property_path,
+                "property_value": property_value,
+            }
+            logger.info(f"Setting widget property with params: {params}")
+            response = unreal.send_command("set_widget_property", params)
+            return response or {"success": False, "message": "No response from Unreal Engine"}
+        except Exception as e:
+            error_msg = f"Error setting widget property: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def set_text_block_properties(
         ctx: Context,
@@ -290,6 +290,7 @@ from tools.project_tools import register_project_tools
 from tools.umg_tools import register_umg_tools
 from tools.behavior_tree_tools import register_behavior_tree_tools
 from tools.animation_tools import register_animation_tools
+from tools.benchmark_tools import register_benchmark_tools
 from tools.help_tools import register_help_tools
 if _HAS_DIALOGUE_EXTENSION:
     from tools.dialogue_tools import register_dialogue_tools
@@ -304,6 +305,7 @@ register_project_tools(mcp)
 register_umg_tools(mcp)
 register_behavior_tree_tools(mcp)
 register_animation_tools(mcp)
+register_benchmark_tools(mcp)
 register_help_tools(mcp)
 if _HAS_DIALOGUE_EXTENSION:
     logger.info("Registering Dialogue tools because UnrealMCPDialogue extension is present")
@@ -342,7 +344,7 @@ def info():
     - `take_screenshot(filename, show_ui, resolution)` - Capture screenshots
 
     ### Actor Management
-    - `get_actors_in_level()` - List all actors in current level
+    - `get_actors_in_level(class_name="", level="", label="", fields=None, limit=1000, cursor="")` - Page through actors with server-side filters
     - `find_actors_by_name(pattern)` - Find actors by name pattern
     - `spawn_actor(name, type, location=[0,0,0], rotation=[0,0,0], scale=[1,1,1])` - Create actors
     - `delete_actor(name)` - Remove actors